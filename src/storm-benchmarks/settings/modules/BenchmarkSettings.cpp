@@ -0,0 +1,78 @@
+#include "storm-benchmarks/settings/modules/BenchmarkSettings.h"
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/SettingMemento.h"
+#include "storm/settings/Option.h"
+#include "storm/settings/OptionBuilder.h"
+#include "storm/settings/ArgumentBuilder.h"
+
+#include <algorithm>
+#include <boost/algorithm/string.hpp>
+
+namespace storm {
+    namespace settings {
+        namespace modules {
+            
+            const std::string BenchmarkSettings::moduleName = "benchmarks";
+            const std::string outputOption = "output";
+            const std::string instancesOption = "instances";
+            const std::string qvbsOption = "qvbs";
+            const std::string repetitionsOption = "repetitions";
+            const std::string listOption = "list";
+            
+            std::vector<std::string> splitCommaSeparatedList(std::string const& list) {
+                std::vector<std::string> result;
+                boost::split(result, list, boost::is_any_of(","));
+                for (auto& entry : result) {
+                    boost::trim(entry);
+                }
+                result.erase(std::remove(result.begin(), result.end(), ""), result.end());
+                return result;
+            }
+
+            BenchmarkSettings::BenchmarkSettings() : ModuleSettings(moduleName) {
+                this->addOption(storm::settings::OptionBuilder(moduleName, outputOption, false, "Sets the file to which the measurements are written.").addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The name of the json file.").setDefaultValueString("storm-benchmarks.json").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, instancesOption, false, "Only runs the given instances.").addArgument(storm::settings::ArgumentBuilder::createStringArgument("names", "A comma separated list of instance names.").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, qvbsOption, false, "Additionally runs the given benchmarks of the QVBS checkout given by --qvbsroot.").addArgument(storm::settings::ArgumentBuilder::createStringArgument("models", "A comma separated list of entries <model> or <model>:<instance index>.").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, repetitionsOption, false, "Sets how often each instance is run.").addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of runs per instance.").setDefaultValueUnsignedInteger(1).addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, listOption, false, "Lists the available instances and exits.").build());
+            }
+
+            std::string BenchmarkSettings::getOutputFilename() const {
+                return this->getOption(outputOption).getArgumentByName("filename").getValueAsString();
+            }
+            
+            bool BenchmarkSettings::isInstanceFilterSet() const {
+                return this->getOption(instancesOption).getHasOptionBeenSet();
+            }
+            
+            std::vector<std::string> BenchmarkSettings::getInstanceFilter() const {
+                return splitCommaSeparatedList(this->getOption(instancesOption).getArgumentByName("names").getValueAsString());
+            }
+            
+            bool BenchmarkSettings::isQvbsBenchmarksSet() const {
+                return this->getOption(qvbsOption).getHasOptionBeenSet();
+            }
+            
+            std::vector<std::string> BenchmarkSettings::getQvbsBenchmarks() const {
+                return splitCommaSeparatedList(this->getOption(qvbsOption).getArgumentByName("models").getValueAsString());
+            }
+            
+            uint64_t BenchmarkSettings::getNumberOfRepetitions() const {
+                return this->getOption(repetitionsOption).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+            
+            bool BenchmarkSettings::isListInstancesSet() const {
+                return this->getOption(listOption).getHasOptionBeenSet();
+            }
+            
+            void BenchmarkSettings::finalize() {
+            }
+
+            bool BenchmarkSettings::check() const {
+                return true;
+            }
+            
+        } // namespace modules
+    } // namespace settings
+} // namespace storm
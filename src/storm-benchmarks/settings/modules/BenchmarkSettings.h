@@ -0,0 +1,71 @@
+#pragma once
+
+#include "storm-config.h"
+#include "storm/settings/modules/ModuleSettings.h"
+
+#include <string>
+#include <vector>
+
+namespace storm {
+    namespace settings {
+        namespace modules {
+
+            /*!
+             * This class represents the settings for running the benchmark suite.
+             */
+            class BenchmarkSettings : public ModuleSettings {
+            public:
+
+                /*!
+                 * Creates a new set of benchmark settings.
+                 */
+                BenchmarkSettings();
+
+                virtual ~BenchmarkSettings() = default;
+                
+                /*!
+                 * Retrieves the name of the file to which the measurements are written.
+                 */
+                std::string getOutputFilename() const;
+                
+                /*!
+                 * Retrieves whether only a subset of the instances is to be run.
+                 */
+                bool isInstanceFilterSet() const;
+                
+                /*!
+                 * Retrieves the names of the instances that are to be run.
+                 */
+                std::vector<std::string> getInstanceFilter() const;
+                
+                /*!
+                 * Retrieves whether benchmarks of a local QVBS checkout are to be run in addition to the shipped ones.
+                 */
+                bool isQvbsBenchmarksSet() const;
+                
+                /*!
+                 * Retrieves the QVBS benchmarks that are to be run. Each entry is of the form <model> or
+                 * <model>:<instance index>.
+                 */
+                std::vector<std::string> getQvbsBenchmarks() const;
+                
+                /*!
+                 * Retrieves how often each instance is run.
+                 */
+                uint64_t getNumberOfRepetitions() const;
+                
+                /*!
+                 * Retrieves whether the available instances are only to be listed.
+                 */
+                bool isListInstancesSet() const;
+                
+                bool check() const override;
+                void finalize() override;
+
+                // The name of the module.
+                static const std::string moduleName;
+            };
+
+        } // namespace modules
+    } // namespace settings
+} // namespace storm
@@ -0,0 +1,292 @@
+#include "storm/utility/initialize.h"
+
+#include "storm/settings/modules/GeneralSettings.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/settings/modules/IOSettings.h"
+#include "storm/settings/modules/DebugSettings.h"
+#include "storm/settings/modules/EigenEquationSolverSettings.h"
+#include "storm/settings/modules/GmmxxEquationSolverSettings.h"
+#include "storm/settings/modules/NativeEquationSolverSettings.h"
+#include "storm/settings/modules/EliminationSettings.h"
+#include "storm/settings/modules/MinMaxEquationSolverSettings.h"
+#include "storm/settings/modules/GameSolverSettings.h"
+#include "storm/settings/modules/BisimulationSettings.h"
+#include "storm/settings/modules/ResourceSettings.h"
+#include "storm/settings/modules/BuildSettings.h"
+#include "storm/settings/modules/MultiObjectiveSettings.h"
+#include "storm-benchmarks/settings/modules/BenchmarkSettings.h"
+
+#include "storm-cli-utilities/cli.h"
+#include "storm-cli-utilities/model-handling.h"
+
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm/api/storm.h"
+
+#include "storm/storage/Qvbs.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/utility/Stopwatch.h"
+#include "storm/utility/resources.h"
+#include "storm/utility/storm-version.h"
+#include "storm/utility/file.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+
+/*!
+ * An instance of the benchmark suite, i.e., a model file together with constant definitions and properties.
+ */
+struct BenchmarkInstance {
+    // The name under which the instance is reported.
+    std::string name;
+
+    // Whether the instance stems from the shipped test files or from a QVBS checkout.
+    std::string origin;
+
+    // The PRISM or JANI file of the model.
+    std::string file;
+
+    // Whether the file is a JANI file.
+    bool jani;
+
+    // The constant definitions of the instance.
+    std::string constants;
+
+    // The properties to check. For JANI files, these are taken from the file if empty.
+    std::string properties;
+};
+
+/*!
+ * Retrieves the curated instances that are shipped with Storm.
+ */
+std::vector<BenchmarkInstance> getShippedInstances() {
+    std::string const dir = STORM_TEST_RESOURCES_DIR;
+    return {
+        {"crowds-5-5", "testfiles", dir + "/dtmc/crowds-5-5.pm", false, "", "P=? [F \"observe0Greater1\"]"},
+        {"leader-3-5", "testfiles", dir + "/dtmc/leader-3-5.pm", false, "", "P=? [F \"elected\"]; R=? [F \"elected\"]"},
+        {"nand-5-2", "testfiles", dir + "/dtmc/nand-5-2.pm", false, "", "P=? [F \"target\"]"},
+        {"brp-16-2", "testfiles", dir + "/dtmc/brp-16-2.pm", false, "", "P=? [F \"target\"]"},
+        {"coin2-2", "testfiles", dir + "/mdp/coin2-2.nm", false, "", "Pmin=? [F \"finished\" & \"all_coins_equal_0\"]; Pmax=? [F \"finished\" & !\"agree\"]"},
+        {"leader4", "testfiles", dir + "/mdp/leader4.nm", false, "", "Pmin=? [F<=25 \"elected\"]; Rmax=? [F \"elected\"]"},
+        {"csma2-2", "testfiles", dir + "/mdp/csma2-2.nm", false, "", "Pmin=? [F \"all_delivered\"]; R{\"time\"}min=? [F \"all_delivered\"]"},
+        {"firewire", "testfiles", dir + "/mdp/firewire.nm", false, "delay=36,fast=0.5", "Pmin=? [F \"elected\"]; R{\"time\"}max=? [F \"elected\"]"},
+        {"cluster2", "testfiles", dir + "/ctmc/cluster2.sm", false, "", "P=? [F<=100 !\"minimum\"]; LRA=? [\"minimum\"]"},
+        {"embedded2", "testfiles", dir + "/ctmc/embedded2.sm", false, "", "LRA=? [\"fail_sensors\"]"},
+        {"polling2", "testfiles", dir + "/ctmc/polling2.sm", false, "", "P=? [F<=10 \"target\"]"},
+        {"stream2", "testfiles", dir + "/ma/stream2.ma", false, "", "Tmin=? [F \"done\"]; Pmax=? [F<=1 \"done\"]"}
+    };
+}
+
+/*!
+ * Retrieves the instances of the local QVBS checkout that were requested via the settings.
+ */
+std::vector<BenchmarkInstance> getQvbsInstances(std::vector<std::string> const& entries) {
+    std::vector<BenchmarkInstance> result;
+    for (auto const& entry : entries) {
+        std::string modelName = entry;
+        uint64_t instanceIndex = 0;
+        auto separatorPosition = entry.find(':');
+        if (separatorPosition != std::string::npos) {
+            modelName = entry.substr(0, separatorPosition);
+            try {
+                instanceIndex = std::stoull(entry.substr(separatorPosition + 1));
+            } catch (std::exception const&) {
+                STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "Illegal instance index in QVBS benchmark '" << entry << "'.");
+            }
+        }
+        storm::storage::QvbsBenchmark benchmark(modelName);
+        result.push_back({modelName + ":" + std::to_string(instanceIndex), "qvbs", benchmark.getJaniFile(instanceIndex), true, benchmark.getConstantDefinition(instanceIndex), ""});
+    }
+    return result;
+}
+
+/*!
+ * Retrieves the result of the given check for the initial state. If the model has more than one initial state, no
+ * value is reported.
+ */
+modernjson::json getResultAtInitialState(std::unique_ptr<storm::modelchecker::CheckResult> const& result, storm::storage::BitVector const& initialStates) {
+    modernjson::json value;
+    if (!result || initialStates.getNumberOfSetBits() != 1) {
+        return value;
+    }
+    uint64_t initialState = *initialStates.begin();
+    if (result->isExplicitQuantitativeCheckResult()) {
+        value = result->asExplicitQuantitativeCheckResult<double>()[initialState];
+    } else if (result->isExplicitQualitativeCheckResult()) {
+        value = result->asExplicitQualitativeCheckResult()[initialState];
+    }
+    return value;
+}
+
+/*!
+ * Runs the given instance once and records the time of each phase.
+ */
+modernjson::json runInstance(BenchmarkInstance const& instance) {
+    modernjson::json run;
+    storm::utility::Stopwatch totalWatch(true);
+
+    // Parse the model and its properties.
+    storm::utility::Stopwatch phaseWatch(true);
+    storm::cli::SymbolicInput input;
+    if (instance.jani) {
+        auto janiInput = storm::api::parseJaniModel(instance.file, storm::api::getSupportedJaniFeatures(storm::builder::BuilderType::Explicit));
+        input.model = storm::storage::SymbolicModelDescription(janiInput.first);
+        input.properties = std::move(janiInput.second);
+    } else {
+        input.model = storm::storage::SymbolicModelDescription(storm::api::parseProgram(instance.file));
+    }
+    if (!instance.properties.empty()) {
+        input.properties = storm::api::parsePropertiesForSymbolicModelDescription(instance.properties, input.model.get());
+    }
+    auto constantDefinitions = input.model.get().parseConstantDefinitions(instance.constants);
+    input.model = input.model.get().preprocess(constantDefinitions);
+    input.properties = storm::api::substituteConstantsInProperties(input.properties, constantDefinitions);
+    phaseWatch.stop();
+    run["parse"] = phaseWatch.getTimeInMilliseconds();
+
+    // Build the model.
+    phaseWatch.reset();
+    phaseWatch.start();
+    auto model = storm::api::buildSparseModel<double>(input.model.get(), storm::api::extractFormulasFromProperties(input.properties));
+    phaseWatch.stop();
+    run["build"] = phaseWatch.getTimeInMilliseconds();
+    run["states"] = model->getNumberOfStates();
+    run["transitions"] = model->getNumberOfTransitions();
+
+    // Preprocess the model as the command line interface would, e.g. by bisimulation minimization if requested.
+    phaseWatch.reset();
+    phaseWatch.start();
+    model = storm::cli::preprocessSparseModel<double>(model, input).first;
+    phaseWatch.stop();
+    run["preprocess"] = phaseWatch.getTimeInMilliseconds();
+    run["preprocessed-states"] = model->getNumberOfStates();
+
+    // Check all properties.
+    phaseWatch.reset();
+    phaseWatch.start();
+    modernjson::json results = modernjson::json::array();
+    for (auto const& property : input.properties) {
+        storm::utility::Stopwatch propertyWatch(true);
+        auto result = storm::api::verifyWithSparseEngine<double>(model, storm::api::createTask<double>(property.getRawFormula(), true));
+        propertyWatch.stop();
+
+        modernjson::json propertyResult;
+        propertyResult["name"] = property.getName();
+        propertyResult["time"] = propertyWatch.getTimeInMilliseconds();
+        propertyResult["result"] = getResultAtInitialState(result, model->getInitialStates());
+        results.push_back(propertyResult);
+    }
+    phaseWatch.stop();
+    run["check"] = phaseWatch.getTimeInMilliseconds();
+    run["properties"] = results;
+
+    totalWatch.stop();
+    run["total"] = totalWatch.getTimeInMilliseconds();
+    return run;
+}
+
+/*!
+ * Initialize the settings manager.
+ */
+void initializeSettings() {
+    storm::settings::mutableManager().setName("Storm-benchmarks", "storm-benchmarks");
+
+    storm::settings::addModule<storm::settings::modules::GeneralSettings>();
+    storm::settings::addModule<storm::settings::modules::IOSettings>();
+    storm::settings::addModule<storm::settings::modules::CoreSettings>();
+    storm::settings::addModule<storm::settings::modules::DebugSettings>();
+    storm::settings::addModule<storm::settings::modules::BuildSettings>();
+    storm::settings::addModule<storm::settings::modules::GmmxxEquationSolverSettings>();
+    storm::settings::addModule<storm::settings::modules::EigenEquationSolverSettings>();
+    storm::settings::addModule<storm::settings::modules::NativeEquationSolverSettings>();
+    storm::settings::addModule<storm::settings::modules::EliminationSettings>();
+    storm::settings::addModule<storm::settings::modules::MinMaxEquationSolverSettings>();
+    storm::settings::addModule<storm::settings::modules::GameSolverSettings>();
+    storm::settings::addModule<storm::settings::modules::BisimulationSettings>();
+    storm::settings::addModule<storm::settings::modules::ResourceSettings>();
+    storm::settings::addModule<storm::settings::modules::MultiObjectiveSettings>();
+
+    storm::settings::addModule<storm::settings::modules::BenchmarkSettings>();
+}
+
+/*!
+ * Entry point for the benchmark suite.
+ *
+ * @param argc The argc argument of main().
+ * @param argv The argv argument of main().
+ * @return Return code, 0 if successfull, not 0 otherwise.
+ */
+int main(const int argc, const char** argv) {
+    try {
+        storm::utility::setUp();
+        storm::cli::printHeader("Storm-benchmarks", argc, argv);
+        initializeSettings();
+
+        bool optionsCorrect = storm::cli::parseOptions(argc, argv);
+        if (!optionsCorrect) {
+            return -1;
+        }
+
+        auto const& benchmarkSettings = storm::settings::getModule<storm::settings::modules::BenchmarkSettings>();
+
+        std::vector<BenchmarkInstance> instances = getShippedInstances();
+        if (benchmarkSettings.isQvbsBenchmarksSet()) {
+            auto qvbsInstances = getQvbsInstances(benchmarkSettings.getQvbsBenchmarks());
+            instances.insert(instances.end(), qvbsInstances.begin(), qvbsInstances.end());
+        }
+        if (benchmarkSettings.isInstanceFilterSet()) {
+            auto filter = benchmarkSettings.getInstanceFilter();
+            for (auto const& name : filter) {
+                STORM_LOG_THROW(std::find_if(instances.begin(), instances.end(), [&name] (BenchmarkInstance const& instance) { return instance.name == name; }) != instances.end(), storm::exceptions::InvalidArgumentException, "Unknown benchmark instance '" << name << "'.");
+            }
+            instances.erase(std::remove_if(instances.begin(), instances.end(), [&filter] (BenchmarkInstance const& instance) { return std::find(filter.begin(), filter.end(), instance.name) == filter.end(); }), instances.end());
+        }
+
+        if (benchmarkSettings.isListInstancesSet()) {
+            for (auto const& instance : instances) {
+                STORM_PRINT(instance.name << " \t" << instance.file << (instance.constants.empty() ? "" : " \t" + instance.constants) << std::endl);
+            }
+            storm::utility::cleanUp();
+            return 0;
+        }
+
+        modernjson::json measurements;
+        measurements["version"] = storm::utility::StormVersion::shortVersionString();
+        measurements["revision"] = storm::utility::StormVersion::gitRevisionHash;
+        measurements["compiler"] = storm::utility::StormVersion::cxxCompiler;
+        measurements["flags"] = storm::utility::StormVersion::cxxFlags;
+        measurements["instances"] = modernjson::json::array();
+
+        for (auto const& instance : instances) {
+            STORM_PRINT_AND_LOG("Running benchmark instance " << instance.name << "..." << std::endl);
+            modernjson::json instanceMeasurements;
+            instanceMeasurements["name"] = instance.name;
+            instanceMeasurements["origin"] = instance.origin;
+            instanceMeasurements["file"] = instance.file;
+            instanceMeasurements["constants"] = instance.constants;
+            instanceMeasurements["runs"] = modernjson::json::array();
+            for (uint64_t repetition = 0; repetition < benchmarkSettings.getNumberOfRepetitions(); ++repetition) {
+                instanceMeasurements["runs"].push_back(runInstance(instance));
+            }
+            // The peak resident set size is taken over the whole process. Instances can be measured in isolation by
+            // restricting the run to them via --instances.
+            instanceMeasurements["peak-rss-kb"] = storm::utility::resources::usedPeakMemory();
+            measurements["instances"].push_back(instanceMeasurements);
+        }
+
+        std::ofstream stream;
+        storm::utility::openFile(benchmarkSettings.getOutputFilename(), stream);
+        stream << measurements.dump(4) << std::endl;
+        storm::utility::closeFile(stream);
+        STORM_PRINT_AND_LOG("Wrote measurements of " << instances.size() << " instances to " << benchmarkSettings.getOutputFilename() << "." << std::endl);
+
+        // All operations have now been performed, so we clean up everything and terminate.
+        storm::utility::cleanUp();
+        return 0;
+    } catch (storm::exceptions::BaseException const &exception) {
+        STORM_LOG_ERROR("An exception caused Storm-benchmarks to terminate. The message of the exception is: " << exception.what());
+        return 1;
+    } catch (std::exception const &exception) {
+        STORM_LOG_ERROR("An unexpected exception occurred and caused Storm-benchmarks to terminate. The message of this exception is: " << exception.what());
+        return 2;
+    }
+}
@@ -8,6 +8,7 @@
 
 #include "storm/utility/initialize.h"
 #include "storm/utility/Stopwatch.h"
+#include "storm/utility/Profiler.h"
 
 #include <type_traits>
 #include <ctime>
@@ -62,6 +63,7 @@ namespace storm {
             if (storm::settings::getModule<storm::settings::modules::ResourceSettings>().isPrintTimeAndMemorySet()) {
                 storm::cli::printTimeAndMemoryStatistics(totalTimer.getTimeInMilliseconds());
             }
+            storm::cli::exportProfile();
 
             storm::utility::cleanUp();
             return 0;
@@ -206,6 +208,11 @@ namespace storm {
             if (resources.isTimeoutSet()) {
                 storm::utility::resources::setCPULimit(resources.getTimeoutInSeconds());
             }
+            
+            // If requested, we collect phase timings and counters.
+            if (resources.isProfilingSet()) {
+                storm::utility::Profiler::getInstance().setEnabled(true);
+            }
         }
         
         void setLogLevel() {
@@ -285,6 +292,20 @@ namespace storm {
                 std::cout << "  * wallclock time: " << (wallclockMilliseconds/1000) << "." << std::setw(3) << (wallclockMilliseconds % 1000) << "s" << std::endl;
             }
             std::cout.fill(oldFillChar);
+            if (storm::utility::Profiler::getInstance().isEnabled()) {
+                std::cout << "Phase statistics:" << std::endl;
+                storm::utility::Profiler::getInstance().printSummary(std::cout);
+            }
+        }
+        
+        void exportProfile() {
+            storm::settings::modules::ResourceSettings const& resources = storm::settings::getModule<storm::settings::modules::ResourceSettings>();
+            if (resources.isExportProfileSet()) {
+                storm::utility::Profiler::getInstance().exportToJson(resources.getExportProfileFilename());
+            }
+            if (resources.isExportTraceSet()) {
+                storm::utility::Profiler::getInstance().exportToChromeTrace(resources.getExportTraceFilename());
+            }
         }
         
     }
@@ -24,6 +24,11 @@ namespace storm {
             
         void printTimeAndMemoryStatistics(uint64_t wallclockMilliseconds = 0);
         
+        /*!
+         * Exports the collected phase timings and counters if requested via the resource settings.
+         */
+        void exportProfile();
+        
         /*!
          * Parses the given command line arguments.
          *
@@ -13,6 +13,7 @@
 
 #include "storm/utility/initialize.h"
 #include "storm/utility/Stopwatch.h"
+#include "storm/utility/Profiler.h"
 
 #include <type_traits>
 
@@ -21,12 +22,15 @@
 #include "storm/storage/jani/Property.h"
 
 #include "storm/builder/BuilderType.h"
+#include "storm/builder/IncrementalExplicitModelBuilder.h"
 
 #include "storm/models/ModelBase.h"
 
 #include "storm/exceptions/OptionParserException.h"
 
 #include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/utility/cli.h"
 
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/models/symbolic/StandardRewardModel.h"
@@ -63,6 +67,7 @@ namespace storm {
         
         void parseSymbolicModelDescription(storm::settings::modules::IOSettings const& ioSettings, SymbolicInput& input, storm::builder::BuilderType const& builderType) {
             if (ioSettings.isPrismOrJaniInputSet()) {
+                storm::utility::ProfilerPhase phase("parse model");
                 storm::utility::Stopwatch modelParsingWatch(true);
                 if (ioSettings.isPrismInputSet()) {
                     input.model = storm::api::parseProgram(ioSettings.getPrismInputFilename(), storm::settings::getModule<storm::settings::modules::BuildSettings>().isPrismCompatibilityEnabled());
@@ -91,6 +96,7 @@ namespace storm {
         
         void parseProperties(storm::settings::modules::IOSettings const& ioSettings, SymbolicInput& input, boost::optional<std::set<std::string>> const& propertyFilter) {
             if (ioSettings.isPropertySet()) {
+                storm::utility::ProfilerPhase phase("parse properties");
                 std::vector<storm::jani::Property> newProperties;
                 if (input.model) {
                     newProperties = storm::api::parsePropertiesForSymbolicModelDescription(ioSettings.getProperty(), input.model.get(), propertyFilter);
@@ -129,6 +135,12 @@ namespace storm {
             }
         }
         
+        bool keepConstantsSymbolic(storm::builder::BuilderType const& builderType) {
+            // The JIT-based builder passes constants to the compiled builder when it is loaded, so they must not be
+            // substituted beforehand.
+            return builderType == storm::builder::BuilderType::Jit && storm::settings::getModule<storm::settings::modules::JitBuilderSettings>().isLoadTimeConstantsSet();
+        }
+        
         SymbolicInput preprocessSymbolicInput(SymbolicInput const& input, storm::builder::BuilderType const& builderType) {
             auto ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
             
@@ -139,13 +151,16 @@ namespace storm {
             std::map<storm::expressions::Variable, storm::expressions::Expression> constantDefinitions;
             if (output.model) {
                 constantDefinitions = output.model.get().parseConstantDefinitions(constantDefinitionString);
-                output.model = output.model.get().preprocess(constantDefinitions);
+                output.model = output.model.get().preprocess(constantDefinitions, !keepConstantsSymbolic(builderType));
             }
             if (!output.properties.empty()) {
                 output.properties = storm::api::substituteConstantsInProperties(output.properties, constantDefinitions);
             }
             
-            ensureNoUndefinedPropertyConstants(output.properties);
+            // When sweeping constants, the properties may refer to the swept constants, which are substituted per sweep point.
+            if (!ioSettings.isConstantsSweepSet()) {
+                ensureNoUndefinedPropertyConstants(output.properties);
+            }
             
             // Check whether conversion for PRISM to JANI is requested or necessary.
             if (input.model && input.model.get().isPrismProgram()) {
@@ -218,7 +233,7 @@ namespace storm {
             
             // Substitute constant definitions
             auto constantDefinitions = input.model.get().parseConstantDefinitions(benchmark.getConstantDefinition(ioSettings.getQvbsInstanceIndex()));
-            input.model = input.model.get().preprocess(constantDefinitions);
+            input.model = input.model.get().preprocess(constantDefinitions, !keepConstantsSymbolic(builderType));
             if (!input.properties.empty()) {
                 input.properties = storm::api::substituteConstantsInProperties(input.properties, constantDefinitions);
             }
@@ -262,8 +277,7 @@ namespace storm {
             return storm::api::buildSymbolicModel<DdType, ValueType>(input.model.get(), createFormulasToRespect(input.properties), storm::settings::getModule<storm::settings::modules::BuildSettings>().isBuildFullModelSet());
         }
         
-        template <typename ValueType>
-        std::shared_ptr<storm::models::ModelBase> buildModelSparse(SymbolicInput const& input, storm::settings::modules::BuildSettings const& buildSettings) {
+        storm::builder::BuilderOptions createSparseBuilderOptions(SymbolicInput const& input, storm::settings::modules::BuildSettings const& buildSettings) {
             storm::builder::BuilderOptions options(createFormulasToRespect(input.properties), input.model.get());
             options.setBuildChoiceLabels(buildSettings.isBuildChoiceLabelsSet());
             options.setBuildStateValuations(buildSettings.isBuildStateValuationsSet());
@@ -280,7 +294,12 @@ namespace storm {
                 options.setBuildAllLabels(true);
                 options.setBuildAllRewardModels(true);
             }
-            return storm::api::buildSparseModel<ValueType>(input.model.get(), options, buildSettings.isJitSet(), storm::settings::getModule<storm::settings::modules::JitBuilderSettings>().isDoctorSet());
+            return options;
+        }
+        
+        template <typename ValueType>
+        std::shared_ptr<storm::models::ModelBase> buildModelSparse(SymbolicInput const& input, storm::settings::modules::BuildSettings const& buildSettings) {
+            return storm::api::buildSparseModel<ValueType>(input.model.get(), createSparseBuilderOptions(input, buildSettings), buildSettings.isJitSet(), storm::settings::getModule<storm::settings::modules::JitBuilderSettings>().isDoctorSet());
         }
         
         template <typename ValueType>
@@ -299,6 +318,7 @@ namespace storm {
         
         template <storm::dd::DdType DdType, typename ValueType>
         std::shared_ptr<storm::models::ModelBase> buildModel(storm::settings::modules::CoreSettings::Engine const& engine, SymbolicInput const& input, storm::settings::modules::IOSettings const& ioSettings) {
+            storm::utility::ProfilerPhase phase("build");
             storm::utility::Stopwatch modelBuildingWatch(true);
 
             auto buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
@@ -342,6 +362,7 @@ namespace storm {
             }
             
             STORM_LOG_INFO("Performing bisimulation minimization...");
+            storm::utility::ProfilerPhase phase("bisimulation");
             return storm::api::performBisimulationMinimization<ValueType>(model, createFormulasToRespect(input.properties), bisimType);
         }
         
@@ -420,6 +441,7 @@ namespace storm {
             STORM_LOG_WARN_COND(!bisimulationSettings.isWeakBisimulationSet(), "Weak bisimulation is currently not supported on DDs. Falling back to strong bisimulation.");
             
             STORM_LOG_INFO("Performing bisimulation minimization...");
+            storm::utility::ProfilerPhase phase("bisimulation");
             return storm::api::performBisimulationMinimization<DdType, ValueType, ExportValueType>(model, createFormulasToRespect(input.properties), storm::storage::BisimulationType::Strong, bisimulationSettings.getSignatureMode());
         }
         
@@ -461,6 +483,7 @@ namespace storm {
         
         template <storm::dd::DdType DdType, typename BuildValueType, typename ExportValueType = BuildValueType>
         std::pair<std::shared_ptr<storm::models::ModelBase>, bool> preprocessModel(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input) {
+            storm::utility::ProfilerPhase phase("preprocess");
             storm::utility::Stopwatch preprocessingWatch(true);
             
             std::pair<std::shared_ptr<storm::models::ModelBase>, bool> result = std::make_pair(model, false);
@@ -635,6 +658,7 @@ namespace storm {
                 storm::utility::Stopwatch watch(true);
                 std::unique_ptr<storm::modelchecker::CheckResult> result;
                 try {
+                    storm::utility::ProfilerPhase phase("check");
                     result = verificationCallback(property.getRawFormula(), property.getFilter().getStatesFormula());
                 } catch (storm::exceptions::BaseException const& ex) {
                     STORM_LOG_WARN("Cannot handle property: " << ex.what());
@@ -759,6 +783,70 @@ namespace storm {
                                         });
         }
         
+        template <typename ValueType>
+        void verifyWithSparseEngineForConstantsSweep(SymbolicInput const& input) {
+            auto ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
+            auto buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
+            STORM_LOG_THROW(input.model, storm::exceptions::InvalidSettingsException, "Sweeping constants requires a symbolic input model.");
+            STORM_LOG_THROW(!buildSettings.isJitSet(), storm::exceptions::NotSupportedException, "Sweeping constants is not supported by the JIT-based model builder.");
+            
+            std::vector<std::string> sweepPoints = storm::utility::cli::parseConstantsSweepString(ioSettings.getConstantsSweepString());
+            
+            storm::builder::IncrementalExplicitModelBuilder<ValueType> builder(input.model.get(), createSparseBuilderOptions(input, buildSettings));
+            auto const& properties = input.preprocessedProperties ? input.preprocessedProperties.get() : input.properties;
+            
+            // The results of the previous sweep point serve as starting values as long as the model structure is unchanged.
+            std::vector<boost::optional<std::vector<ValueType>>> resultHints(properties.size());
+            for (auto const& sweepPoint : sweepPoints) {
+                STORM_PRINT(std::endl << "Checking properties for constants " << sweepPoint << "." << std::endl);
+                std::map<storm::expressions::Variable, storm::expressions::Expression> constantDefinitions = input.model.get().parseConstantDefinitions(sweepPoint);
+                
+                // The properties may refer to the swept constants as well.
+                SymbolicInput sweepInput;
+                sweepInput.properties = storm::api::substituteConstantsInProperties(input.properties, constantDefinitions);
+                if (input.preprocessedProperties) {
+                    sweepInput.preprocessedProperties = storm::api::substituteConstantsInProperties(input.preprocessedProperties.get(), constantDefinitions);
+                }
+                ensureNoUndefinedPropertyConstants(sweepInput.preprocessedProperties ? sweepInput.preprocessedProperties.get() : sweepInput.properties);
+                
+                storm::utility::Stopwatch buildWatch(true);
+                std::shared_ptr<storm::models::sparse::Model<ValueType>> sparseModel = builder.build(constantDefinitions);
+                buildWatch.stop();
+                if (builder.isLastBuildIncremental()) {
+                    STORM_PRINT("Time for updating the model: " << buildWatch << "." << std::endl);
+                } else {
+                    STORM_PRINT("Time for model construction: " << buildWatch << "." << std::endl << std::endl);
+                    sparseModel->printModelInformationToStream(std::cout);
+                    std::fill(resultHints.begin(), resultHints.end(), boost::none);
+                }
+                
+                uint64_t propertyIndex = 0;
+                verifyProperties<ValueType>(sweepInput,
+                                            [&sparseModel,&resultHints,&propertyIndex] (std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states) {
+                                                boost::optional<std::vector<ValueType>>& resultHint = resultHints[propertyIndex++];
+                                                bool filterForInitialStates = states->isInitialFormula();
+                                                auto task = storm::api::createTask<ValueType>(formula, filterForInitialStates);
+                                                std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithSparseEngineUsingResultHint<ValueType>(sparseModel, task, resultHint);
+                                                
+                                                std::unique_ptr<storm::modelchecker::CheckResult> filter;
+                                                if (filterForInitialStates) {
+                                                    filter = std::make_unique<storm::modelchecker::ExplicitQualitativeCheckResult>(sparseModel->getInitialStates());
+                                                } else {
+                                                    filter = storm::api::verifyWithSparseEngine<ValueType>(sparseModel, storm::api::createTask<ValueType>(states, false));
+                                                }
+                                                if (result && filter) {
+                                                    result->filter(filter->asQualitativeCheckResult());
+                                                }
+                                                return result;
+                                            });
+            }
+        }
+        
+        template <>
+        void verifyWithSparseEngineForConstantsSweep<storm::RationalFunction>(SymbolicInput const&) {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Sweeping constants is not supported for parametric models.");
+        }
+        
         template <storm::dd::DdType DdType, typename ValueType>
         void verifyWithHybridEngine(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input) {
             verifyProperties<ValueType>(input, [&model] (std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states) {
@@ -877,6 +965,10 @@ namespace storm {
                 verifyWithAbstractionRefinementEngine<DdType, VerificationValueType>(input);
             } else if (engine == storm::settings::modules::CoreSettings::Engine::Exploration) {
                 verifyWithExplorationEngine<VerificationValueType>(input);
+            } else if (storm::settings::getModule<storm::settings::modules::IOSettings>().isConstantsSweepSet()) {
+                STORM_LOG_THROW(engine == storm::settings::modules::CoreSettings::Engine::Sparse, storm::exceptions::NotSupportedException, "Sweeping constants is only supported by the sparse engine.");
+                STORM_LOG_THROW((std::is_same<BuildValueType, VerificationValueType>::value), storm::exceptions::NotSupportedException, "Sweeping constants requires the model to be built with the value type used for verification.");
+                verifyWithSparseEngineForConstantsSweep<VerificationValueType>(input);
             } else {
                 std::shared_ptr<storm::models::ModelBase> model = buildPreprocessExportModelWithValueTypeAndDdlib<DdType, BuildValueType, VerificationValueType>(input, engine);
 
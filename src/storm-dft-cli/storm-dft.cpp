@@ -190,7 +190,9 @@ void processOptions() {
             approximationError = faultTreeSettings.getApproximationError();
         }
         storm::api::analyzeDFT<ValueType>(*dft, props, faultTreeSettings.useSymmetryReduction(), faultTreeSettings.useModularisation(), relevantEvents,
-                                          faultTreeSettings.isAllowDCForRelevantEvents(), approximationError, faultTreeSettings.getApproximationHeuristic(), true);
+                                          faultTreeSettings.isAllowDCForRelevantEvents(), approximationError, faultTreeSettings.getApproximationHeuristic(), true,
+                                          faultTreeSettings.getNumberOfModuleThreads(), faultTreeSettings.getModuleMemoryBudget(),
+                                          faultTreeSettings.getNumberOfExplorationThreads());
     }
 }
 
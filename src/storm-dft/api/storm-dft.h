@@ -74,14 +74,18 @@ namespace storm {
          * @param approximationError Allowed approximation error.  Value 0 indicates no approximation.
          * @param approximationHeuristic Heuristic used for state space exploration.
          * @param printOutput If true, model information, timings, results, etc. are printed.
+         * @param numberOfModuleThreads Number of threads used for checking independent modules concurrently.
+         * @param moduleMemoryBudget Memory budget (in MB) for checking a single module concurrently. Value 0 indicates no budget.
+         * @param numberOfExplorationThreads Number of threads used for exploring the state space.
          * @return Results.
          */
         template<typename ValueType>
         typename storm::modelchecker::DFTModelChecker<ValueType>::dft_results
         analyzeDFT(storm::storage::DFT<ValueType> const& dft, std::vector<std::shared_ptr<storm::logic::Formula const>> const& properties, bool symred = true,
                    bool allowModularisation = true, std::set<size_t> const& relevantEvents = {}, bool allowDCForRelevantEvents = true, double approximationError = 0.0,
-                   storm::builder::ApproximationHeuristic approximationHeuristic = storm::builder::ApproximationHeuristic::DEPTH, bool printOutput = false) {
-            storm::modelchecker::DFTModelChecker<ValueType> modelChecker(printOutput);
+                   storm::builder::ApproximationHeuristic approximationHeuristic = storm::builder::ApproximationHeuristic::DEPTH, bool printOutput = false,
+                   uint_fast64_t numberOfModuleThreads = 1, uint_fast64_t moduleMemoryBudget = 0, uint_fast64_t numberOfExplorationThreads = 1) {
+            storm::modelchecker::DFTModelChecker<ValueType> modelChecker(printOutput, numberOfModuleThreads, moduleMemoryBudget, numberOfExplorationThreads);
             typename storm::modelchecker::DFTModelChecker<ValueType>::dft_results results = modelChecker.check(dft, properties, symred, allowModularisation, relevantEvents,
                                                                                                                allowDCForRelevantEvents, approximationError,
                                                                                                                approximationHeuristic);
@@ -1,6 +1,9 @@
 #include "ExplicitDFTModelBuilder.h"
 
+#include <atomic>
 #include <map>
+#include <thread>
+#include <type_traits>
 #include <storm/exceptions/IllegalArgumentException.h>
 
 #include "storm/models/sparse/MarkovAutomaton.h"
@@ -31,14 +34,16 @@ namespace storm {
         }
 
         template<typename ValueType, typename StateType>
-        ExplicitDFTModelBuilder<ValueType, StateType>::ExplicitDFTModelBuilder(storm::storage::DFT<ValueType> const& dft, storm::storage::DFTIndependentSymmetries const& symmetries, std::set<size_t> const& relevantEvents, bool allowDCForRelevantEvents) :
+        ExplicitDFTModelBuilder<ValueType, StateType>::ExplicitDFTModelBuilder(storm::storage::DFT<ValueType> const& dft, storm::storage::DFTIndependentSymmetries const& symmetries, std::set<size_t> const& relevantEvents, bool allowDCForRelevantEvents, size_t numberOfThreads) :
                 dft(dft),
                 stateGenerationInfo(std::make_shared<storm::storage::DFTStateGenerationInfo>(dft.buildStateGenerationInfo(symmetries))),
                 relevantEvents(relevantEvents),
+                numberOfThreads(numberOfThreads),
                 generator(dft, *stateGenerationInfo),
                 matrixBuilder(!generator.isDeterministicModel()),
                 stateStorage(dft.stateBitVectorSize()),
-                explorationQueue(1, 0, 0.9, false)
+                explorationQueue(1, 0, 0.9, false),
+                stateArena(dft.stateBitVectorSize())
         {
             // Set relevant events
             this->dft.setRelevantEvents(this->relevantEvents, allowDCForRelevantEvents);
@@ -238,7 +243,7 @@ namespace storm {
             // Push skipped states to explore queue
             // TODO: remove
             for (auto const& skippedState : skippedStates) {
-                statesNotExplored[skippedState.second.first->getId()] = skippedState.second;
+                statesNotExplored[skippedState.second.first.id] = skippedState.second;
                 explorationQueue.push(skippedState.second.second);
             }
 
@@ -268,7 +273,7 @@ namespace storm {
             matrixBuilder.mappingOffset = nrStates;
             STORM_LOG_TRACE("# expanded states: " << nrExpandedStates);
             StateType skippedIndex = nrExpandedStates;
-            std::map<StateType, std::pair<DFTStatePointer, ExplorationHeuristicPointer>> skippedStatesNew;
+            std::map<StateType, std::pair<CompactState, ExplorationHeuristicPointer>> skippedStatesNew;
             for (size_t id = 0; id < matrixBuilder.stateRemapping.size(); ++id) {
                 StateType index = matrixBuilder.getRemapping(id);
                 auto itFind = skippedStates.find(index);
@@ -315,7 +320,7 @@ namespace storm {
                             auto itFind = skippedStates.find(itEntry->getColumn());
                             if (itFind != skippedStates.end()) {
                                 // Set id for skipped states as we remap it later
-                                matrixBuilder.addTransition(matrixBuilder.mappingOffset + itFind->second.first->getId(), itEntry->getValue());
+                                matrixBuilder.addTransition(matrixBuilder.mappingOffset + itFind->second.first.id, itEntry->getValue());
                             } else {
                                 // Set newly remapped index for expanded states
                                 matrixBuilder.addTransition(indexRemapping[itEntry->getColumn()], itEntry->getValue());
@@ -334,6 +339,12 @@ namespace storm {
 
         template<typename ValueType, typename StateType>
         void ExplicitDFTModelBuilder<ValueType, StateType>::exploreStateSpace(double approximationThreshold) {
+            size_t numberOfWorkers = getNumberOfExplorationWorkers();
+            if (numberOfWorkers > 1) {
+                exploreStateSpaceParallel(approximationThreshold, numberOfWorkers);
+                return;
+            }
+
             size_t nrExpandedStates = 0;
             size_t nrSkippedStates = 0;
             storm::utility::ProgressMeasurement progress("explored states");
@@ -341,118 +352,135 @@ namespace storm {
             // TODO: do not empty queue every time but break before
             while (!explorationQueue.empty()) {
                 // Get the first state in the queue
-                ExplorationHeuristicPointer currentExplorationHeuristic = explorationQueue.pop();
-                StateType currentId = currentExplorationHeuristic->getId();
-                auto itFind = statesNotExplored.find(currentId);
-                STORM_LOG_ASSERT(itFind != statesNotExplored.end(), "Id " << currentId << " not found");
-                DFTStatePointer currentState = itFind->second.first;
-                STORM_LOG_ASSERT(currentExplorationHeuristic == itFind->second.second, "Exploration heuristics do not match");
-                STORM_LOG_ASSERT(currentState->getId() == currentId, "Ids do not match");
-                // Remove it from the list of not explored states
-                statesNotExplored.erase(itFind);
-                STORM_LOG_ASSERT(stateStorage.stateToId.contains(currentState->status()), "State is not contained in state storage.");
-                STORM_LOG_ASSERT(stateStorage.stateToId.getValue(currentState->status()) == currentId, "Ids of states do not coincide.");
-
-                // Get concrete state if necessary
-                if (currentState->isPseudoState()) {
-                    // Create concrete state from pseudo state
-                    currentState->construct();
-                }
-                STORM_LOG_ASSERT(!currentState->isPseudoState(), "State is pseudo state.");
+                std::pair<CompactState, ExplorationHeuristicPointer> next = popNextState();
+                CompactState const& currentState = next.first;
+                ExplorationHeuristicPointer const& currentExplorationHeuristic = next.second;
 
                 // Remember that the current row group was actually filled with the transitions of a different state
-                matrixBuilder.setRemapping(currentId);
+                matrixBuilder.setRemapping(currentState.id);
 
                 matrixBuilder.newRowGroup();
 
-                // Try to explore the next state
-                generator.load(currentState);
-
                 //if (approximationThreshold > 0.0 && nrExpandedStates > approximationThreshold && !currentExplorationHeuristic->isExpand()) {
                 if (approximationThreshold > 0.0 && currentExplorationHeuristic->isSkip(approximationThreshold)) {
                     // Skip the current state
                     ++nrSkippedStates;
-                    STORM_LOG_TRACE("Skip expansion of state: " << dft.getStateString(currentState));
-                    setMarkovian(true);
-                    // Add transition to target state with temporary value 0
-                    // TODO: what to do when there is no unique target state?
-                    STORM_LOG_ASSERT(this->uniqueFailedState, "Approximation only works with unique failed state");
-                    matrixBuilder.addTransition(0, storm::utility::zero<ValueType>());
-                    // Remember skipped state
-                    skippedStates[matrixBuilder.getCurrentRowGroup() - 1] = std::make_pair(currentState, currentExplorationHeuristic);
-                    matrixBuilder.finishRow();
+                    skipState(currentState, currentExplorationHeuristic);
                 } else {
                     // Explore the current state
                     ++nrExpandedStates;
+                    // Reconstruct the concrete state; afterwards only the state storage keeps its status
+                    generator.load(stateArena.get(currentState.slot), currentState.id);
+                    stateArena.release(currentState.slot);
                     storm::generator::StateBehavior<ValueType, StateType> behavior = generator.expand(std::bind(&ExplicitDFTModelBuilder::getOrAddStateIndex, this, std::placeholders::_1));
-                    STORM_LOG_ASSERT(!behavior.empty(), "Behavior is empty.");
-                    setMarkovian(behavior.begin()->isMarkovian());
+                    addBehavior(behavior, *currentExplorationHeuristic);
+                }
+                // Output number of currently explored states
+                if (nrExpandedStates % 100 == 0) {
+                    progress.updateProgress(nrExpandedStates);
+                }
+            } // end exploration
+
+            STORM_LOG_INFO("Expanded " << nrExpandedStates << " states");
+            STORM_LOG_INFO("Skipped " << nrSkippedStates << " states");
+            STORM_LOG_ASSERT(nrSkippedStates == skippedStates.size(), "Nr skipped states is wrong");
+        }
 
-                    // Now add all choices.
-                    for (auto const& choice : behavior) {
-                        // Add the probabilistic behavior to the matrix.
-                        for (auto const& stateProbabilityPair : choice) {
-                            STORM_LOG_ASSERT(!storm::utility::isZero(stateProbabilityPair.second), "Probability zero.");
-                            // Set transition to state id + offset. This helps in only remapping all previously skipped states.
-                            matrixBuilder.addTransition(matrixBuilder.mappingOffset + stateProbabilityPair.first, stateProbabilityPair.second);
-                            // Set heuristic values for reached states
-                            auto iter = statesNotExplored.find(stateProbabilityPair.first);
-                            if (iter != statesNotExplored.end()) {
-                                // Update heuristic values
-                                DFTStatePointer state = iter->second.first;
-                                if (!iter->second.second) {
-                                    // Initialize heuristic values
-                                    ExplorationHeuristicPointer heuristic;
-                                    switch (usedHeuristic) {
-                                        case storm::builder::ApproximationHeuristic::DEPTH:
-                                            heuristic = std::make_shared<DFTExplorationHeuristicDepth<ValueType>>(stateProbabilityPair.first, *currentExplorationHeuristic, stateProbabilityPair.second, choice.getTotalMass());
-                                            break;
-                                        case storm::builder::ApproximationHeuristic::PROBABILITY:
-                                            heuristic = std::make_shared<DFTExplorationHeuristicProbability<ValueType>>(stateProbabilityPair.first, *currentExplorationHeuristic, stateProbabilityPair.second, choice.getTotalMass());
-                                            break;
-                                        case storm::builder::ApproximationHeuristic::BOUNDDIFFERENCE:
-                                            heuristic = std::make_shared<DFTExplorationHeuristicBoundDifference<ValueType>>(stateProbabilityPair.first, *currentExplorationHeuristic, stateProbabilityPair.second, choice.getTotalMass());
-                                            break;
-                                        default:
-                                            STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentException, "Heuristic not known.");
-                                    }
-
-                                    iter->second.second = heuristic;
-                                    if (state->hasFailed(dft.getTopLevelIndex()) || state->isFailsafe(dft.getTopLevelIndex()) || state->getFailableElements().hasDependencies() || (!state->getFailableElements().hasDependencies() && !state->getFailableElements().hasBEs())) {
-                                        // Do not skip absorbing state or if reached by dependencies
-                                        iter->second.second->markExpand();
-                                    }
-                                    if (usedHeuristic == storm::builder::ApproximationHeuristic::BOUNDDIFFERENCE) {
-                                        // Compute bounds for heuristic now
-                                        if (state->isPseudoState()) {
-                                            // Create concrete state from pseudo state
-                                            state->construct();
-                                        }
-                                        STORM_LOG_ASSERT(!currentState->isPseudoState(), "State is pseudo state.");
-
-                                        // Initialize bounds
-                                        // TODO: avoid hack
-                                        ValueType lowerBound = getLowerBound(state);
-                                        ValueType upperBound = getUpperBound(state);
-                                        heuristic->setBounds(lowerBound, upperBound);
-                                    }
-
-                                    explorationQueue.push(heuristic);
-                                } else if (!iter->second.second->isExpand()) {
-                                    double oldPriority = iter->second.second->getPriority();
-                                    if (iter->second.second->updateHeuristicValues(*currentExplorationHeuristic, stateProbabilityPair.second, choice.getTotalMass())) {
-                                        // Update priority queue
-                                        explorationQueue.update(iter->second.second, oldPriority);
-                                    }
+        template<typename ValueType, typename StateType>
+        void ExplicitDFTModelBuilder<ValueType, StateType>::exploreStateSpaceParallel(double approximationThreshold, size_t numberOfWorkers) {
+            size_t nrExpandedStates = 0;
+            size_t nrSkippedStates = 0;
+            storm::utility::ProgressMeasurement progress("explored states");
+            progress.startNewMeasurement(0);
+            STORM_LOG_DEBUG("Exploring state space with " << numberOfWorkers << " threads.");
+
+            // Each worker uses its own generator
+            std::vector<storm::generator::DftNextStateGenerator<ValueType, StateType>> workerGenerators(numberOfWorkers, generator);
+            std::vector<ExpansionTask> batch;
+            while (!explorationQueue.empty()) {
+                // Get the next batch of states in the queue
+                // The batch only depends on the queue and not on the number of workers
+                batch.clear();
+                while (!explorationQueue.empty() && batch.size() < EXPLORATION_BATCH_SIZE) {
+                    ExpansionTask task;
+                    std::tie(task.state, task.heuristic) = popNextState();
+                    task.skip = approximationThreshold > 0.0 && task.heuristic->isSkip(approximationThreshold);
+                    batch.push_back(std::move(task));
+                }
+
+                // Expand the states concurrently
+                // As ids can only be assigned in a deterministic order after all expansions, the successors are only recorded
+                std::atomic<size_t> nextTask(0);
+                auto expandTasks = [&](storm::generator::DftNextStateGenerator<ValueType, StateType>& workerGenerator) {
+                    for (size_t index = nextTask++; index < batch.size(); index = nextTask++) {
+                        ExpansionTask& task = batch[index];
+                        if (task.skip) {
+                            continue;
+                        }
+                        try {
+                            workerGenerator.load(stateArena.get(task.state.slot), task.state.id);
+                            task.behavior = workerGenerator.expand([this, &task](DFTStatePointer const& state) {
+                                task.successors.push_back(state);
+                                return static_cast<StateType>(OFFSET_PSEUDO_STATE + task.successors.size() - 1);
+                            });
+                        } catch (...) {
+                            task.exception = std::current_exception();
+                        }
+                    }
+                };
+                size_t numberOfBatchWorkers = std::min(numberOfWorkers, batch.size());
+                std::vector<std::thread> workers;
+                for (size_t worker = 1; worker < numberOfBatchWorkers; ++worker) {
+                    workers.emplace_back(expandTasks, std::ref(workerGenerators[worker]));
+                }
+                expandTasks(workerGenerators[0]);
+                for (auto& worker : workers) {
+                    worker.join();
+                }
+
+                // Add the states to the matrix in the order of the batch
+                for (ExpansionTask& task : batch) {
+                    if (task.exception) {
+                        std::rethrow_exception(task.exception);
+                    }
+                    // Remember that the current row group was actually filled with the transitions of a different state
+                    matrixBuilder.setRemapping(task.state.id);
+
+                    matrixBuilder.newRowGroup();
+
+                    if (task.skip) {
+                        // Skip the current state
+                        ++nrSkippedStates;
+                        skipState(task.state, task.heuristic);
+                    } else {
+                        ++nrExpandedStates;
+                        stateArena.release(task.state.slot);
+                        // Register the successors in the order in which they were reached, as in the sequential exploration
+                        std::vector<StateType> successorIds;
+                        successorIds.reserve(task.successors.size());
+                        for (DFTStatePointer const& successor : task.successors) {
+                            successorIds.push_back(getOrAddStateIndex(successor));
+                        }
+                        // Replace the recorded successors by their ids
+                        storm::generator::StateBehavior<ValueType, StateType> behavior;
+                        for (auto const& choice : task.behavior) {
+                            storm::generator::Choice<ValueType, StateType> newChoice(choice.getActionIndex(), choice.isMarkovian());
+                            for (auto const& stateProbabilityPair : choice) {
+                                StateType id = stateProbabilityPair.first;
+                                if (id >= OFFSET_PSEUDO_STATE) {
+                                    id = successorIds[id - OFFSET_PSEUDO_STATE];
                                 }
+                                newChoice.addProbability(id, stateProbabilityPair.second);
                             }
+                            behavior.addChoice(std::move(newChoice));
                         }
-                        matrixBuilder.finishRow();
+                        behavior.setExpanded();
+                        addBehavior(behavior, *task.heuristic);
+                    }
+                    // Output number of currently explored states
+                    if (nrExpandedStates % 100 == 0) {
+                        progress.updateProgress(nrExpandedStates);
                     }
-                }
-                // Output number of currently explored states
-                if (nrExpandedStates % 100 == 0) {
-                    progress.updateProgress(nrExpandedStates);
                 }
             } // end exploration
 
@@ -461,6 +489,108 @@ namespace storm {
             STORM_LOG_ASSERT(nrSkippedStates == skippedStates.size(), "Nr skipped states is wrong");
         }
 
+        template<typename ValueType, typename StateType>
+        size_t ExplicitDFTModelBuilder<ValueType, StateType>::getNumberOfExplorationWorkers() const {
+            if (!std::is_same<ValueType, double>::value) {
+                STORM_LOG_WARN_COND(numberOfThreads <= 1, "Parallel exploration is only supported for double. Exploring state space sequentially.");
+                // The caches of the rational function library are not thread-safe
+                return 1;
+            }
+            return std::max<size_t>(1, numberOfThreads);
+        }
+
+        template<typename ValueType, typename StateType>
+        std::pair<typename ExplicitDFTModelBuilder<ValueType, StateType>::CompactState, typename ExplicitDFTModelBuilder<ValueType, StateType>::ExplorationHeuristicPointer> ExplicitDFTModelBuilder<ValueType, StateType>::popNextState() {
+            ExplorationHeuristicPointer currentExplorationHeuristic = explorationQueue.pop();
+            StateType currentId = currentExplorationHeuristic->getId();
+            auto itFind = statesNotExplored.find(currentId);
+            STORM_LOG_ASSERT(itFind != statesNotExplored.end(), "Id " << currentId << " not found");
+            CompactState currentState = itFind->second.first;
+            STORM_LOG_ASSERT(currentExplorationHeuristic == itFind->second.second, "Exploration heuristics do not match");
+            STORM_LOG_ASSERT(currentState.id == currentId, "Ids do not match");
+            // Remove it from the list of not explored states
+            statesNotExplored.erase(itFind);
+            STORM_LOG_ASSERT(stateStorage.stateToId.contains(stateArena.get(currentState.slot)), "State is not contained in state storage.");
+            STORM_LOG_ASSERT(stateStorage.stateToId.getValue(stateArena.get(currentState.slot)) == currentId, "Ids of states do not coincide.");
+            return std::make_pair(currentState, currentExplorationHeuristic);
+        }
+
+        template<typename ValueType, typename StateType>
+        void ExplicitDFTModelBuilder<ValueType, StateType>::skipState(CompactState const& state, ExplorationHeuristicPointer const& heuristic) {
+            STORM_LOG_TRACE("Skip expansion of state: " << dft.getStateString(stateArena.get(state.slot), *stateGenerationInfo, state.id));
+            setMarkovian(true);
+            // Add transition to target state with temporary value 0
+            // TODO: what to do when there is no unique target state?
+            STORM_LOG_ASSERT(this->uniqueFailedState, "Approximation only works with unique failed state");
+            matrixBuilder.addTransition(0, storm::utility::zero<ValueType>());
+            // Remember skipped state
+            skippedStates[matrixBuilder.getCurrentRowGroup() - 1] = std::make_pair(state, heuristic);
+            matrixBuilder.finishRow();
+        }
+
+        template<typename ValueType, typename StateType>
+        void ExplicitDFTModelBuilder<ValueType, StateType>::addBehavior(storm::generator::StateBehavior<ValueType, StateType> const& behavior, ExplorationHeuristic const& currentExplorationHeuristic) {
+            STORM_LOG_ASSERT(!behavior.empty(), "Behavior is empty.");
+            setMarkovian(behavior.begin()->isMarkovian());
+
+            // Now add all choices.
+            for (auto const& choice : behavior) {
+                // Add the probabilistic behavior to the matrix.
+                for (auto const& stateProbabilityPair : choice) {
+                    STORM_LOG_ASSERT(!storm::utility::isZero(stateProbabilityPair.second), "Probability zero.");
+                    // Set transition to state id + offset. This helps in only remapping all previously skipped states.
+                    matrixBuilder.addTransition(matrixBuilder.mappingOffset + stateProbabilityPair.first, stateProbabilityPair.second);
+                    // Set heuristic values for reached states
+                    auto iter = statesNotExplored.find(stateProbabilityPair.first);
+                    if (iter != statesNotExplored.end()) {
+                        // Update heuristic values
+                        if (!iter->second.second) {
+                            // Initialize heuristic values
+                            ExplorationHeuristicPointer heuristic;
+                            switch (usedHeuristic) {
+                                case storm::builder::ApproximationHeuristic::DEPTH:
+                                    heuristic = std::make_shared<DFTExplorationHeuristicDepth<ValueType>>(stateProbabilityPair.first, currentExplorationHeuristic, stateProbabilityPair.second, choice.getTotalMass());
+                                    break;
+                                case storm::builder::ApproximationHeuristic::PROBABILITY:
+                                    heuristic = std::make_shared<DFTExplorationHeuristicProbability<ValueType>>(stateProbabilityPair.first, currentExplorationHeuristic, stateProbabilityPair.second, choice.getTotalMass());
+                                    break;
+                                case storm::builder::ApproximationHeuristic::BOUNDDIFFERENCE:
+                                    heuristic = std::make_shared<DFTExplorationHeuristicBoundDifference<ValueType>>(stateProbabilityPair.first, currentExplorationHeuristic, stateProbabilityPair.second, choice.getTotalMass());
+                                    break;
+                                default:
+                                    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentException, "Heuristic not known.");
+                            }
+
+                            iter->second.second = heuristic;
+                            if (iter->second.first.mustExpand) {
+                                // Do not skip absorbing state or if reached by dependencies
+                                iter->second.second->markExpand();
+                            }
+                            if (usedHeuristic == storm::builder::ApproximationHeuristic::BOUNDDIFFERENCE) {
+                                // Compute bounds for heuristic now
+                                DFTStatePointer state = reconstructState(iter->second.first);
+
+                                // Initialize bounds
+                                // TODO: avoid hack
+                                ValueType lowerBound = getLowerBound(state);
+                                ValueType upperBound = getUpperBound(state);
+                                heuristic->setBounds(lowerBound, upperBound);
+                            }
+
+                            explorationQueue.push(heuristic);
+                        } else if (!iter->second.second->isExpand()) {
+                            double oldPriority = iter->second.second->getPriority();
+                            if (iter->second.second->updateHeuristicValues(currentExplorationHeuristic, stateProbabilityPair.second, choice.getTotalMass())) {
+                                // Update priority queue
+                                explorationQueue.update(iter->second.second, oldPriority);
+                            }
+                        }
+                    }
+                }
+                matrixBuilder.finishRow();
+            }
+        }
+
         template<typename ValueType, typename StateType>
         void ExplicitDFTModelBuilder<ValueType, StateType>::buildLabeling() {
             // Build state labeling
@@ -539,7 +669,6 @@ namespace storm {
                     for (auto it = skippedStates.begin(); it != skippedStates.end(); ++it) {
                         auto matrixEntry = matrix.getRow(it->first, 0).begin();
                         STORM_LOG_ASSERT(matrixEntry->getColumn() == 0, "Transition has wrong target state.");
-                        STORM_LOG_ASSERT(!it->second.first->isPseudoState(), "State is still pseudo state.");
                         matrixEntry->setValue(storm::utility::one<ValueType>());
                         matrixEntry->setColumn(it->first);
                     }
@@ -657,13 +786,13 @@ namespace storm {
             for (auto it = skippedStates.begin(); it != skippedStates.end(); ++it) {
                 auto matrixEntry = matrix.getRow(it->first, 0).begin();
                 STORM_LOG_ASSERT(matrixEntry->getColumn() == 0, "Transition has wrong target state.");
-                STORM_LOG_ASSERT(!it->second.first->isPseudoState(), "State is still pseudo state.");
 
                 ExplorationHeuristicPointer heuristic = it->second.second;
                 if (storm::utility::isInfinity(heuristic->getUpperBound())) {
                     // Initialize bounds
-                    ValueType lowerBound = getLowerBound(it->second.first);
-                    ValueType upperBound = getUpperBound(it->second.first);
+                    DFTStatePointer state = reconstructState(it->second.first);
+                    ValueType lowerBound = getLowerBound(state);
+                    ValueType upperBound = getUpperBound(state);
                     heuristic->setBounds(lowerBound, upperBound);
                 }
 
@@ -837,19 +966,12 @@ namespace storm {
                 stateId = stateStorage.stateToId.getValue(state->status());
                 STORM_LOG_TRACE("State " << dft.getStateString(state) << " with id " << stateId << " already exists");
                 if (!changed) {
-                    // Check if state is pseudo state
-                    // If state is explored already the possible pseudo state was already constructed
+                    // The state might have been reached as pseudo state before
+                    // Update the information for the not yet explored state according to the concrete state
                     auto iter = statesNotExplored.find(stateId);
-                    if (iter != statesNotExplored.end() && iter->second.first->isPseudoState()) {
-                        // Create pseudo state now
-                        STORM_LOG_ASSERT(iter->second.first->getId() == stateId, "Ids do not match.");
-                        STORM_LOG_ASSERT(iter->second.first->status() == state->status(), "Pseudo states do not coincide.");
-                        state->setId(stateId);
-                        // Update mapping to map to concrete state now
-                        // TODO: just change pointer?
-                        statesNotExplored[stateId] = std::make_pair(state, iter->second.second);
-                        // We do not push the new state on the exploration queue as the pseudo state was already pushed
-                        STORM_LOG_TRACE("Created pseudo state " << dft.getStateString(state));
+                    if (iter != statesNotExplored.end() && !iter->second.second) {
+                        STORM_LOG_ASSERT(iter->second.first.id == stateId, "Ids do not match.");
+                        iter->second.first.mustExpand = isExpansionRequired(state);
                     }
                 }
             } else {
@@ -860,8 +982,10 @@ namespace storm {
                 stateId = stateStorage.stateToId.findOrAdd(state->status(), state->getId());
                 STORM_LOG_ASSERT(stateId == state->getId(), "Ids do not match.");
                 // Insert state as not yet explored
+                // Only the status is stored, the state object itself is discarded
+                CompactState compactState = {stateId, stateArena.store(state->status()), isExpansionRequired(state)};
                 ExplorationHeuristicPointer nullHeuristic;
-                statesNotExplored[stateId] = std::make_pair(state, nullHeuristic);
+                statesNotExplored[stateId] = std::make_pair(compactState, nullHeuristic);
                 // Reserve one slot for the new state in the remapping
                 matrixBuilder.stateRemapping.push_back(0);
                 STORM_LOG_TRACE("New " << (state->isPseudoState() ? "pseudo" : "concrete") << " state: " << dft.getStateString(state));
@@ -869,6 +993,16 @@ namespace storm {
             return stateId;
         }
 
+        template<typename ValueType, typename StateType>
+        bool ExplicitDFTModelBuilder<ValueType, StateType>::isExpansionRequired(DFTStatePointer const& state) const {
+            return state->hasFailed(dft.getTopLevelIndex()) || state->isFailsafe(dft.getTopLevelIndex()) || state->getFailableElements().hasDependencies() || (!state->getFailableElements().hasDependencies() && !state->getFailableElements().hasBEs());
+        }
+
+        template<typename ValueType, typename StateType>
+        typename ExplicitDFTModelBuilder<ValueType, StateType>::DFTStatePointer ExplicitDFTModelBuilder<ValueType, StateType>::reconstructState(CompactState const& state) const {
+            return generator.createState(stateArena.get(state.slot), state.id);
+        }
+
         template<typename ValueType, typename StateType>
         void ExplicitDFTModelBuilder<ValueType, StateType>::setMarkovian(bool markovian) {
             if (matrixBuilder.getCurrentRowGroup() > modelComponents.markovianStates.size()) {
@@ -882,7 +1016,7 @@ namespace storm {
         void ExplicitDFTModelBuilder<ValueType, StateType>::printNotExplored() const {
             std::cout << "states not explored:" << std::endl;
             for (auto it : statesNotExplored) {
-                std::cout << it.first << " -> " << dft.getStateString(it.second.first) << std::endl;
+                std::cout << it.first << " -> " << dft.getStateString(stateArena.get(it.second.first.slot), *stateGenerationInfo, it.first) << std::endl;
             }
         }
 
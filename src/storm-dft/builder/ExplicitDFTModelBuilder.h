@@ -2,6 +2,7 @@
 
 #include <boost/container/flat_set.hpp>
 #include <boost/optional/optional.hpp>
+#include <exception>
 #include <stack>
 #include <unordered_set>
 #include <limits>
@@ -18,6 +19,7 @@
 #include "storm-dft/storage/dft/DFT.h"
 #include "storm-dft/storage/dft/SymmetricUnits.h"
 #include "storm-dft/storage/BucketPriorityQueue.h"
+#include "storm-dft/storage/DFTStateArena.h"
 
 namespace storm {
     namespace builder {
@@ -33,6 +35,41 @@ namespace storm {
             using ExplorationHeuristicPointer = std::shared_ptr<ExplorationHeuristic>;
 
 
+            // Compact representation of a state which is not yet expanded.
+            // Only the status of the state is kept (in the state arena), all other information is reconstructed from
+            // the status when the state is expanded.
+            struct CompactState {
+                // Id of the state.
+                StateType id;
+
+                // Slot of the status in the state arena.
+                uint64_t slot;
+
+                // Flag indicating if the state must be expanded regardless of the approximation.
+                bool mustExpand;
+            };
+
+            // A state which is expanded by a worker thread during parallel exploration.
+            struct ExpansionTask {
+                // The state to expand.
+                CompactState state;
+
+                // The heuristic values of the state.
+                ExplorationHeuristicPointer heuristic;
+
+                // Flag indicating if the expansion of the state is skipped.
+                bool skip;
+
+                // The behavior of the state. Successor states are referred to by OFFSET_PSEUDO_STATE + their index in successors.
+                storm::generator::StateBehavior<ValueType, StateType> behavior;
+
+                // The successor states in the order in which they were reached.
+                std::vector<DFTStatePointer> successors;
+
+                // Exception raised during the expansion (if any).
+                std::exception_ptr exception;
+            };
+
             // A structure holding the individual components of a model.
             struct ModelComponents {
                 // Constructor
@@ -158,8 +195,9 @@ namespace storm {
              * @param symmetries Symmetries in the dft.
              * @param relevantEvents List with ids of relevant events which should be observed.
              * @param allowDCForRelevantEvents If true, Don't Care propagation is allowed even for relevant events.
+             * @param numberOfThreads Number of threads used for exploring the state space. Values <= 1 disable parallel exploration.
              */
-            ExplicitDFTModelBuilder(storm::storage::DFT<ValueType> const& dft, storm::storage::DFTIndependentSymmetries const& symmetries, std::set<size_t> const& relevantEvents, bool allowDCForRelevantEvents);
+            ExplicitDFTModelBuilder(storm::storage::DFT<ValueType> const& dft, storm::storage::DFTIndependentSymmetries const& symmetries, std::set<size_t> const& relevantEvents, bool allowDCForRelevantEvents, size_t numberOfThreads = 1);
 
             /*!
              * Build model from DFT.
@@ -196,6 +234,54 @@ namespace storm {
              */
             void exploreStateSpace(double approximationThreshold);
 
+            /*!
+             * Explore state space of DFT with multiple threads.
+             * States are taken from the exploration queue in batches of fixed size and the states of a batch are
+             * expanded concurrently. Afterwards, the reached states are registered in the order of the batch. Thus,
+             * the numbering of the states is the same for any number (> 1) of threads and any scheduling.
+             * It may however differ from the numbering of the sequential exploration (which is used for a single
+             * thread), as the states reached from a batch only enter the exploration queue after the whole batch was
+             * taken from it. Without approximation, both explorations yield the same states and transitions up to the
+             * numbering. With approximation, the states to skip are chosen when a batch is formed, so the explored
+             * parts may differ as well.
+             *
+             * @param approximationThreshold Threshold to determine when to skip states.
+             * @param numberOfWorkers Number of worker threads.
+             */
+            void exploreStateSpaceParallel(double approximationThreshold, size_t numberOfWorkers);
+
+            /*!
+             * Get the number of threads used for exploring the state space.
+             *
+             * @return Number of threads (1 if the state space is explored sequentially).
+             */
+            size_t getNumberOfExplorationWorkers() const;
+
+            /*!
+             * Take the next state from the exploration queue and remove it from the not yet explored states.
+             *
+             * @return Pair of the state and its heuristic values.
+             */
+            std::pair<CompactState, ExplorationHeuristicPointer> popNextState();
+
+            /*!
+             * Skip the expansion of the given state and add a temporary transition to the failed state.
+             * The row group of the state must already be created.
+             *
+             * @param state The state to skip.
+             * @param heuristic The heuristic values of the state.
+             */
+            void skipState(CompactState const& state, ExplorationHeuristicPointer const& heuristic);
+
+            /*!
+             * Add the behavior of the expanded state to the matrix and set the heuristic values of the reached states.
+             * The row group of the state must already be created.
+             *
+             * @param behavior The behavior of the expanded state.
+             * @param currentExplorationHeuristic The heuristic values of the expanded state.
+             */
+            void addBehavior(storm::generator::StateBehavior<ValueType, StateType> const& behavior, ExplorationHeuristic const& currentExplorationHeuristic);
+
             /*!
              * Initialize the matrix for a refinement iteration.
              */
@@ -215,6 +301,25 @@ namespace storm {
              */
             StateType getOrAddStateIndex(DFTStatePointer const& state);
 
+            /*!
+             * Check whether the given state must be expanded regardless of the approximation.
+             * This is the case for absorbing states and states reached by dependencies.
+             *
+             * @param state The state.
+             *
+             * @return True iff the state must not be skipped.
+             */
+            bool isExpansionRequired(DFTStatePointer const& state) const;
+
+            /*!
+             * Reconstruct the concrete state from its compact representation.
+             *
+             * @param state The compact state.
+             *
+             * @return Concrete state.
+             */
+            DFTStatePointer reconstructState(CompactState const& state) const;
+
             /*!
              * Set markovian flag for the current state.
              *
@@ -282,8 +387,10 @@ namespace storm {
 
             // Initial size of the bitvector.
             const size_t INITIAL_BITVECTOR_SIZE = 20000;
-            // Offset used for pseudo states.
+            // Offset used for pseudo states, i.e., successor states which are not yet registered during parallel exploration.
             const StateType OFFSET_PSEUDO_STATE = std::numeric_limits<StateType>::max() / 2;
+            // Number of states which are expanded together during parallel exploration.
+            const size_t EXPLORATION_BATCH_SIZE = 1024;
 
             // Dft
             storm::storage::DFT<ValueType> const& dft;
@@ -298,6 +405,9 @@ namespace storm {
             // Heuristic used for approximation
             storm::builder::ApproximationHeuristic usedHeuristic;
 
+            // Number of threads for exploring the state space
+            size_t numberOfThreads;
+
             // Current id for new state
             size_t newIndex = 0;
 
@@ -323,14 +433,17 @@ namespace storm {
             // A priority queue of states that still need to be explored.
             storm::storage::BucketPriorityQueue<ExplorationHeuristic> explorationQueue;
 
-            // A mapping of not yet explored states from the id to the tuple (state object, heuristic values).
-            std::map<StateType, std::pair<DFTStatePointer, ExplorationHeuristicPointer>> statesNotExplored;
+            // Arena holding the status of all states which are not yet expanded.
+            storm::storage::DFTStateArena stateArena;
+
+            // A mapping of not yet explored states from the id to the tuple (compact state, heuristic values).
+            std::map<StateType, std::pair<CompactState, ExplorationHeuristicPointer>> statesNotExplored;
 
             // Holds all skipped states which were not yet expanded. More concretely it is a mapping from matrix indices
             // to the corresponding skipped states.
             // Notice that we need an ordered map here to easily iterate in increasing order over state ids.
             // TODO remove again
-            std::map<StateType, std::pair<DFTStatePointer, ExplorationHeuristicPointer>> skippedStates;
+            std::map<StateType, std::pair<CompactState, ExplorationHeuristicPointer>> skippedStates;
 
             // List of independent subtrees and the BEs contained in them.
             std::vector<std::vector<size_t>> subtreeBEs;
@@ -43,6 +43,18 @@ namespace storm {
             this->state = state;
         }
 
+        template<typename ValueType, typename StateType>
+        void DftNextStateGenerator<ValueType, StateType>::load(storm::storage::BitVector const& status, StateType id) {
+            this->state = createState(status, id);
+        }
+
+        template<typename ValueType, typename StateType>
+        typename DftNextStateGenerator<ValueType, StateType>::DFTStatePointer DftNextStateGenerator<ValueType, StateType>::createState(storm::storage::BitVector const& status, StateType id) const {
+            DFTStatePointer newState = std::make_shared<storm::storage::DFTState<ValueType>>(status, mDft, mStateGenerationInfo, id);
+            newState->construct();
+            return newState;
+        }
+
         template<typename ValueType, typename StateType>
         StateBehavior<ValueType, StateType> DftNextStateGenerator<ValueType, StateType>::expand(StateToIdCallback const& stateToIdCallback) {
             STORM_LOG_DEBUG("Explore state: " << mDft.getStateString(state));
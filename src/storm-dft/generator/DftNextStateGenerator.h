@@ -31,6 +31,27 @@ namespace storm {
 
             void load(storm::storage::BitVector const& state);
             void load(DFTStatePointer const& state);
+
+            /*!
+             * Load the concrete state with the given status and id.
+             * The information which is not part of the status (failable elements, used representants) is reconstructed.
+             *
+             * @param status Status of the state.
+             * @param id Id of the state.
+             */
+            void load(storm::storage::BitVector const& status, StateType id);
+
+            /*!
+             * Create the concrete state with the given status and id.
+             * The information which is not part of the status (failable elements, used representants) is reconstructed.
+             *
+             * @param status Status of the state.
+             * @param id Id of the state.
+             *
+             * @return Concrete state.
+             */
+            DFTStatePointer createState(storm::storage::BitVector const& status, StateType id) const;
+
             StateBehavior<ValueType, StateType> expand(StateToIdCallback const& stateToIdCallback);
 
             /*!
@@ -1,10 +1,16 @@
 #include "DFTModelChecker.h"
 
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+
 #include "storm/settings/modules/IOSettings.h"
 #include "storm/settings/modules/GeneralSettings.h"
 #include "storm/builder/ParallelCompositionBuilder.h"
 #include "storm/utility/bitoperations.h"
 #include "storm/utility/DirectEncodingExporter.h"
+#include "storm/utility/resources.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 
@@ -89,51 +95,57 @@ namespace storm {
             // Perform modularisation
             if(dfts.size() > 1) {
                 STORM_LOG_TRACE("Recursive CHECK Call");
-                // TODO: compute simultaneously
-                dft_results results;
+                property_vector probabilityProperties;
                 for (auto property : properties) {
                     if (!property->isProbabilityOperatorFormula()) {
                         STORM_LOG_WARN("Could not check property: " << *property);
                     } else {
-                        // Recursively call model checking
-                        std::vector<ValueType> res;
-                        for(auto const ft : dfts) {
-                            // TODO: allow approximation in modularisation
-                            dft_results ftResults = checkHelper(ft, {property}, symred, true, relevantEvents, allowDCForRelevantEvents, 0.0);
-                            STORM_LOG_ASSERT(ftResults.size() == 1, "Wrong number of results");
-                            res.push_back(boost::get<ValueType>(ftResults[0]));
-                        }
+                        probabilityProperties.push_back(property);
+                    }
+                }
+
+                // Recursively call model checking
+                std::vector<std::vector<ValueType>> moduleResults;
+                if (!probabilityProperties.empty()) {
+                    moduleResults = checkModules(dfts, probabilityProperties, symred, relevantEvents, allowDCForRelevantEvents);
+                }
+
+                dft_results results;
+                for (size_t propertyIndex = 0; propertyIndex < probabilityProperties.size(); ++propertyIndex) {
+                    std::vector<ValueType> res;
+                    for (auto const& moduleResult : moduleResults) {
+                        res.push_back(moduleResult[propertyIndex]);
+                    }
 
-                        // Combine modularisation results
-                        STORM_LOG_TRACE("Combining all results... K=" << nrK << "; M=" << nrM << "; invResults=" << (invResults?"On":"Off"));
-                        ValueType result = storm::utility::zero<ValueType>();
-                        int limK = invResults ? -1 : nrM+1;
-                        int chK = invResults ? -1 : 1;
-                        // WARNING: there is a bug for computing permutations with more than 32 elements
-                        STORM_LOG_THROW(res.size() < 32, storm::exceptions::NotSupportedException, "Permutations work only for < 32 elements");
-                        for(int cK = nrK; cK != limK; cK += chK ) {
-                            STORM_LOG_ASSERT(cK >= 0, "ck negative.");
-                            size_t permutation = smallestIntWithNBitsSet(static_cast<size_t>(cK));
-                            do {
-                                STORM_LOG_TRACE("Permutation="<<permutation);
-                                ValueType permResult = storm::utility::one<ValueType>();
-                                for(size_t i = 0; i < res.size(); ++i) {
-                                    if(permutation & (1 << i)) {
-                                        permResult *= res[i];
-                                    } else {
-                                        permResult *= storm::utility::one<ValueType>() - res[i];
-                                    }
+                    // Combine modularisation results
+                    STORM_LOG_TRACE("Combining all results... K=" << nrK << "; M=" << nrM << "; invResults=" << (invResults?"On":"Off"));
+                    ValueType result = storm::utility::zero<ValueType>();
+                    int limK = invResults ? -1 : nrM+1;
+                    int chK = invResults ? -1 : 1;
+                    // WARNING: there is a bug for computing permutations with more than 32 elements
+                    STORM_LOG_THROW(res.size() < 32, storm::exceptions::NotSupportedException, "Permutations work only for < 32 elements");
+                    for(int cK = nrK; cK != limK; cK += chK ) {
+                        STORM_LOG_ASSERT(cK >= 0, "ck negative.");
+                        size_t permutation = smallestIntWithNBitsSet(static_cast<size_t>(cK));
+                        do {
+                            STORM_LOG_TRACE("Permutation="<<permutation);
+                            ValueType permResult = storm::utility::one<ValueType>();
+                            for(size_t i = 0; i < res.size(); ++i) {
+                                if(permutation & (1 << i)) {
+                                    permResult *= res[i];
+                                } else {
+                                    permResult *= storm::utility::one<ValueType>() - res[i];
                                 }
-                                STORM_LOG_TRACE("Result for permutation:"<<permResult);
-                                permutation = nextBitPermutation(permutation);
-                                result += permResult;
-                            } while(permutation < (1 << nrM) && permutation != 0);
-                        }
-                        if(invResults) {
-                            result = storm::utility::one<ValueType>() - result;
-                        }
-                        results.push_back(result);
+                            }
+                            STORM_LOG_TRACE("Result for permutation:"<<permResult);
+                            permutation = nextBitPermutation(permutation);
+                            result += permResult;
+                        } while(permutation < (1 << nrM) && permutation != 0);
+                    }
+                    if(invResults) {
+                        result = storm::utility::one<ValueType>() - result;
                     }
+                    results.push_back(result);
                 }
                 return results;
             } else {
@@ -142,6 +154,93 @@ namespace storm {
             }
         }
 
+        template<typename ValueType>
+        std::vector<std::vector<ValueType>> DFTModelChecker<ValueType>::checkModules(std::vector<storm::storage::DFT<ValueType>> const& dfts, property_vector const& properties, bool symred, std::set<size_t> const& relevantEvents, bool allowDCForRelevantEvents) {
+            std::vector<std::vector<ValueType>> moduleResults(dfts.size());
+            auto checkModule = [&](DFTModelChecker<ValueType>& checker, size_t index) {
+                // TODO: allow approximation in modularisation
+                dft_results ftResults = checker.checkHelper(dfts[index], properties, symred, true, relevantEvents, allowDCForRelevantEvents, 0.0);
+                STORM_LOG_ASSERT(ftResults.size() == properties.size(), "Wrong number of results");
+                for (auto const& ftResult : ftResults) {
+                    moduleResults[index].push_back(boost::get<ValueType>(ftResult));
+                }
+            };
+
+            uint_fast64_t numberOfWorkers = getNumberOfModuleWorkers(dfts.size());
+            if (numberOfWorkers <= 1) {
+                for (size_t index = 0; index < dfts.size(); ++index) {
+                    checkModule(*this, index);
+                }
+                return moduleResults;
+            }
+
+            STORM_LOG_DEBUG("Checking " << dfts.size() << " modules with " << numberOfWorkers << " threads.");
+            // Each worker uses its own model checker and takes the next unchecked module.
+            // The results are stored at the index of the module, so the combination does not depend on the scheduling of the workers.
+            std::atomic<size_t> nextModule(0);
+            std::vector<std::exception_ptr> exceptions(dfts.size());
+            std::mutex timerMutex;
+            std::vector<std::thread> workers;
+            for (uint_fast64_t worker = 0; worker < numberOfWorkers; ++worker) {
+                workers.emplace_back([&]() {
+                    DFTModelChecker<ValueType> workerChecker(false);
+                    for (size_t index = nextModule++; index < dfts.size(); index = nextModule++) {
+                        try {
+                            checkModule(workerChecker, index);
+                        } catch (...) {
+                            exceptions[index] = std::current_exception();
+                        }
+                    }
+                    // Note that the timings of all workers are accumulated
+                    std::lock_guard<std::mutex> lock(timerMutex);
+                    explorationTimer.add(workerChecker.explorationTimer);
+                    buildingTimer.add(workerChecker.buildingTimer);
+                    bisimulationTimer.add(workerChecker.bisimulationTimer);
+                    modelCheckingTimer.add(workerChecker.modelCheckingTimer);
+                });
+            }
+            for (auto& worker : workers) {
+                worker.join();
+            }
+
+            // Report the error of the first failing module
+            for (auto const& exception : exceptions) {
+                if (exception) {
+                    std::rethrow_exception(exception);
+                }
+            }
+            return moduleResults;
+        }
+
+        template<typename ValueType>
+        uint_fast64_t DFTModelChecker<ValueType>::getNumberOfModuleWorkers(uint_fast64_t numberOfModules) const {
+            if (!std::is_same<ValueType, double>::value) {
+                STORM_LOG_WARN_COND(numberOfModuleThreads <= 1, "Checking modules in parallel is only supported for double. Checking modules sequentially.");
+                // The caches of the rational function library are not thread-safe
+                return 1;
+            }
+            uint_fast64_t memoryLimitInMegabytes = 0;
+            if (moduleMemoryBudget > 0) {
+                std::size_t memoryLimit = storm::utility::resources::getMemoryLimit();
+                if (memoryLimit != static_cast<std::size_t>(RLIM_INFINITY)) {
+                    memoryLimitInMegabytes = memoryLimit / (1024 * 1024);
+                }
+            }
+            return computeNumberOfModuleWorkers(numberOfModuleThreads, numberOfModules, moduleMemoryBudget, memoryLimitInMegabytes);
+        }
+
+        template<typename ValueType>
+        uint_fast64_t DFTModelChecker<ValueType>::computeNumberOfModuleWorkers(uint_fast64_t numberOfThreads, uint_fast64_t numberOfModules, uint_fast64_t moduleMemoryBudget,
+                                                                               uint_fast64_t memoryLimitInMegabytes) {
+            uint_fast64_t numberOfWorkers = std::max<uint_fast64_t>(1, std::min(numberOfThreads, numberOfModules));
+            if (numberOfWorkers > 1 && moduleMemoryBudget > 0 && memoryLimitInMegabytes > 0) {
+                uint_fast64_t maxWorkers = std::max<uint_fast64_t>(1, memoryLimitInMegabytes / moduleMemoryBudget);
+                STORM_LOG_INFO_COND(maxWorkers >= numberOfWorkers, "Reducing number of threads for checking modules to " << maxWorkers << " due to memory limit of " << memoryLimitInMegabytes << "MB.");
+                numberOfWorkers = std::min(numberOfWorkers, maxWorkers);
+            }
+            return numberOfWorkers;
+        }
+
         template<typename ValueType>
         std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> DFTModelChecker<ValueType>::buildModelViaComposition(storm::storage::DFT<ValueType> const& dft, property_vector const& properties, bool symred, bool allowModularisation, std::set<size_t> const& relevantEvents, bool allowDCForRelevantEvents)  {
             // TODO: use approximation?
@@ -194,7 +293,7 @@ namespace storm {
 
                     // Build a single CTMC
                     STORM_LOG_DEBUG("Building Model...");
-                    storm::builder::ExplicitDFTModelBuilder<ValueType> builder(ft, symmetries, relevantEvents, allowDCForRelevantEvents);
+                    storm::builder::ExplicitDFTModelBuilder<ValueType> builder(ft, symmetries, relevantEvents, allowDCForRelevantEvents, numberOfExplorationThreads);
                     builder.buildModel(0, 0.0);
                     std::shared_ptr<storm::models::sparse::Model<ValueType>> model = builder.getModel();
                     explorationTimer.stop();
@@ -245,7 +344,7 @@ namespace storm {
                 // Build a single CTMC
                 STORM_LOG_DEBUG("Building Model...");
 
-                storm::builder::ExplicitDFTModelBuilder<ValueType> builder(dft, symmetries, relevantEvents, allowDCForRelevantEvents);
+                storm::builder::ExplicitDFTModelBuilder<ValueType> builder(dft, symmetries, relevantEvents, allowDCForRelevantEvents, numberOfExplorationThreads);
                 builder.buildModel(0, 0.0);
                 std::shared_ptr<storm::models::sparse::Model<ValueType>> model = builder.getModel();
                 //model->printModelInformationToStream(std::cout);
@@ -276,7 +375,7 @@ namespace storm {
                 approximation_result approxResult = std::make_pair(storm::utility::zero<ValueType>(), storm::utility::zero<ValueType>());
                 std::shared_ptr<storm::models::sparse::Model<ValueType>> model;
                 std::vector<ValueType> newResult;
-                storm::builder::ExplicitDFTModelBuilder<ValueType> builder(dft, symmetries, relevantEvents, allowDCForRelevantEvents);
+                storm::builder::ExplicitDFTModelBuilder<ValueType> builder(dft, symmetries, relevantEvents, allowDCForRelevantEvents, numberOfExplorationThreads);
 
                 // TODO: compute approximation for all properties simultaneously?
                 std::shared_ptr<const storm::logic::Formula> property = properties[0];
@@ -341,7 +440,7 @@ namespace storm {
                 // Build a single Markov Automaton
                 auto ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
                 STORM_LOG_DEBUG("Building Model...");
-                storm::builder::ExplicitDFTModelBuilder<ValueType> builder(dft, symmetries, relevantEvents, allowDCForRelevantEvents);
+                storm::builder::ExplicitDFTModelBuilder<ValueType> builder(dft, symmetries, relevantEvents, allowDCForRelevantEvents, numberOfExplorationThreads);
                 builder.buildModel(0, 0.0);
                 std::shared_ptr<storm::models::sparse::Model<ValueType>> model = builder.getModel();
                 explorationTimer.stop();
@@ -40,8 +40,14 @@ namespace storm {
 
             /*!
              * Constructor.
+             *
+             * @param printOutput If true, model information is printed.
+             * @param numberOfModuleThreads Number of threads used to check independent modules concurrently. Values <= 1 disable parallel checking.
+             * @param moduleMemoryBudget Memory (in MB) that is reserved for checking a single module. If a memory limit is set, the number of
+             *                           concurrently checked modules is bounded such that their budgets fit into the limit. Value 0 indicates no budget.
+             * @param numberOfExplorationThreads Number of threads used to explore the state space of a single (sub-)DFT. Values <= 1 disable parallel exploration.
              */
-            DFTModelChecker(bool printOutput) : printInfo(printOutput) {
+            DFTModelChecker(bool printOutput, uint_fast64_t numberOfModuleThreads = 1, uint_fast64_t moduleMemoryBudget = 0, uint_fast64_t numberOfExplorationThreads = 1) : printInfo(printOutput), numberOfModuleThreads(numberOfModuleThreads), moduleMemoryBudget(moduleMemoryBudget), numberOfExplorationThreads(numberOfExplorationThreads) {
             }
 
             /*!
@@ -76,10 +82,33 @@ namespace storm {
              */
             void printResults(dft_results const& results, std::ostream& os = std::cout);
 
+            /*!
+             * Compute the number of workers for checking independent modules.
+             * Each worker needs the given memory budget, so the number of workers is bounded by the memory limit divided by the budget.
+             * At least one worker is always used.
+             *
+             * @param numberOfThreads Maximal number of threads.
+             * @param numberOfModules Number of modules to check.
+             * @param moduleMemoryBudget Memory budget (in MB) per module check. Value 0 indicates no budget.
+             * @param memoryLimitInMegabytes Memory limit (in MB) of the process. Value 0 indicates no limit.
+             * @return Number of workers.
+             */
+            static uint_fast64_t computeNumberOfModuleWorkers(uint_fast64_t numberOfThreads, uint_fast64_t numberOfModules, uint_fast64_t moduleMemoryBudget,
+                                                              uint_fast64_t memoryLimitInMegabytes);
+
         private:
 
             bool printInfo;
 
+            // Number of threads for checking independent modules
+            uint_fast64_t numberOfModuleThreads;
+
+            // Memory budget (in MB) per module check
+            uint_fast64_t moduleMemoryBudget;
+
+            // Number of threads for exploring the state space
+            uint_fast64_t numberOfExplorationThreads;
+
             // Timing values
             storm::utility::Stopwatch buildingTimer;
             storm::utility::Stopwatch explorationTimer;
@@ -104,6 +133,28 @@ namespace storm {
                                     std::set<size_t> const& relevantEvents, bool allowDCForRelevantEvents = true, double approximationError = 0.0,
                                     storm::builder::ApproximationHeuristic approximationHeuristic = storm::builder::ApproximationHeuristic::DEPTH);
 
+            /*!
+             * Check the independent modules of a DFT. If enabled, the modules are checked concurrently.
+             * The order of the results is the order of the modules, independent of the order in which they were checked.
+             *
+             * @param dfts Independent modules.
+             * @param properties Properties to check for.
+             * @param symred Flag indicating if symmetry reduction should be used.
+             * @param relevantEvents List with ids of relevant events which should be observed.
+             * @param allowDCForRelevantEvents If true, Don't Care propagation is allowed even for relevant events.
+             * @return For each module the results for all properties.
+             */
+            std::vector<std::vector<ValueType>> checkModules(std::vector<storm::storage::DFT<ValueType>> const& dfts, property_vector const& properties, bool symred,
+                                                             std::set<size_t> const& relevantEvents, bool allowDCForRelevantEvents);
+
+            /*!
+             * Get the number of workers for checking the given number of modules with respect to the number of threads and the memory budget.
+             *
+             * @param numberOfModules Number of modules to check.
+             * @return Number of workers.
+             */
+            uint_fast64_t getNumberOfModuleWorkers(uint_fast64_t numberOfModules) const;
+
             /*!
              * Internal helper for building a CTMC from a DFT via parallel composition.
              *
@@ -25,6 +25,9 @@ namespace storm {
             const std::string FaultTreeSettings::approximationErrorOptionShortName = "approx";
             const std::string FaultTreeSettings::approximationHeuristicOptionName = "approximationheuristic";
             const std::string FaultTreeSettings::firstDependencyOptionName = "firstdep";
+            const std::string FaultTreeSettings::moduleThreadsOptionName = "modulethreads";
+            const std::string FaultTreeSettings::moduleMemoryOptionName = "modulememory";
+            const std::string FaultTreeSettings::explorationThreadsOptionName = "explorationthreads";
 #ifdef STORM_HAVE_Z3
             const std::string FaultTreeSettings::solveWithSmtOptionName = "smt";
 #endif
@@ -42,6 +45,12 @@ namespace storm {
                     .addArgument(storm::settings::ArgumentBuilder::createStringArgument("heuristic", "The name of the heuristic used for approximation.")
                     .setDefaultValueString("depth")
                     .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator({"depth", "probability", "bounddifference"})).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, moduleThreadsOptionName, false, "Check independent modules in parallel (only applicable with modularisation).")
+                    .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("threads", "The number of threads to use.").addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, moduleMemoryOptionName, false, "Memory budget for checking a single module in parallel. Together with the memory limit, this bounds the number of modules checked at the same time.")
+                    .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("megabytes", "The memory budget in MB.").addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, explorationThreadsOptionName, false, "Explore the state space with multiple threads (only applicable for double).")
+                    .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("threads", "The number of threads to use.").addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
 #ifdef STORM_HAVE_Z3
                 this->addOption(storm::settings::OptionBuilder(moduleName, solveWithSmtOptionName, true, "Solve the DFT with SMT.").build());
 #endif
@@ -95,6 +104,27 @@ namespace storm {
                 return this->getOption(firstDependencyOptionName).getHasOptionBeenSet();
             }
 
+            uint_fast64_t FaultTreeSettings::getNumberOfModuleThreads() const {
+                if (this->getOption(moduleThreadsOptionName).getHasOptionBeenSet()) {
+                    return this->getOption(moduleThreadsOptionName).getArgumentByName("threads").getValueAsUnsignedInteger();
+                }
+                return 1;
+            }
+
+            uint_fast64_t FaultTreeSettings::getModuleMemoryBudget() const {
+                if (this->getOption(moduleMemoryOptionName).getHasOptionBeenSet()) {
+                    return this->getOption(moduleMemoryOptionName).getArgumentByName("megabytes").getValueAsUnsignedInteger();
+                }
+                return 0;
+            }
+
+            uint_fast64_t FaultTreeSettings::getNumberOfExplorationThreads() const {
+                if (this->getOption(explorationThreadsOptionName).getHasOptionBeenSet()) {
+                    return this->getOption(explorationThreadsOptionName).getArgumentByName("threads").getValueAsUnsignedInteger();
+                }
+                return 1;
+            }
+
 #ifdef STORM_HAVE_Z3
             bool FaultTreeSettings::solveWithSMT() const {
                 return this->getOption(solveWithSmtOptionName).getHasOptionBeenSet();
@@ -89,6 +89,27 @@ namespace storm {
                  */
                 bool isTakeFirstDependency() const;
 
+                /*!
+                 * Retrieves the number of threads used for checking independent modules.
+                 *
+                 * @return The number of threads (1 if modules are checked sequentially).
+                 */
+                uint_fast64_t getNumberOfModuleThreads() const;
+
+                /*!
+                 * Retrieves the memory budget for checking a single module in parallel.
+                 *
+                 * @return The memory budget in MB (0 if no budget is set).
+                 */
+                uint_fast64_t getModuleMemoryBudget() const;
+
+                /*!
+                 * Retrieves the number of threads used for exploring the state space.
+                 *
+                 * @return The number of threads (1 if the state space is explored sequentially).
+                 */
+                uint_fast64_t getNumberOfExplorationThreads() const;
+
 #ifdef STORM_HAVE_Z3
 
                 /*!
@@ -119,6 +140,9 @@ namespace storm {
                 static const std::string approximationErrorOptionShortName;
                 static const std::string approximationHeuristicOptionName;
                 static const std::string firstDependencyOptionName;
+                static const std::string moduleThreadsOptionName;
+                static const std::string moduleMemoryOptionName;
+                static const std::string explorationThreadsOptionName;
 #ifdef STORM_HAVE_Z3
                 static const std::string solveWithSmtOptionName;
 #endif
@@ -0,0 +1,48 @@
+#include "DFTStateArena.h"
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace storage {
+
+        DFTStateArena::DFTStateArena(uint64_t bitsPerState) : bitsPerState(bitsPerState), usedSlots(0), slots(bitsPerState) {
+            STORM_LOG_ASSERT(bitsPerState % 64 == 0, "Size of states must be a multiple of 64.");
+        }
+
+        uint64_t DFTStateArena::store(storm::storage::BitVector const& status) {
+            STORM_LOG_ASSERT(status.size() == bitsPerState, "Size of status and size of slots do not match.");
+            uint64_t slot;
+            if (!freeSlots.empty()) {
+                slot = freeSlots.back();
+                freeSlots.pop_back();
+            } else {
+                slot = usedSlots++;
+                if (usedSlots * bitsPerState > slots.size()) {
+                    // Double the capacity
+                    slots.resize(2 * slots.size());
+                }
+            }
+            slots.set(slot * bitsPerState, status);
+            return slot;
+        }
+
+        storm::storage::BitVector DFTStateArena::get(uint64_t slot) const {
+            STORM_LOG_ASSERT(slot < usedSlots, "Slot " << slot << " is not in use.");
+            return slots.get(slot * bitsPerState, bitsPerState);
+        }
+
+        void DFTStateArena::release(uint64_t slot) {
+            STORM_LOG_ASSERT(slot < usedSlots, "Slot " << slot << " is not in use.");
+            freeSlots.push_back(slot);
+        }
+
+        uint64_t DFTStateArena::size() const {
+            return usedSlots - freeSlots.size();
+        }
+
+        uint64_t DFTStateArena::capacity() const {
+            return slots.size() / bitsPerState;
+        }
+
+    }
+}
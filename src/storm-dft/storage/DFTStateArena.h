@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+    namespace storage {
+
+        /*!
+         * Arena holding the status bit vectors of DFT states in one contiguous bit vector.
+         * Each status occupies a slot of fixed size. Released slots are reused by later states, so the memory of the
+         * arena is bounded by the maximal number of states that are stored simultaneously.
+         */
+        class DFTStateArena {
+        public:
+            /*!
+             * Create new arena.
+             * @param bitsPerState Number of bits of each status. Must be a multiple of 64.
+             */
+            explicit DFTStateArena(uint64_t bitsPerState);
+
+            /*!
+             * Store the given status in a free slot.
+             * @param status Status of the state.
+             * @return Slot in which the status is stored.
+             */
+            uint64_t store(storm::storage::BitVector const& status);
+
+            /*!
+             * Retrieve the status stored in the given slot.
+             * @param slot Slot.
+             * @return Status.
+             */
+            storm::storage::BitVector get(uint64_t slot) const;
+
+            /*!
+             * Release the given slot such that it can be reused.
+             * @param slot Slot.
+             */
+            void release(uint64_t slot);
+
+            /*!
+             * Get the number of slots which are currently in use.
+             * @return Number of stored states.
+             */
+            uint64_t size() const;
+
+            /*!
+             * Get the number of slots the arena has allocated memory for.
+             * @return Number of slots.
+             */
+            uint64_t capacity() const;
+
+        private:
+            // Number of bits of each slot.
+            uint64_t bitsPerState;
+
+            // Number of slots which were handed out at least once.
+            uint64_t usedSlots;
+
+            // The stored status vectors.
+            storm::storage::BitVector slots;
+
+            // Slots which were released and can be reused.
+            std::vector<uint64_t> freeSlots;
+        };
+
+    }
+}
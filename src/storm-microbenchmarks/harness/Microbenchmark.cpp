@@ -0,0 +1,36 @@
+#include "storm-microbenchmarks/harness/Microbenchmark.h"
+
+#include <chrono>
+
+namespace storm {
+    namespace microbenchmarks {
+
+        Measurement measure(Kernel const& kernel, double minimalTime) {
+            Measurement result;
+            result.name = kernel.name;
+
+            // Warm up caches and any lazily initialized data of the kernel.
+            result.checksum = kernel.execute();
+
+            uint64_t iterations = 1;
+            while (true) {
+                auto start = std::chrono::high_resolution_clock::now();
+                for (uint64_t iteration = 0; iteration < iterations; ++iteration) {
+                    result.checksum += kernel.execute();
+                }
+                double seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+                if (seconds >= minimalTime) {
+                    result.iterations = iterations;
+                    result.seconds = seconds;
+                    break;
+                }
+                iterations *= 2;
+            }
+
+            result.secondsPerIteration = result.seconds / result.iterations;
+            result.operationsPerSecond = static_cast<double>(kernel.operationsPerExecution) / result.secondsPerIteration;
+            result.gigabytesPerSecond = static_cast<double>(kernel.bytesPerExecution) / result.secondsPerIteration / 1e9;
+            return result;
+        }
+    }
+}
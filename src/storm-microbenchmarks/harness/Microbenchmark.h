@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+
+namespace storm {
+    namespace microbenchmarks {
+
+        /*!
+         * A kernel that is to be measured.
+         */
+        struct Kernel {
+            // The name under which the kernel is reported.
+            std::string name;
+
+            // The number of bytes that one execution of the kernel reads and writes (used to derive the bandwidth).
+            uint64_t bytesPerExecution;
+
+            // The number of operations (e.g. matrix entries, bits or lookups) processed by one execution.
+            uint64_t operationsPerExecution;
+
+            // Executes the kernel once. The returned value is accumulated so that the compiler cannot discard the
+            // computation.
+            std::function<double()> execute;
+        };
+
+        /*!
+         * The outcome of measuring a kernel.
+         */
+        struct Measurement {
+            std::string name;
+            uint64_t iterations;
+            double seconds;
+            double secondsPerIteration;
+            double operationsPerSecond;
+            double gigabytesPerSecond;
+            double checksum;
+        };
+
+        /*!
+         * Measures the given kernel. After one warm-up execution, the number of iterations is doubled until the kernel
+         * was executed for at least the given minimal time.
+         *
+         * @param kernel The kernel to measure.
+         * @param minimalTime The minimal time (in seconds) of the final measurement.
+         * @return The measurement of the final round.
+         */
+        Measurement measure(Kernel const& kernel, double minimalTime);
+    }
+}
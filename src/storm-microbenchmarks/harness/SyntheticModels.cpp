@@ -0,0 +1,81 @@
+#include "storm-microbenchmarks/harness/SyntheticModels.h"
+
+#include <algorithm>
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace microbenchmarks {
+
+        storm::storage::SparseMatrix<double> createRandomMdpMatrix(SyntheticMdpOptions const& options, std::mt19937_64& generator) {
+            STORM_LOG_ASSERT(options.numberOfStates > 0 && options.maximalNumberOfChoices > 0 && options.branchingFactor > 0, "Illegal shape of the synthetic MDP.");
+            uint64_t const numberOfStates = options.numberOfStates;
+            std::uniform_int_distribution<uint64_t> choiceDistribution(1, options.maximalNumberOfChoices);
+            std::uniform_real_distribution<double> probabilityDistribution(0.0, 1.0);
+            std::uniform_int_distribution<uint64_t> globalSuccessorDistribution(0, numberOfStates - 1);
+            uint64_t const window = options.locality == 0 ? 0 : std::min(2 * options.locality + 1, numberOfStates);
+            std::uniform_int_distribution<uint64_t> localSuccessorDistribution(0, window == 0 ? 0 : window - 1);
+            // A choice cannot have more distinct successors than there are candidates.
+            uint64_t const branchingFactor = std::min(options.branchingFactor, window == 0 ? numberOfStates : window);
+
+            storm::storage::SparseMatrixBuilder<double> builder(0, numberOfStates, 0, false, true, numberOfStates);
+            std::vector<uint64_t> successors;
+            std::vector<double> probabilities;
+            uint64_t row = 0;
+            for (uint64_t state = 0; state < numberOfStates; ++state) {
+                builder.newRowGroup(row);
+                uint64_t numberOfChoices = choiceDistribution(generator);
+                for (uint64_t choice = 0; choice < numberOfChoices; ++choice, ++row) {
+                    // Draw distinct successors.
+                    successors.clear();
+                    while (successors.size() < branchingFactor) {
+                        uint64_t successor;
+                        if (window == 0) {
+                            successor = globalSuccessorDistribution(generator);
+                        } else {
+                            // Successors lie within [state - locality, state + locality], wrapping around.
+                            successor = (state + numberOfStates - std::min(options.locality, numberOfStates - 1) + localSuccessorDistribution(generator)) % numberOfStates;
+                        }
+                        if (std::find(successors.begin(), successors.end(), successor) == successors.end()) {
+                            successors.push_back(successor);
+                        }
+                    }
+                    std::sort(successors.begin(), successors.end());
+
+                    probabilities.clear();
+                    double sum = 0.0;
+                    for (uint64_t i = 0; i < successors.size(); ++i) {
+                        probabilities.push_back(probabilityDistribution(generator) + 1e-3);
+                        sum += probabilities.back();
+                    }
+                    for (uint64_t i = 0; i < successors.size(); ++i) {
+                        builder.addNextValue(row, successors[i], probabilities[i] / sum);
+                    }
+                }
+            }
+            return builder.build();
+        }
+
+        std::vector<double> createRandomVector(uint64_t length, std::mt19937_64& generator) {
+            std::uniform_real_distribution<double> distribution(0.0, 1.0);
+            std::vector<double> result(length);
+            for (auto& entry : result) {
+                entry = distribution(generator);
+            }
+            return result;
+        }
+
+        storm::storage::BitVector createRandomBitVector(uint64_t length, std::mt19937_64& generator) {
+            storm::storage::BitVector result(length);
+            for (uint64_t index = 0; index < length; index += 64) {
+                uint64_t numberOfBits = std::min<uint64_t>(64, length - index);
+                uint64_t bits = generator();
+                if (numberOfBits < 64) {
+                    bits &= (1ull << numberOfBits) - 1;
+                }
+                result.setFromInt(index, numberOfBits, bits);
+            }
+            return result;
+        }
+    }
+}
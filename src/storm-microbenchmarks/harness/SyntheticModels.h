@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstdint>
+#include <random>
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+    namespace microbenchmarks {
+
+        struct SyntheticMdpOptions {
+            // The number of states (i.e. row groups).
+            uint64_t numberOfStates;
+
+            // The number of choices of each state is drawn uniformly from [1, maximalNumberOfChoices].
+            uint64_t maximalNumberOfChoices;
+
+            // The number of (distinct) successors of each choice.
+            uint64_t branchingFactor;
+
+            // If non-zero, the successors of a state are drawn from the states whose index differs by at most this
+            // value (wrapping around). Otherwise, they are drawn from all states.
+            uint64_t locality;
+        };
+
+        /*!
+         * Creates the transition matrix of a random MDP with the given shape. The probabilities of each choice are
+         * drawn at random and normalized.
+         *
+         * @param options The shape of the MDP.
+         * @param generator The random generator to use.
+         * @return The transition matrix.
+         */
+        storm::storage::SparseMatrix<double> createRandomMdpMatrix(SyntheticMdpOptions const& options, std::mt19937_64& generator);
+
+        /*!
+         * Creates a vector of the given length whose entries are drawn uniformly from [0,1].
+         */
+        std::vector<double> createRandomVector(uint64_t length, std::mt19937_64& generator);
+
+        /*!
+         * Creates a bit vector of the given length in which each bit is set with probability 1/2.
+         */
+        storm::storage::BitVector createRandomBitVector(uint64_t length, std::mt19937_64& generator);
+    }
+}
@@ -0,0 +1,91 @@
+#include "storm-microbenchmarks/settings/modules/MicrobenchmarkSettings.h"
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/SettingMemento.h"
+#include "storm/settings/Option.h"
+#include "storm/settings/OptionBuilder.h"
+#include "storm/settings/ArgumentBuilder.h"
+
+#include <boost/algorithm/string.hpp>
+
+namespace storm {
+    namespace settings {
+        namespace modules {
+            
+            const std::string MicrobenchmarkSettings::moduleName = "microbenchmarks";
+            const std::string statesOption = "states";
+            const std::string choicesOption = "choices";
+            const std::string branchingOption = "branching";
+            const std::string localityOption = "locality";
+            const std::string seedOption = "seed";
+            const std::string minimalTimeOption = "mintime";
+            const std::string kernelsOption = "kernels";
+            const std::string exportJsonOption = "exportjson";
+
+            MicrobenchmarkSettings::MicrobenchmarkSettings() : ModuleSettings(moduleName) {
+                this->addOption(storm::settings::OptionBuilder(moduleName, statesOption, false, "Sets the number of states of the synthetic MDP.").addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of states.").setDefaultValueUnsignedInteger(1000000).addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, choicesOption, false, "Sets the maximal number of choices per state of the synthetic MDP. The number of choices of each state is drawn uniformly from [1,count].").addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The maximal number of choices.").setDefaultValueUnsignedInteger(4).addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, branchingOption, false, "Sets the number of successors of each choice of the synthetic MDP.").addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of successors.").setDefaultValueUnsignedInteger(4).addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, localityOption, false, "Sets the maximal distance between a state and its successors in the synthetic MDP (0 means no restriction).").addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("distance", "The maximal distance.").setDefaultValueUnsignedInteger(0).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, seedOption, false, "Sets the seed used to create the synthetic inputs.").addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("seed", "The seed.").setDefaultValueUnsignedInteger(42).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, minimalTimeOption, false, "Sets the minimal time each kernel is measured.").addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("seconds", "The minimal time in seconds.").setDefaultValueDouble(1.0).addValidatorDouble(storm::settings::ArgumentValidatorFactory::createDoubleGreaterValidator(0.0)).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, kernelsOption, false, "Only runs the given kernels.").addArgument(storm::settings::ArgumentBuilder::createStringArgument("names", "A comma separated list of kernel names.").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, exportJsonOption, false, "Writes the measurements to the given json file.").addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The name of the json file.").build()).build());
+            }
+
+            uint64_t MicrobenchmarkSettings::getNumberOfStates() const {
+                return this->getOption(statesOption).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+            
+            uint64_t MicrobenchmarkSettings::getMaximalNumberOfChoices() const {
+                return this->getOption(choicesOption).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+            
+            uint64_t MicrobenchmarkSettings::getBranchingFactor() const {
+                return this->getOption(branchingOption).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+            
+            uint64_t MicrobenchmarkSettings::getLocality() const {
+                return this->getOption(localityOption).getArgumentByName("distance").getValueAsUnsignedInteger();
+            }
+            
+            uint64_t MicrobenchmarkSettings::getSeed() const {
+                return this->getOption(seedOption).getArgumentByName("seed").getValueAsUnsignedInteger();
+            }
+            
+            double MicrobenchmarkSettings::getMinimalTime() const {
+                return this->getOption(minimalTimeOption).getArgumentByName("seconds").getValueAsDouble();
+            }
+            
+            bool MicrobenchmarkSettings::isKernelFilterSet() const {
+                return this->getOption(kernelsOption).getHasOptionBeenSet();
+            }
+            
+            std::vector<std::string> MicrobenchmarkSettings::getKernelFilter() const {
+                std::vector<std::string> result;
+                std::string names = this->getOption(kernelsOption).getArgumentByName("names").getValueAsString();
+                boost::split(result, names, boost::is_any_of(","));
+                for (auto& name : result) {
+                    boost::trim(name);
+                }
+                return result;
+            }
+            
+            bool MicrobenchmarkSettings::isExportToJsonSet() const {
+                return this->getOption(exportJsonOption).getHasOptionBeenSet();
+            }
+            
+            std::string MicrobenchmarkSettings::getExportToJsonFilename() const {
+                return this->getOption(exportJsonOption).getArgumentByName("filename").getValueAsString();
+            }
+            
+            void MicrobenchmarkSettings::finalize() {
+            }
+
+            bool MicrobenchmarkSettings::check() const {
+                return true;
+            }
+            
+        } // namespace modules
+    } // namespace settings
+} // namespace storm
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "storm-config.h"
+#include "storm/settings/modules/ModuleSettings.h"
+
+#include <string>
+#include <vector>
+
+namespace storm {
+    namespace settings {
+        namespace modules {
+
+            /*!
+             * This class represents the settings for the microbenchmarks of the core sparse kernels.
+             */
+            class MicrobenchmarkSettings : public ModuleSettings {
+            public:
+
+                /*!
+                 * Creates a new set of microbenchmark settings.
+                 */
+                MicrobenchmarkSettings();
+
+                virtual ~MicrobenchmarkSettings() = default;
+                
+                /*!
+                 * Retrieves the number of states of the synthetic models.
+                 */
+                uint64_t getNumberOfStates() const;
+                
+                /*!
+                 * Retrieves the maximal number of choices per state of the synthetic models.
+                 */
+                uint64_t getMaximalNumberOfChoices() const;
+                
+                /*!
+                 * Retrieves the number of successors of each choice of the synthetic models.
+                 */
+                uint64_t getBranchingFactor() const;
+                
+                /*!
+                 * Retrieves the maximal distance between a state and its successors. Zero means that successors are
+                 * drawn from all states.
+                 */
+                uint64_t getLocality() const;
+                
+                /*!
+                 * Retrieves the seed of the random generator used to create the synthetic inputs.
+                 */
+                uint64_t getSeed() const;
+                
+                /*!
+                 * Retrieves the minimal time (in seconds) each kernel is measured.
+                 */
+                double getMinimalTime() const;
+                
+                /*!
+                 * Retrieves whether only some of the kernels are to be run.
+                 */
+                bool isKernelFilterSet() const;
+                
+                /*!
+                 * Retrieves the names of the kernels to run.
+                 */
+                std::vector<std::string> getKernelFilter() const;
+                
+                /*!
+                 * Retrieves whether the measurements are to be written to a json file.
+                 */
+                bool isExportToJsonSet() const;
+                
+                /*!
+                 * Retrieves the name of the file to which the measurements are written.
+                 */
+                std::string getExportToJsonFilename() const;
+                
+                bool check() const override;
+                void finalize() override;
+
+                // The name of the module.
+                static const std::string moduleName;
+            };
+
+        } // namespace modules
+    } // namespace settings
+} // namespace storm
@@ -0,0 +1,205 @@
+#include "storm/utility/initialize.h"
+
+#include "storm/settings/modules/GeneralSettings.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/settings/modules/DebugSettings.h"
+#include "storm/settings/modules/ResourceSettings.h"
+#include "storm-microbenchmarks/settings/modules/MicrobenchmarkSettings.h"
+
+#include "storm-cli-utilities/cli.h"
+
+#include "storm-microbenchmarks/harness/Microbenchmark.h"
+#include "storm-microbenchmarks/harness/SyntheticModels.h"
+
+#include "storm/environment/Environment.h"
+#include "storm/solver/NativeMultiplier.h"
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/BitVectorHashMap.h"
+#include "storm/utility/vector.h"
+#include "storm/utility/Stopwatch.h"
+#include "storm/utility/storm-version.h"
+#include "storm/utility/file.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+
+// JSON parser
+#include "json.hpp"
+namespace modernjson {
+    using json = nlohmann::json;
+}
+
+/*!
+ * Creates the kernels that are measured on the given synthetic MDP. The referenced data needs to outlive the kernels.
+ */
+std::vector<storm::microbenchmarks::Kernel> createKernels(storm::storage::SparseMatrix<double> const& matrix, std::vector<double> const& x, std::vector<double>& rowResult, std::vector<double>& groupResult, storm::solver::NativeMultiplier<double> const& multiplier, storm::Environment const& env, storm::storage::BitVector const& first, storm::storage::BitVector const& second, storm::storage::BitVector& bitVectorResult, std::vector<storm::storage::BitVector> const& keys) {
+    typedef storm::storage::SparseMatrix<double>::index_type index_type;
+    uint64_t const rows = matrix.getRowCount();
+    uint64_t const groups = matrix.getRowGroupCount();
+    uint64_t const entries = matrix.getEntryCount();
+
+    // The traffic of the matrix-based kernels assumes that each entry, each row start and each result is touched
+    // once and the operand vector is read once. Irregular access to the operand vector makes the actual traffic higher.
+    uint64_t const matrixBytes = entries * sizeof(storm::storage::MatrixEntry<index_type, double>) + (rows + 1) * sizeof(index_type);
+    uint64_t const bitVectorBytes = (first.size() + 63) / 64 * sizeof(uint64_t);
+    uint64_t const keyBytes = keys.empty() ? 0 : keys.size() * ((keys.front().size() + 63) / 64) * sizeof(uint64_t);
+
+    std::vector<storm::microbenchmarks::Kernel> kernels;
+    kernels.push_back({"spmv", matrixBytes + groups * sizeof(double) + rows * sizeof(double), entries, [&] () {
+        matrix.multiplyWithVector(x, rowResult);
+        return rowResult.front();
+    }});
+    kernels.push_back({"multiply-and-reduce", matrixBytes + groups * sizeof(double) + (groups + 1) * sizeof(index_type) + groups * sizeof(double), entries, [&] () {
+        multiplier.multiplyAndReduce(env, storm::solver::OptimizationDirection::Maximize, matrix.getRowGroupIndices(), x, nullptr, groupResult);
+        return groupResult.front();
+    }});
+    kernels.push_back({"reduce-min-or-max", rows * sizeof(double) + (groups + 1) * sizeof(index_type) + groups * sizeof(double), rows, [&] () {
+        storm::utility::vector::reduceVectorMinOrMax(storm::solver::OptimizationDirection::Minimize, rowResult, groupResult, matrix.getRowGroupIndices());
+        return groupResult.front();
+    }});
+    kernels.push_back({"bitvector-and", 3 * bitVectorBytes, first.size(), [&] () {
+        bitVectorResult = first;
+        bitVectorResult &= second;
+        return static_cast<double>(bitVectorResult.get(0));
+    }});
+    kernels.push_back({"bitvector-or", 3 * bitVectorBytes, first.size(), [&] () {
+        bitVectorResult = first;
+        bitVectorResult |= second;
+        return static_cast<double>(bitVectorResult.get(0));
+    }});
+    kernels.push_back({"bitvector-complement", 2 * bitVectorBytes, first.size(), [&] () {
+        bitVectorResult = first;
+        bitVectorResult.complement();
+        return static_cast<double>(bitVectorResult.get(0));
+    }});
+    kernels.push_back({"hashmap-find-or-add", 2 * keyBytes, 2 * keys.size(), [&] () {
+        // Each key is first inserted and then found again.
+        storm::storage::BitVectorHashMap<uint64_t> map(keys.front().size());
+        uint64_t sum = 0;
+        for (uint64_t index = 0; index < keys.size(); ++index) {
+            sum += map.findOrAdd(keys[index], index);
+        }
+        for (uint64_t index = 0; index < keys.size(); ++index) {
+            sum += map.findOrAdd(keys[index], 0);
+        }
+        return static_cast<double>(sum);
+    }});
+    return kernels;
+}
+
+/*!
+ * Initialize the settings manager.
+ */
+void initializeSettings() {
+    storm::settings::mutableManager().setName("Storm-microbenchmarks", "storm-microbenchmarks");
+
+    storm::settings::addModule<storm::settings::modules::GeneralSettings>();
+    storm::settings::addModule<storm::settings::modules::CoreSettings>();
+    storm::settings::addModule<storm::settings::modules::DebugSettings>();
+    storm::settings::addModule<storm::settings::modules::ResourceSettings>();
+
+    storm::settings::addModule<storm::settings::modules::MicrobenchmarkSettings>();
+}
+
+/*!
+ * Entry point for the microbenchmarks of the core sparse kernels.
+ *
+ * @param argc The argc argument of main().
+ * @param argv The argv argument of main().
+ * @return Return code, 0 if successfull, not 0 otherwise.
+ */
+int main(const int argc, const char** argv) {
+    try {
+        storm::utility::setUp();
+        storm::cli::printHeader("Storm-microbenchmarks", argc, argv);
+        initializeSettings();
+
+        bool optionsCorrect = storm::cli::parseOptions(argc, argv);
+        if (!optionsCorrect) {
+            return -1;
+        }
+
+        auto const& settings = storm::settings::getModule<storm::settings::modules::MicrobenchmarkSettings>();
+
+        storm::utility::Stopwatch generationWatch(true);
+        std::mt19937_64 generator(settings.getSeed());
+        storm::microbenchmarks::SyntheticMdpOptions options = {settings.getNumberOfStates(), settings.getMaximalNumberOfChoices(), settings.getBranchingFactor(), settings.getLocality()};
+        storm::storage::SparseMatrix<double> matrix = storm::microbenchmarks::createRandomMdpMatrix(options, generator);
+        std::vector<double> x = storm::microbenchmarks::createRandomVector(matrix.getColumnCount(), generator);
+        std::vector<double> rowResult(matrix.getRowCount());
+        std::vector<double> groupResult(matrix.getRowGroupCount());
+        storm::Environment env;
+        storm::solver::NativeMultiplier<double> multiplier(matrix);
+
+        storm::storage::BitVector first = storm::microbenchmarks::createRandomBitVector(matrix.getRowCount(), generator);
+        storm::storage::BitVector second = storm::microbenchmarks::createRandomBitVector(matrix.getRowCount(), generator);
+        storm::storage::BitVector bitVectorResult;
+
+        // The keys of the hash map resemble compressed states, i.e. they have a few buckets each.
+        uint64_t const numberOfKeys = std::min<uint64_t>(settings.getNumberOfStates(), 1000000);
+        std::vector<storm::storage::BitVector> keys;
+        keys.reserve(numberOfKeys);
+        for (uint64_t index = 0; index < numberOfKeys; ++index) {
+            keys.push_back(storm::microbenchmarks::createRandomBitVector(128, generator));
+        }
+        generationWatch.stop();
+        STORM_PRINT_AND_LOG("Created synthetic MDP with " << matrix.getRowGroupCount() << " states, " << matrix.getRowCount() << " choices and " << matrix.getEntryCount() << " transitions in " << generationWatch << "." << std::endl);
+
+        std::vector<storm::microbenchmarks::Kernel> kernels = createKernels(matrix, x, rowResult, groupResult, multiplier, env, first, second, bitVectorResult, keys);
+        if (settings.isKernelFilterSet()) {
+            auto filter = settings.getKernelFilter();
+            for (auto const& name : filter) {
+                STORM_LOG_THROW(std::find_if(kernels.begin(), kernels.end(), [&name] (storm::microbenchmarks::Kernel const& kernel) { return kernel.name == name; }) != kernels.end(), storm::exceptions::InvalidArgumentException, "Unknown kernel '" << name << "'.");
+            }
+            kernels.erase(std::remove_if(kernels.begin(), kernels.end(), [&filter] (storm::microbenchmarks::Kernel const& kernel) { return std::find(filter.begin(), filter.end(), kernel.name) == filter.end(); }), kernels.end());
+        }
+
+        modernjson::json measurements;
+        measurements["version"] = storm::utility::StormVersion::shortVersionString();
+        measurements["revision"] = storm::utility::StormVersion::gitRevisionHash;
+        measurements["compiler"] = storm::utility::StormVersion::cxxCompiler;
+        measurements["flags"] = storm::utility::StormVersion::cxxFlags;
+        measurements["model"]["states"] = matrix.getRowGroupCount();
+        measurements["model"]["choices"] = matrix.getRowCount();
+        measurements["model"]["transitions"] = matrix.getEntryCount();
+        measurements["model"]["branching"] = options.branchingFactor;
+        measurements["model"]["locality"] = options.locality;
+        measurements["model"]["seed"] = settings.getSeed();
+        measurements["kernels"] = modernjson::json::array();
+
+        STORM_PRINT(std::left << std::setw(24) << "kernel" << std::right << std::setw(12) << "iterations" << std::setw(14) << "ms/iteration" << std::setw(14) << "Mops/s" << std::setw(10) << "GB/s" << std::endl);
+        for (auto const& kernel : kernels) {
+            storm::microbenchmarks::Measurement measurement = storm::microbenchmarks::measure(kernel, settings.getMinimalTime());
+            STORM_PRINT(std::left << std::setw(24) << measurement.name << std::right << std::setw(12) << measurement.iterations << std::fixed << std::setprecision(3) << std::setw(14) << measurement.secondsPerIteration * 1000 << std::setw(14) << measurement.operationsPerSecond / 1e6 << std::setw(10) << measurement.gigabytesPerSecond << std::defaultfloat << std::endl);
+
+            modernjson::json kernelMeasurement;
+            kernelMeasurement["name"] = measurement.name;
+            kernelMeasurement["iterations"] = measurement.iterations;
+            kernelMeasurement["seconds"] = measurement.seconds;
+            kernelMeasurement["ops-per-second"] = measurement.operationsPerSecond;
+            kernelMeasurement["gb-per-second"] = measurement.gigabytesPerSecond;
+            kernelMeasurement["checksum"] = measurement.checksum;
+            measurements["kernels"].push_back(kernelMeasurement);
+        }
+
+        if (settings.isExportToJsonSet()) {
+            std::ofstream stream;
+            storm::utility::openFile(settings.getExportToJsonFilename(), stream);
+            stream << measurements.dump(4) << std::endl;
+            storm::utility::closeFile(stream);
+        }
+
+        // All operations have now been performed, so we clean up everything and terminate.
+        storm::utility::cleanUp();
+        return 0;
+    } catch (storm::exceptions::BaseException const &exception) {
+        STORM_LOG_ERROR("An exception caused Storm-microbenchmarks to terminate. The message of the exception is: " << exception.what());
+        return 1;
+    } catch (std::exception const &exception) {
+        STORM_LOG_ERROR("An unexpected exception occurred and caused Storm-microbenchmarks to terminate. The message of this exception is: " << exception.what());
+        return 2;
+    }
+}
@@ -1,5 +1,9 @@
 #include "storm/abstraction/jani/AutomatonAbstractor.h"
 
+#include <atomic>
+#include <exception>
+#include <thread>
+
 #include "storm/abstraction/BottomStateResult.h"
 #include "storm/abstraction/AbstractionInformation.h"
 #include "storm/abstraction/GameBddResult.h"
@@ -24,7 +28,7 @@ namespace storm {
             using storm::settings::modules::AbstractionSettings;
             
             template <storm::dd::DdType DdType, typename ValueType>
-            AutomatonAbstractor<DdType, ValueType>::AutomatonAbstractor(storm::jani::Automaton const& automaton, AbstractionInformation<DdType>& abstractionInformation, std::shared_ptr<storm::utility::solver::SmtSolverFactory> const& smtSolverFactory, bool useDecomposition, bool addPredicatesForValidBlocks, bool debug) : smtSolverFactory(smtSolverFactory), abstractionInformation(abstractionInformation), edges(), automaton(automaton) {
+            AutomatonAbstractor<DdType, ValueType>::AutomatonAbstractor(storm::jani::Automaton const& automaton, AbstractionInformation<DdType>& abstractionInformation, std::shared_ptr<storm::utility::solver::SmtSolverFactory> const& smtSolverFactory, bool useDecomposition, bool addPredicatesForValidBlocks, bool debug, uint64_t numberOfThreads) : smtSolverFactory(smtSolverFactory), abstractionInformation(abstractionInformation), edges(), automaton(automaton), numberOfThreads(numberOfThreads) {
                 
                 // For each concrete command, we create an abstract counterpart.
                 uint64_t edgeId = 0;
@@ -68,6 +72,11 @@ namespace storm {
             
             template <storm::dd::DdType DdType, typename ValueType>
             GameBddResult<DdType> AutomatonAbstractor<DdType, ValueType>::abstract() {
+                // If requested, the expensive part of recomputing the abstractions of the edges is done concurrently.
+                if (numberOfThreads > 1) {
+                    enumerateSolutionsInParallel();
+                }
+                
                 // First, we retrieve the abstractions of all commands.
                 std::vector<GameBddResult<DdType>> edgeDdsAndUsedOptionVariableCounts;
                 uint_fast64_t maximalNumberOfUsedOptionVariables = 0;
@@ -85,6 +94,47 @@ namespace storm {
                 return GameBddResult<DdType>(result, maximalNumberOfUsedOptionVariables);
             }
             
+            template <storm::dd::DdType DdType, typename ValueType>
+            void AutomatonAbstractor<DdType, ValueType>::enumerateSolutionsInParallel() {
+                std::vector<uint64_t> edgesToRecompute;
+                for (uint64_t index = 0; index < edges.size(); ++index) {
+                    if (edges[index].isRecomputationRequired()) {
+                        edgesToRecompute.push_back(index);
+                    }
+                }
+                
+                uint64_t numberOfWorkers = std::min<uint64_t>(numberOfThreads, edgesToRecompute.size());
+                if (numberOfWorkers <= 1) {
+                    return;
+                }
+                STORM_LOG_TRACE("Enumerating solutions of " << edgesToRecompute.size() << " edges using " << numberOfWorkers << " threads.");
+                
+                // The workers take the next edge from a shared counter until all edges are handled.
+                std::atomic<uint64_t> nextEdge(0);
+                std::vector<std::exception_ptr> exceptions(numberOfWorkers);
+                std::vector<std::thread> workers;
+                for (uint64_t worker = 0; worker < numberOfWorkers; ++worker) {
+                    workers.emplace_back([this, worker, &edgesToRecompute, &nextEdge, &exceptions] () {
+                        try {
+                            for (uint64_t index = nextEdge++; index < edgesToRecompute.size(); index = nextEdge++) {
+                                edges[edgesToRecompute[index]].enumerateSolutions(true);
+                            }
+                        } catch (...) {
+                            exceptions[worker] = std::current_exception();
+                        }
+                    });
+                }
+                for (auto& worker : workers) {
+                    worker.join();
+                }
+                
+                for (auto const& exception : exceptions) {
+                    if (exception) {
+                        std::rethrow_exception(exception);
+                    }
+                }
+            }
+            
             template <storm::dd::DdType DdType, typename ValueType>
             BottomStateResult<DdType> AutomatonAbstractor<DdType, ValueType>::getBottomStateTransitions(storm::dd::Bdd<DdType> const& reachableStates, uint_fast64_t numberOfPlayer2Variables) {
                 BottomStateResult<DdType> result(this->getAbstractionInformation().getDdManager().getBddZero(), this->getAbstractionInformation().getDdManager().getBddZero());
@@ -34,8 +34,9 @@ namespace storm {
                  * @param abstractionInformation An object holding information about the abstraction such as predicates and BDDs.
                  * @param smtSolverFactory A factory that is to be used for creating new SMT solvers.
                  * @param useDecomposition A flag indicating whether to use the decomposition during abstraction.
+                 * @param numberOfThreads The number of threads used to recompute the abstractions of the edges.
                  */
-                AutomatonAbstractor(storm::jani::Automaton const& automaton, AbstractionInformation<DdType>& abstractionInformation, std::shared_ptr<storm::utility::solver::SmtSolverFactory> const& smtSolverFactory, bool useDecomposition, bool addPredicatesForValidBlocks, bool debug);
+                AutomatonAbstractor(storm::jani::Automaton const& automaton, AbstractionInformation<DdType>& abstractionInformation, std::shared_ptr<storm::utility::solver::SmtSolverFactory> const& smtSolverFactory, bool useDecomposition, bool addPredicatesForValidBlocks, bool debug, uint64_t numberOfThreads = 1);
                 
                 AutomatonAbstractor(AutomatonAbstractor const&) = default;
                 AutomatonAbstractor& operator=(AutomatonAbstractor const&) = default;
@@ -132,6 +133,13 @@ namespace storm {
                  */
                 AbstractionInformation<DdType> const& getAbstractionInformation() const;
                 
+                /*!
+                 * Enumerates the solutions of all edges whose abstraction needs to be recomputed concurrently. As every
+                 * edge has its own SMT solver, this is independent of the other edges. The BDDs are then built
+                 * sequentially on the (shared) DD manager.
+                 */
+                void enumerateSolutionsInParallel();
+                
                 // A factory that can be used to create new SMT solvers.
                 std::shared_ptr<storm::utility::solver::SmtSolverFactory> smtSolverFactory;
                 
@@ -146,6 +154,9 @@ namespace storm {
                 
                 // If the automaton has more than one location, we need variables to encode that.
                 boost::optional<std::pair<storm::expressions::Variable, storm::expressions::Variable>> locationVariables;
+                
+                // The number of threads used to recompute the abstractions of the edges.
+                uint64_t numberOfThreads;
             };
         }
     }
@@ -73,8 +73,9 @@ namespace storm {
                 restrictToValidBlocks = settings.getValidBlockMode() == storm::settings::modules::AbstractionSettings::ValidBlockMode::BlockEnumeration;
                 bool addPredicatesForValidBlocks = !restrictToValidBlocks;
                 bool debug = settings.isDebugSet();
+                uint64_t numberOfThreads = settings.getNumberOfThreads();
                 for (auto const& automaton : model.getAutomata()) {
-                    automata.emplace_back(automaton, abstractionInformation, this->smtSolverFactory, useDecomposition, addPredicatesForValidBlocks, debug);
+                    automata.emplace_back(automaton, abstractionInformation, this->smtSolverFactory, useDecomposition, addPredicatesForValidBlocks, debug, numberOfThreads);
                 }
                 
                 // Retrieve global BDDs/ADDs so we can multiply them in the abstraction process.
@@ -23,7 +23,7 @@ namespace storm {
     namespace abstraction {
         namespace prism {
             template <storm::dd::DdType DdType, typename ValueType>
-            CommandAbstractor<DdType, ValueType>::CommandAbstractor(storm::prism::Command const& command, AbstractionInformation<DdType>& abstractionInformation, std::shared_ptr<storm::utility::solver::SmtSolverFactory> const& smtSolverFactory, bool useDecomposition, bool addPredicatesForValidBlocks, bool debug) : smtSolver(smtSolverFactory->create(abstractionInformation.getExpressionManager())), abstractionInformation(abstractionInformation), command(command), localExpressionInformation(abstractionInformation), evaluator(abstractionInformation.getExpressionManager()), relevantPredicatesAndVariables(), cachedDd(abstractionInformation.getDdManager().getBddZero(), 0), decisionVariables(), useDecomposition(useDecomposition), addPredicatesForValidBlocks(addPredicatesForValidBlocks), skipBottomStates(false), forceRecomputation(true), abstractGuard(abstractionInformation.getDdManager().getBddZero()), bottomStateAbstractor(abstractionInformation, {!command.getGuardExpression()}, smtSolverFactory), debug(debug) {
+            CommandAbstractor<DdType, ValueType>::CommandAbstractor(storm::prism::Command const& command, AbstractionInformation<DdType>& abstractionInformation, std::shared_ptr<storm::utility::solver::SmtSolverFactory> const& smtSolverFactory, bool useDecomposition, bool addPredicatesForValidBlocks, bool debug) : smtSolver(smtSolverFactory->create(abstractionInformation.getExpressionManager())), abstractionInformation(abstractionInformation), command(command), localExpressionInformation(abstractionInformation), evaluator(abstractionInformation.getExpressionManager()), relevantPredicatesAndVariables(), cachedDd(abstractionInformation.getDdManager().getBddZero(), 0), useDecomposition(useDecomposition), addPredicatesForValidBlocks(addPredicatesForValidBlocks), skipBottomStates(false), forceRecomputation(true), solutionsEnumerated(false), abstractGuardBuilt(false), abstractGuard(abstractionInformation.getDdManager().getBddZero()), bottomStateAbstractor(abstractionInformation, {!command.getGuardExpression()}, smtSolverFactory), debug(debug) {
                 
                 // Make the second component of relevant predicates have the right size.
                 relevantPredicatesAndVariables.second.resize(command.getNumberOfUpdates());
@@ -65,6 +65,7 @@ namespace storm {
                 bool relevantPredicatesChanged = this->relevantPredicatesChanged(newRelevantPredicates);
                 if (relevantPredicatesChanged) {
                     addMissingPredicates(newRelevantPredicates);
+                    solutionsEnumerated = false;
                 }
                 forceRecomputation |= relevantPredicatesChanged;
                 
@@ -92,20 +93,89 @@ namespace storm {
                 return assignedVariables;
             }
             
+            template <storm::dd::DdType DdType, typename ValueType>
+            bool CommandAbstractor<DdType, ValueType>::isRecomputationRequired() const {
+                return forceRecomputation;
+            }
+            
+            template <storm::dd::DdType DdType, typename ValueType>
+            void CommandAbstractor<DdType, ValueType>::enumerateSolutions(bool concurrently) {
+                if (!forceRecomputation || solutionsEnumerated) {
+                    return;
+                }
+                
+                guardSolutions = boost::none;
+                abstractGuardBuilt = false;
+                blockSolutions.clear();
+                if (useDecomposition) {
+                    enumerateSolutionsWithDecomposition(concurrently);
+                } else {
+                    enumerateSolutionsWithoutDecomposition();
+                }
+                solutionsEnumerated = true;
+            }
+            
             template <storm::dd::DdType DdType, typename ValueType>
             void CommandAbstractor<DdType, ValueType>::recomputeCachedBdd() {
+                auto start = std::chrono::high_resolution_clock::now();
+                
+                // If the solutions were not enumerated beforehand (possibly concurrently with other commands), we do so now.
+                enumerateSolutions();
+                
+                uint64_t numberOfTotalSolutions = 0;
+                for (auto const& solutions : blockSolutions) {
+                    numberOfTotalSolutions += solutions.solutions.size();
+                }
+                
                 if (useDecomposition) {
                     recomputeCachedBddWithDecomposition();
                 } else {
                     recomputeCachedBddWithoutDecomposition();
                 }
+                
+                // Drop the solutions as they are now reflected by the cached BDD.
+                guardSolutions = boost::none;
+                abstractGuardBuilt = false;
+                blockSolutions.clear();
+                solutionsEnumerated = false;
+                forceRecomputation = false;
+                
+                auto end = std::chrono::high_resolution_clock::now();
+                STORM_LOG_TRACE("Enumerated " << numberOfTotalSolutions << " solutions in " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms.");
             }
             
             template <storm::dd::DdType DdType, typename ValueType>
-            void CommandAbstractor<DdType, ValueType>::recomputeCachedBddWithDecomposition() {
-                STORM_LOG_TRACE("Recomputing BDD for command " << command.get() << " [with index " << command.get().getGlobalIndex() << "] using the decomposition.");
-                auto start = std::chrono::high_resolution_clock::now();
+            typename CommandAbstractor<DdType, ValueType>::EnumeratedSolutions CommandAbstractor<DdType, ValueType>::allSat(std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> const& sourceVariablesAndPredicates, std::vector<std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>>> const& destinationVariablesAndPredicates) {
+                EnumeratedSolutions result;
+                result.sourceVariablesAndPredicates = sourceVariablesAndPredicates;
+                result.destinationVariablesAndPredicates = destinationVariablesAndPredicates;
                 
+                std::vector<storm::expressions::Variable> decisionVariables;
+                for (auto const& element : sourceVariablesAndPredicates) {
+                    decisionVariables.push_back(element.first);
+                }
+                for (auto const& destination : destinationVariablesAndPredicates) {
+                    for (auto const& element : destination) {
+                        decisionVariables.push_back(element.first);
+                    }
+                }
+                
+                smtSolver->allSat(decisionVariables, [&result,&decisionVariables] (storm::solver::SmtSolver::ModelReference const& model) {
+                    storm::storage::BitVector solution(decisionVariables.size());
+                    for (uint64_t index = 0; index < decisionVariables.size(); ++index) {
+                        if (model.getBooleanValue(decisionVariables[index])) {
+                            solution.set(index);
+                        }
+                    }
+                    result.solutions.push_back(std::move(solution));
+                    return true;
+                });
+                
+                return result;
+            }
+            
+            template <storm::dd::DdType DdType, typename ValueType>
+            void CommandAbstractor<DdType, ValueType>::enumerateSolutionsWithDecomposition(bool concurrently) {
                 // compute a decomposition of the command
                 //  * start with all relevant blocks: blocks of assignment variables and variables in the rhs of assignments
                 //  * go through all assignments of all updates and merge relevant blocks that are related via an assignment
@@ -246,27 +316,16 @@ namespace storm {
                     }
                 }
                 
-                uint64_t numberOfSolutions = 0;
-                uint64_t numberOfTotalSolutions = 0;
-                
                 // If we need to enumerate the guard, do it only once now.
                 if (enumerateAbstractGuard) {
                     std::set<uint64_t> relatedGuardPredicates = localExpressionInformation.getRelatedExpressions(variablesContainedInGuard);
-                    std::vector<storm::expressions::Variable> guardDecisionVariables;
                     std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> guardVariablesAndPredicates;
                     for (auto const& element : relevantPredicatesAndVariables.first) {
                         if (relatedGuardPredicates.find(element.second) != relatedGuardPredicates.end()) {
-                            guardDecisionVariables.push_back(element.first);
                             guardVariablesAndPredicates.push_back(element);
                         }
                     }
-                    abstractGuard = this->getAbstractionInformation().getDdManager().getBddZero();
-                    smtSolver->allSat(guardDecisionVariables, [this,&guardVariablesAndPredicates,&numberOfSolutions] (storm::solver::SmtSolver::ModelReference const& model) {
-                        abstractGuard |= getSourceStateBdd(model, guardVariablesAndPredicates);
-                        ++numberOfSolutions;
-                        return true;
-                    });
-                    STORM_LOG_TRACE("Enumerated " << numberOfSolutions << " solutions for abstract guard.");
+                    guardSolutions = allSat(guardVariablesAndPredicates, {});
                     
                     // Now that we have the abstract guard, we can add it as an assertion to the solver before enumerating
                     // the other solutions.
@@ -274,24 +333,41 @@ namespace storm {
                     // Create a new backtracking point before adding the guard.
                     smtSolver->push();
                     
-                    // Create the guard constraint.
-                    std::pair<std::vector<storm::expressions::Expression>, std::unordered_map<uint_fast64_t, storm::expressions::Variable>> result = abstractGuard.toExpression(this->getAbstractionInformation().getExpressionManager());
-                    
-                    // Then add it to the solver.
-                    for (auto const& expression : result.first) {
-                        smtSolver->add(expression);
-                    }
-                    
-                    // Finally associate the level variables with the predicates.
-                    for (auto const& indexVariablePair : result.second) {
-                        smtSolver->add(storm::expressions::iff(indexVariablePair.second, this->getAbstractionInformation().getPredicateForDdVariableIndex(indexVariablePair.first)));
+                    if (concurrently) {
+                        // Since the DD manager must not be touched here, we add the disjunction of the guard solutions
+                        // rather than the (more compact) expression of the abstract guard BDD.
+                        storm::expressions::Expression guardConstraint = this->getAbstractionInformation().getExpressionManager().boolean(false);
+                        for (auto const& solution : guardSolutions.get().solutions) {
+                            storm::expressions::Expression solutionConstraint = this->getAbstractionInformation().getExpressionManager().boolean(true);
+                            for (uint64_t index = 0; index < guardVariablesAndPredicates.size(); ++index) {
+                                if (solution.get(index)) {
+                                    solutionConstraint = solutionConstraint && guardVariablesAndPredicates[index].first.getExpression();
+                                } else {
+                                    solutionConstraint = solutionConstraint && !guardVariablesAndPredicates[index].first.getExpression();
+                                }
+                            }
+                            guardConstraint = guardConstraint || solutionConstraint;
+                        }
+                        smtSolver->add(guardConstraint);
+                    } else {
+                        buildAbstractGuard();
+                        
+                        // Create the guard constraint.
+                        std::pair<std::vector<storm::expressions::Expression>, std::unordered_map<uint_fast64_t, storm::expressions::Variable>> result = abstractGuard.toExpression(this->getAbstractionInformation().getExpressionManager());
+                        
+                        // Then add it to the solver.
+                        for (auto const& expression : result.first) {
+                            smtSolver->add(expression);
+                        }
+                        
+                        // Finally associate the level variables with the predicates.
+                        for (auto const& indexVariablePair : result.second) {
+                            smtSolver->add(storm::expressions::iff(indexVariablePair.second, this->getAbstractionInformation().getPredicateForDdVariableIndex(indexVariablePair.first)));
+                        }
                     }
                 }
                 
                 // Then enumerate the solutions for each of the blocks of the decomposition.
-                uint64_t usedNondeterminismVariables = 0;
-                uint64_t blockCounter = 0;
-                std::vector<storm::dd::Bdd<DdType>> blockBdds;
                 for (auto const& block : relevantBlockPartition) {
                     std::set<uint64_t> relevantPredicates;
                     for (auto const& innerBlock : block) {
@@ -303,11 +379,9 @@ namespace storm {
                         continue;
                     }
                     
-                    std::vector<storm::expressions::Variable> transitionDecisionVariables;
                     std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> sourceVariablesAndPredicates;
                     for (auto const& element : relevantPredicatesAndVariables.first) {
                         if (relevantPredicates.find(element.second) != relevantPredicates.end()) {
-                            transitionDecisionVariables.push_back(element.first);
                             sourceVariablesAndPredicates.push_back(element);
                         }
                     }
@@ -323,22 +397,54 @@ namespace storm {
                                 for (auto const& element : relevantPredicatesAndVariables.second[updateIndex]) {
                                     if (assignmentVariableBlock.find(element.second) != assignmentVariableBlock.end()) {
                                         destinationVariablesAndPredicates.back().push_back(element);
-                                        transitionDecisionVariables.push_back(element.first);
                                     }
                                 }
                             }
                         }
                     }
                     
+                    blockSolutions.push_back(allSat(sourceVariablesAndPredicates, destinationVariablesAndPredicates));
+                }
+                
+                if (enumerateAbstractGuard) {
+                    smtSolver->pop();
+                }
+            }
+            
+            template <storm::dd::DdType DdType, typename ValueType>
+            void CommandAbstractor<DdType, ValueType>::buildAbstractGuard() {
+                abstractGuard = this->getAbstractionInformation().getDdManager().getBddZero();
+                for (auto const& solution : guardSolutions.get().solutions) {
+                    abstractGuard |= getSourceStateBdd(solution, guardSolutions.get().sourceVariablesAndPredicates);
+                }
+                abstractGuardBuilt = true;
+                STORM_LOG_TRACE("Enumerated " << guardSolutions.get().solutions.size() << " solutions for abstract guard.");
+            }
+            
+            template <storm::dd::DdType DdType, typename ValueType>
+            void CommandAbstractor<DdType, ValueType>::enumerateSolutionsWithoutDecomposition() {
+                blockSolutions.push_back(allSat(relevantPredicatesAndVariables.first, relevantPredicatesAndVariables.second));
+            }
+            
+            template <storm::dd::DdType DdType, typename ValueType>
+            void CommandAbstractor<DdType, ValueType>::recomputeCachedBddWithDecomposition() {
+                STORM_LOG_TRACE("Recomputing BDD for command " << command.get() << " [with index " << command.get().getGlobalIndex() << "] using the decomposition.");
+                
+                // If we enumerated the guard concurrently, build its BDD now.
+                if (guardSolutions && !abstractGuardBuilt) {
+                    buildAbstractGuard();
+                }
+                
+                // Then build the BDDs for each of the blocks of the decomposition.
+                uint64_t usedNondeterminismVariables = 0;
+                uint64_t blockCounter = 0;
+                std::vector<storm::dd::Bdd<DdType>> blockBdds;
+                for (auto const& solutions : blockSolutions) {
                     std::unordered_map<storm::dd::Bdd<DdType>, std::vector<storm::dd::Bdd<DdType>>> sourceToDistributionsMap;
-                    numberOfSolutions = 0;
-                    smtSolver->allSat(transitionDecisionVariables, [&sourceToDistributionsMap,this,&numberOfSolutions,&sourceVariablesAndPredicates,&destinationVariablesAndPredicates] (storm::solver::SmtSolver::ModelReference const& model) {
-                        sourceToDistributionsMap[getSourceStateBdd(model, sourceVariablesAndPredicates)].push_back(getDistributionBdd(model, destinationVariablesAndPredicates));
-                        ++numberOfSolutions;
-                        return true;
-                    });
-                    STORM_LOG_TRACE("Enumerated " << numberOfSolutions << " solutions for block " << blockCounter << ".");
-                    numberOfTotalSolutions += numberOfSolutions;
+                    for (auto const& solution : solutions.solutions) {
+                        sourceToDistributionsMap[getSourceStateBdd(solution, solutions.sourceVariablesAndPredicates)].push_back(getDistributionBdd(solution, solutions.sourceVariablesAndPredicates.size(), solutions.destinationVariablesAndPredicates));
+                    }
+                    STORM_LOG_TRACE("Enumerated " << solutions.solutions.size() << " solutions for block " << blockCounter << ".");
                     
                     // Now we search for the maximal number of choices of player 2 to determine how many DD variables we
                     // need to encode the nondeterminism.
@@ -375,10 +481,6 @@ namespace storm {
                     ++blockCounter;
                 }
                 
-                if (enumerateAbstractGuard) {
-                    smtSolver->pop();
-                }
-                
                 // multiply the results
                 storm::dd::Bdd<DdType> resultBdd = getAbstractionInformation().getDdManager().getBddOne();
                 uint64_t blockIndex = 0;
@@ -388,7 +490,7 @@ namespace storm {
                 }
                 
                 // If we did not explicitly enumerate the guard, we can construct it from the result BDD.
-                if (!enumerateAbstractGuard) {
+                if (!guardSolutions) {
                     std::set<storm::expressions::Variable> allVariables(getAbstractionInformation().getSuccessorVariables());
                     auto player2Variables = getAbstractionInformation().getPlayer2VariableSet(usedNondeterminismVariables);
                     allVariables.insert(player2Variables.begin(), player2Variables.end());
@@ -412,26 +514,18 @@ namespace storm {
                 
                 // Cache the result.
                 cachedDd = GameBddResult<DdType>(resultBdd, usedNondeterminismVariables);
-                
-                auto end = std::chrono::high_resolution_clock::now();
-                
-                STORM_LOG_TRACE("Enumerated " << numberOfTotalSolutions << " solutions in " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms.");
-                forceRecomputation = false;
             }
             
             template <storm::dd::DdType DdType, typename ValueType>
             void CommandAbstractor<DdType, ValueType>::recomputeCachedBddWithoutDecomposition() {
                 STORM_LOG_TRACE("Recomputing BDD for command " << command.get());
-                auto start = std::chrono::high_resolution_clock::now();
                 
                 // Create a mapping from source state DDs to their distributions.
                 std::unordered_map<storm::dd::Bdd<DdType>, std::vector<storm::dd::Bdd<DdType>>> sourceToDistributionsMap;
-                uint64_t numberOfSolutions = 0;
-                smtSolver->allSat(decisionVariables, [&sourceToDistributionsMap,this,&numberOfSolutions] (storm::solver::SmtSolver::ModelReference const& model) {
-                    sourceToDistributionsMap[getSourceStateBdd(model, relevantPredicatesAndVariables.first)].push_back(getDistributionBdd(model, relevantPredicatesAndVariables.second));
-                    ++numberOfSolutions;
-                    return true;
-                });
+                EnumeratedSolutions const& solutions = blockSolutions.front();
+                for (auto const& solution : solutions.solutions) {
+                    sourceToDistributionsMap[getSourceStateBdd(solution, solutions.sourceVariablesAndPredicates)].push_back(getDistributionBdd(solution, solutions.sourceVariablesAndPredicates.size(), solutions.destinationVariablesAndPredicates));
+                }
                 
                 // Now we search for the maximal number of choices of player 2 to determine how many DD variables we
                 // need to encode the nondeterminism.
@@ -474,10 +568,6 @@ namespace storm {
                 
                 // Cache the result.
                 cachedDd = GameBddResult<DdType>(resultBdd, numberOfVariablesNeeded);
-                auto end = std::chrono::high_resolution_clock::now();
-                
-                STORM_LOG_TRACE("Enumerated " << numberOfSolutions << " solutions in " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms.");
-                forceRecomputation = false;
             }
             
             template <storm::dd::DdType DdType, typename ValueType>
@@ -556,7 +646,6 @@ namespace storm {
                 for (auto const& element : newSourceVariables) {
                     allRelevantPredicates.insert(element.second);
                     smtSolver->add(storm::expressions::iff(element.first, this->getAbstractionInformation().getPredicateByIndex(element.second)));
-                    decisionVariables.push_back(element.first);
                 }
                 
                 // Insert the new variables into the record of relevant source variables.
@@ -569,7 +658,6 @@ namespace storm {
                     for (auto const& element : newSuccessorVariables) {
                         allRelevantPredicates.insert(element.second);
                         smtSolver->add(storm::expressions::iff(element.first, this->getAbstractionInformation().getPredicateByIndex(element.second).substitute(command.get().getUpdate(index).getAsVariableToExpressionMap())));
-                        decisionVariables.push_back(element.first);
                     }
                     
                     relevantPredicatesAndVariables.second[index].insert(relevantPredicatesAndVariables.second[index].end(), newSuccessorVariables.begin(), newSuccessorVariables.end());
@@ -578,11 +666,11 @@ namespace storm {
             }
             
             template <storm::dd::DdType DdType, typename ValueType>
-            storm::dd::Bdd<DdType> CommandAbstractor<DdType, ValueType>::getSourceStateBdd(storm::solver::SmtSolver::ModelReference const& model, std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> const& variablePredicates) const {
+            storm::dd::Bdd<DdType> CommandAbstractor<DdType, ValueType>::getSourceStateBdd(storm::storage::BitVector const& solution, std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> const& variablePredicates) const {
                 storm::dd::Bdd<DdType> result = this->getAbstractionInformation().getDdManager().getBddOne();
-                for (auto variableIndexPairIt = variablePredicates.rbegin(), variableIndexPairIte = variablePredicates.rend(); variableIndexPairIt != variableIndexPairIte; ++variableIndexPairIt) {
-                    auto const& variableIndexPair = *variableIndexPairIt;
-                    if (model.getBooleanValue(variableIndexPair.first)) {
+                for (uint64_t index = variablePredicates.size(); index > 0; --index) {
+                    auto const& variableIndexPair = variablePredicates[index - 1];
+                    if (solution.get(index - 1)) {
                         result &= this->getAbstractionInformation().encodePredicateAsSource(variableIndexPair.second);
                     } else {
                         result &= !this->getAbstractionInformation().encodePredicateAsSource(variableIndexPair.second);
@@ -594,21 +682,22 @@ namespace storm {
             }
             
             template <storm::dd::DdType DdType, typename ValueType>
-            storm::dd::Bdd<DdType> CommandAbstractor<DdType, ValueType>::getDistributionBdd(storm::solver::SmtSolver::ModelReference const& model, std::vector<std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>>> const& variablePredicates) const {
+            storm::dd::Bdd<DdType> CommandAbstractor<DdType, ValueType>::getDistributionBdd(storm::storage::BitVector const& solution, uint64_t offset, std::vector<std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>>> const& variablePredicates) const {
                 storm::dd::Bdd<DdType> result = this->getAbstractionInformation().getDdManager().getBddZero();
                 
                 for (uint_fast64_t updateIndex = 0; updateIndex < command.get().getNumberOfUpdates(); ++updateIndex) {
                     storm::dd::Bdd<DdType> updateBdd = this->getAbstractionInformation().getDdManager().getBddOne();
                     
                     // Translate block variables for this update into a successor block.
-                    for (auto variableIndexPairIt = variablePredicates[updateIndex].rbegin(), variableIndexPairIte = variablePredicates[updateIndex].rend(); variableIndexPairIt != variableIndexPairIte; ++variableIndexPairIt) {
-                        auto const& variableIndexPair = *variableIndexPairIt;
-                        if (model.getBooleanValue(variableIndexPair.first)) {
+                    for (uint64_t index = variablePredicates[updateIndex].size(); index > 0; --index) {
+                        auto const& variableIndexPair = variablePredicates[updateIndex][index - 1];
+                        if (solution.get(offset + index - 1)) {
                             updateBdd &= this->getAbstractionInformation().encodePredicateAsSuccessor(variableIndexPair.second);
                         } else {
                             updateBdd &= !this->getAbstractionInformation().encodePredicateAsSuccessor(variableIndexPair.second);
                         }
                     }
+                    offset += variablePredicates[updateIndex].size();
 
                     updateBdd &= this->getAbstractionInformation().encodeAux(updateIndex, 0, this->getAbstractionInformation().getAuxVariableCount());
                     result |= updateBdd;
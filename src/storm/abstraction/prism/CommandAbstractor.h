@@ -5,12 +5,15 @@
 #include <set>
 #include <map>
 
+#include <boost/optional.hpp>
+
 #include "storm/abstraction/LocalExpressionInformation.h"
 #include "storm/abstraction/StateSetAbstractor.h"
 #include "storm/abstraction/GameBddResult.h"
 
 #include "storm/storage/expressions/ExpressionEvaluator.h"
 
+#include "storm/storage/BitVector.h"
 #include "storm/storage/dd/DdType.h"
 #include "storm/storage/expressions/Expression.h"
 
@@ -94,6 +97,21 @@ namespace storm {
                  */
                 GameBddResult<DdType> abstract();
                 
+                /*!
+                 * Retrieves whether the next call to abstract() needs to recompute the abstraction of the command.
+                 */
+                bool isRecomputationRequired() const;
+                
+                /*!
+                 * Enumerates the solutions needed to recompute the abstraction of the command (if a recomputation is
+                 * required). If the enumeration is done concurrently, it only involves the SMT solver of this command and
+                 * not the DD manager. Hence, it may then be called concurrently for different commands. The next call to
+                 * abstract() then builds the BDD from the enumerated solutions.
+                 *
+                 * @param concurrently If true, the DD manager is not used during the enumeration.
+                 */
+                void enumerateSolutions(bool concurrently = false);
+                
                 /*!
                  * Retrieves the transitions to bottom states of this command.
                  *
@@ -120,6 +138,16 @@ namespace storm {
                 void notifyGuardIsPredicate();
                 
             private:
+                /*!
+                 * The solutions of an all-SAT enumeration. Every solution holds the values of the source variables
+                 * followed by the values of the successor variables of all updates (in this order).
+                 */
+                struct EnumeratedSolutions {
+                    std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> sourceVariablesAndPredicates;
+                    std::vector<std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>>> destinationVariablesAndPredicates;
+                    std::vector<storm::storage::BitVector> solutions;
+                };
+                
                 /*!
                  * Determines the relevant predicates for source as well as successor states wrt. to the given assignments
                  * (that, for example, form an update).
@@ -154,20 +182,45 @@ namespace storm {
                 void addMissingPredicates(std::pair<std::set<uint_fast64_t>, std::vector<std::set<uint_fast64_t>>> const& newRelevantPredicates);
                 
                 /*!
-                 * Translates the given model to a source state DD.
+                 * Translates the given solution to a source state DD.
                  *
-                 * @param model The model to translate.
+                 * @param solution The solution to translate.
+                 * @param variablePredicates The source variables whose values are given by the first bits of the solution.
                  * @return The source state encoded as a DD.
                  */
-                storm::dd::Bdd<DdType> getSourceStateBdd(storm::solver::SmtSolver::ModelReference const& model, std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> const& variablePredicates) const;
+                storm::dd::Bdd<DdType> getSourceStateBdd(storm::storage::BitVector const& solution, std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> const& variablePredicates) const;
 
                 /*!
-                 * Translates the given model to a distribution over successor states.
+                 * Translates the given solution to a distribution over successor states.
                  *
-                 * @param model The model to translate.
-                 * @return The source state encoded as a DD.
+                 * @param solution The solution to translate.
+                 * @param offset The position of the value of the first successor variable in the solution.
+                 * @param variablePredicates The successor variables of all updates.
+                 * @return The distribution encoded as a DD.
+                 */
+                storm::dd::Bdd<DdType> getDistributionBdd(storm::storage::BitVector const& solution, uint64_t offset, std::vector<std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>>> const& variablePredicates) const;
+                
+                /*!
+                 * Enumerates all solutions over the given source and successor variables.
                  */
-                storm::dd::Bdd<DdType> getDistributionBdd(storm::solver::SmtSolver::ModelReference const& model, std::vector<std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>>> const& variablePredicates) const;
+                EnumeratedSolutions allSat(std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> const& sourceVariablesAndPredicates, std::vector<std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>>> const& destinationVariablesAndPredicates);
+                
+                /*!
+                 * Enumerates the solutions of the abstraction without using the decomposition.
+                 */
+                void enumerateSolutionsWithoutDecomposition();
+                
+                /*!
+                 * Enumerates the solutions of the abstraction using the decomposition.
+                 *
+                 * @param concurrently If true, the DD manager is not used during the enumeration.
+                 */
+                void enumerateSolutionsWithDecomposition(bool concurrently);
+                
+                /*!
+                 * Builds the abstract guard from its enumerated solutions.
+                 */
+                void buildAbstractGuard();
                 
                 /*!
                  * Recomputes the cached BDD. This needs to be triggered if any relevant predicates change.
@@ -175,12 +228,12 @@ namespace storm {
                 void recomputeCachedBdd();
                 
                 /*!
-                 * Recomputes the cached BDD without using the decomposition.
+                 * Recomputes the cached BDD from the enumerated solutions without using the decomposition.
                  */
                 void recomputeCachedBddWithoutDecomposition();
                 
                 /*!
-                 * Recomputes the cached BDD using th decomposition.
+                 * Recomputes the cached BDD from the enumerated solutions using th decomposition.
                  */
                 void recomputeCachedBddWithDecomposition();
 
@@ -241,9 +294,6 @@ namespace storm {
                 // predicates, this result may be reused.
                 GameBddResult<DdType> cachedDd;
                 
-                // All relevant decision variables over which to perform AllSat.
-                std::vector<storm::expressions::Variable> decisionVariables;
-                
                 // A flag indicating whether to use the decomposition when abstracting.
                 bool useDecomposition;
                 
@@ -257,6 +307,19 @@ namespace storm {
                 // A flag remembering whether we need to force recomputation of the BDD.
                 bool forceRecomputation;
                 
+                // A flag indicating whether the solutions for the recomputation were already enumerated.
+                bool solutionsEnumerated;
+                
+                // The enumerated solutions of the abstract guard (if the guard needs to be enumerated separately).
+                boost::optional<EnumeratedSolutions> guardSolutions;
+                
+                // A flag indicating whether the abstract guard was already built from the enumerated guard solutions.
+                bool abstractGuardBuilt;
+                
+                // The enumerated solutions of all blocks of the decomposition (or of the whole command if the
+                // decomposition is not used).
+                std::vector<EnumeratedSolutions> blockSolutions;
+                
                 // The abstract guard of the command. This is only used if the guard is not a predicate, because it can
                 // then be used to constrain the bottom state abstractor.
                 storm::dd::Bdd<DdType> abstractGuard;
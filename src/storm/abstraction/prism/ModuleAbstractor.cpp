@@ -1,5 +1,9 @@
 #include "storm/abstraction/prism/ModuleAbstractor.h"
 
+#include <atomic>
+#include <exception>
+#include <thread>
+
 #include "storm/abstraction/BottomStateResult.h"
 #include "storm/abstraction/AbstractionInformation.h"
 #include "storm/abstraction/GameBddResult.h"
@@ -23,7 +27,7 @@ namespace storm {
             using storm::settings::modules::AbstractionSettings;
             
             template <storm::dd::DdType DdType, typename ValueType>
-            ModuleAbstractor<DdType, ValueType>::ModuleAbstractor(storm::prism::Module const& module, AbstractionInformation<DdType>& abstractionInformation, std::shared_ptr<storm::utility::solver::SmtSolverFactory> const& smtSolverFactory, bool useDecomposition, bool addPredicatesForValidBlocks, bool debug) : smtSolverFactory(smtSolverFactory), abstractionInformation(abstractionInformation), commands(), module(module) {
+            ModuleAbstractor<DdType, ValueType>::ModuleAbstractor(storm::prism::Module const& module, AbstractionInformation<DdType>& abstractionInformation, std::shared_ptr<storm::utility::solver::SmtSolverFactory> const& smtSolverFactory, bool useDecomposition, bool addPredicatesForValidBlocks, bool debug, uint64_t numberOfThreads) : smtSolverFactory(smtSolverFactory), abstractionInformation(abstractionInformation), commands(), module(module), numberOfThreads(numberOfThreads) {
                 
                 // For each concrete command, we create an abstract counterpart.
                 for (auto const& command : module.getCommands()) {
@@ -61,6 +65,11 @@ namespace storm {
             
             template <storm::dd::DdType DdType, typename ValueType>
             GameBddResult<DdType> ModuleAbstractor<DdType, ValueType>::abstract() {
+                // If requested, the expensive part of recomputing the abstractions of the commands is done concurrently.
+                if (numberOfThreads > 1) {
+                    enumerateSolutionsInParallel();
+                }
+                
                 // First, we retrieve the abstractions of all commands.
                 std::vector<GameBddResult<DdType>> commandDdsAndUsedOptionVariableCounts;
                 uint_fast64_t maximalNumberOfUsedOptionVariables = 0;
@@ -78,6 +87,47 @@ namespace storm {
                 return GameBddResult<DdType>(result, maximalNumberOfUsedOptionVariables);
             }
             
+            template <storm::dd::DdType DdType, typename ValueType>
+            void ModuleAbstractor<DdType, ValueType>::enumerateSolutionsInParallel() {
+                std::vector<uint64_t> commandsToRecompute;
+                for (uint64_t index = 0; index < commands.size(); ++index) {
+                    if (commands[index].isRecomputationRequired()) {
+                        commandsToRecompute.push_back(index);
+                    }
+                }
+                
+                uint64_t numberOfWorkers = std::min<uint64_t>(numberOfThreads, commandsToRecompute.size());
+                if (numberOfWorkers <= 1) {
+                    return;
+                }
+                STORM_LOG_TRACE("Enumerating solutions of " << commandsToRecompute.size() << " commands using " << numberOfWorkers << " threads.");
+                
+                // The workers take the next command from a shared counter until all commands are handled.
+                std::atomic<uint64_t> nextCommand(0);
+                std::vector<std::exception_ptr> exceptions(numberOfWorkers);
+                std::vector<std::thread> workers;
+                for (uint64_t worker = 0; worker < numberOfWorkers; ++worker) {
+                    workers.emplace_back([this, worker, &commandsToRecompute, &nextCommand, &exceptions] () {
+                        try {
+                            for (uint64_t index = nextCommand++; index < commandsToRecompute.size(); index = nextCommand++) {
+                                commands[commandsToRecompute[index]].enumerateSolutions(true);
+                            }
+                        } catch (...) {
+                            exceptions[worker] = std::current_exception();
+                        }
+                    });
+                }
+                for (auto& worker : workers) {
+                    worker.join();
+                }
+                
+                for (auto const& exception : exceptions) {
+                    if (exception) {
+                        std::rethrow_exception(exception);
+                    }
+                }
+            }
+            
             template <storm::dd::DdType DdType, typename ValueType>
             BottomStateResult<DdType> ModuleAbstractor<DdType, ValueType>::getBottomStateTransitions(storm::dd::Bdd<DdType> const& reachableStates, uint_fast64_t numberOfPlayer2Variables) {
                 BottomStateResult<DdType> result(this->getAbstractionInformation().getDdManager().getBddZero(), this->getAbstractionInformation().getDdManager().getBddZero());
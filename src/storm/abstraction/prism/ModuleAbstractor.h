@@ -37,8 +37,9 @@ namespace storm {
                  * @param abstractionInformation An object holding information about the abstraction such as predicates and BDDs.
                  * @param smtSolverFactory A factory that is to be used for creating new SMT solvers.
                  * @param useDecomposition A flag that governs whether to use the decomposition in the abstraction.
+                 * @param numberOfThreads The number of threads used to recompute the abstractions of the commands.
                  */
-                ModuleAbstractor(storm::prism::Module const& module, AbstractionInformation<DdType>& abstractionInformation, std::shared_ptr<storm::utility::solver::SmtSolverFactory> const& smtSolverFactory, bool useDecomposition, bool addPredicatesForValidBlocks, bool debug);
+                ModuleAbstractor(storm::prism::Module const& module, AbstractionInformation<DdType>& abstractionInformation, std::shared_ptr<storm::utility::solver::SmtSolverFactory> const& smtSolverFactory, bool useDecomposition, bool addPredicatesForValidBlocks, bool debug, uint64_t numberOfThreads = 1);
                 
                 ModuleAbstractor(ModuleAbstractor const&) = default;
                 ModuleAbstractor& operator=(ModuleAbstractor const&) = default;
@@ -123,6 +124,13 @@ namespace storm {
                  */
                 AbstractionInformation<DdType> const& getAbstractionInformation() const;
                 
+                /*!
+                 * Enumerates the solutions of all commands whose abstraction needs to be recomputed concurrently. As
+                 * every command has its own SMT solver, this is independent of the other commands. The BDDs are then
+                 * built sequentially on the (shared) DD manager.
+                 */
+                void enumerateSolutionsInParallel();
+                
                 // A factory that can be used to create new SMT solvers.
                 std::shared_ptr<storm::utility::solver::SmtSolverFactory> smtSolverFactory;
                 
@@ -134,6 +142,9 @@ namespace storm {
                 
                 // The concrete module this abstract module refers to.
                 std::reference_wrapper<storm::prism::Module const> module;
+                
+                // The number of threads used to recompute the abstractions of the commands.
+                uint64_t numberOfThreads;
             };
         }
     }
@@ -87,7 +87,9 @@ namespace storm {
 
                 storm::builder::jit::ExplicitJitJaniModelBuilder<ValueType> builder(model.asJaniModel(), options);
 
-                if (doctor) {
+                if (doctor && builder.isCompiledLibraryCached()) {
+                    STORM_LOG_INFO("Skipping the checks of the JIT-based model builder, because a compiled builder for the model was found in the cache.");
+                } else if (doctor) {
                     bool result = builder.doctor();
                     STORM_LOG_THROW(result, storm::exceptions::NotSupportedException, "The JIT-based model builder cannot be used on your system.");
                     STORM_LOG_INFO("The JIT-based model builder seems to be working.");
@@ -17,6 +17,8 @@
 #include "storm/modelchecker/abstraction/BisimulationAbstractionRefinementModelChecker.h"
 #include "storm/modelchecker/exploration/SparseExplorationModelChecker.h"
 #include "storm/modelchecker/reachability/SparseDtmcEliminationModelChecker.h"
+#include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 
 #include "storm/models/symbolic/Dtmc.h"
 #include "storm/models/symbolic/Mdp.h"
@@ -294,6 +296,39 @@ namespace storm {
             return verifyWithSparseEngine(env, model, task);
         }
 
+        /*!
+         * Verifies the given task and uses the given values (if any) as a hint for the result. The hint is only used
+         * if it has a value for every state of the model, so hints obtained for a model with a different state space
+         * need to be reset by the caller. Afterwards, the hint holds the result of this call if it is quantitative
+         * and available for all states and is reset otherwise.
+         */
+        template<typename ValueType>
+        std::unique_ptr<storm::modelchecker::CheckResult> verifyWithSparseEngineUsingResultHint(storm::Environment const& env, std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, boost::optional<std::vector<ValueType>>& resultHint) {
+            storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> hintedTask(task);
+            if (resultHint) {
+                STORM_LOG_WARN_COND(resultHint->size() == model->getNumberOfStates(), "Dropping result hint whose size does not match the number of states.");
+                if (resultHint->size() == model->getNumberOfStates()) {
+                    auto hint = std::make_shared<storm::modelchecker::ExplicitModelCheckerHint<ValueType>>();
+                    hint->setResultHint(resultHint.get());
+                    hintedTask.setHint(hint);
+                }
+            }
+            
+            std::unique_ptr<storm::modelchecker::CheckResult> result = verifyWithSparseEngine(env, model, hintedTask);
+            if (result && result->isExplicitQuantitativeCheckResult() && result->isResultForAllStates()) {
+                resultHint = result->template asExplicitQuantitativeCheckResult<ValueType>().getValueVector();
+            } else {
+                resultHint = boost::none;
+            }
+            return result;
+        }
+
+        template<typename ValueType>
+        std::unique_ptr<storm::modelchecker::CheckResult> verifyWithSparseEngineUsingResultHint(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, boost::optional<std::vector<ValueType>>& resultHint) {
+            Environment env;
+            return verifyWithSparseEngineUsingResultHint(env, model, task, resultHint);
+        }
+
         template<storm::dd::DdType DdType, typename ValueType>
         std::unique_ptr<storm::modelchecker::CheckResult> verifyWithHybridEngine(storm::Environment const& env, std::shared_ptr<storm::models::symbolic::Dtmc<DdType, ValueType>> const& dtmc, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
             std::unique_ptr<storm::modelchecker::CheckResult> result;
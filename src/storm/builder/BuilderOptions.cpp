@@ -1,6 +1,7 @@
 #include "storm/builder/BuilderOptions.h"
 
 #include "storm/logic/Formulas.h"
+#include "storm/logic/FragmentSpecification.h"
 #include "storm/logic/LiftableTransitionRewardsVisitor.h"
 
 #include "storm/settings/SettingsManager.h"
@@ -38,7 +39,7 @@ namespace storm {
         }
         
 
-        BuilderOptions::BuilderOptions(bool buildAllRewardModels, bool buildAllLabels) : buildAllRewardModels(buildAllRewardModels), buildAllLabels(buildAllLabels), applyMaximalProgressAssumption(false), buildChoiceLabels(false), buildStateValuations(false), buildChoiceOrigins(false), scaleAndLiftTransitionRewards(true), explorationChecks(false), inferObservationsFromActions(false), addOverlappingGuardsLabel(false), addOutOfBoundsState(false), reservedBitsForUnboundedVariables(32), showProgress(false), showProgressDelay(0) {
+        BuilderOptions::BuilderOptions(bool buildAllRewardModels, bool buildAllLabels) : buildAllRewardModels(buildAllRewardModels), buildAllLabels(buildAllLabels), applyMaximalProgressAssumption(false), buildChoiceLabels(false), buildStateValuations(false), buildChoiceOrigins(false), scaleAndLiftTransitionRewards(true), explorationChecks(false), inferObservationsFromActions(false), addOverlappingGuardsLabel(false), addOutOfBoundsState(false), applySymmetryReduction(false), applyPartialOrderReduction(false), preservedFormulasStutterInvariant(true), reservedBitsForUnboundedVariables(32), showProgress(false), showProgressDelay(0) {
             // Intentionally left empty.
         }
         
@@ -62,6 +63,8 @@ namespace storm {
                 this->setApplyMaximalProgressAssumption(modelDescription.getModelType() == storm::storage::SymbolicModelDescription::ModelType::MA);
             }
             explorationChecks = buildSettings.isExplorationChecksSet();
+            applySymmetryReduction = buildSettings.isSymmetryReductionSet();
+            applyPartialOrderReduction = buildSettings.isPartialOrderReductionSet();
             reservedBitsForUnboundedVariables = buildSettings.getBitsForUnboundedVariables();
             showProgress = generalSettings.isVerboseSet();
             showProgressDelay = generalSettings.getShowProgressDelay();
@@ -92,6 +95,13 @@ namespace storm {
             }
             
             scaleAndLiftTransitionRewards = scaleAndLiftTransitionRewards && storm::logic::LiftableTransitionRewardsVisitor(modelDescription).areTransitionRewardsLiftable(formula);
+            
+            // Formulas that count steps may change their value if invisible steps are removed from the model. Rewards
+            // are collected along the steps, so they may change as well.
+            storm::logic::FragmentSpecification stutterInvariantFragment = storm::logic::prctl();
+            stutterInvariantFragment.setNextFormulasAllowed(false).setBoundedUntilFormulasAllowed(false).setStepBoundedUntilFormulasAllowed(false).setTimeBoundedUntilFormulasAllowed(false);
+            stutterInvariantFragment.setRewardOperatorsAllowed(false).setLongRunAverageOperatorsAllowed(false);
+            preservedFormulasStutterInvariant = preservedFormulasStutterInvariant && formula.isInFragment(stutterInvariantFragment);
         }
         
         void BuilderOptions::setTerminalStatesFromFormula(storm::logic::Formula const& formula) {
@@ -209,6 +219,18 @@ namespace storm {
             return addOutOfBoundsState;
         }
         
+        bool BuilderOptions::isApplySymmetryReductionSet() const {
+            return applySymmetryReduction;
+        }
+        
+        bool BuilderOptions::isApplyPartialOrderReductionSet() const {
+            return applyPartialOrderReduction;
+        }
+        
+        bool BuilderOptions::arePreservedFormulasStutterInvariant() const {
+            return preservedFormulasStutterInvariant;
+        }
+        
         uint64_t BuilderOptions::getReservedBitsForUnboundedVariables() const {
             return reservedBitsForUnboundedVariables;
         }
@@ -312,6 +334,16 @@ namespace storm {
             addOverlappingGuardsLabel = newValue;
             return *this;
         }
+        
+        BuilderOptions& BuilderOptions::setApplySymmetryReduction(bool newValue) {
+            applySymmetryReduction = newValue;
+            return *this;
+        }
+        
+        BuilderOptions& BuilderOptions::setApplyPartialOrderReduction(bool newValue) {
+            applyPartialOrderReduction = newValue;
+            return *this;
+        }
 
         BuilderOptions& BuilderOptions::substituteExpressions(std::function<storm::expressions::Expression(storm::expressions::Expression const&)> const& substitutionFunction) {
             for (auto& e : expressionLabels) {
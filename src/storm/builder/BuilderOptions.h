@@ -114,6 +114,15 @@ namespace storm {
             bool isShowProgressSet() const;
             bool isScaleAndLiftTransitionRewardsSet() const;
             bool isAddOutOfBoundsStateSet() const;
+            bool isApplySymmetryReductionSet() const;
+            bool isApplyPartialOrderReductionSet() const;
+            
+            /*!
+             * Retrieves whether all preserved formulas are invariant under stuttering, i.e., whether they do not count
+             * steps (as next formulas and step bounds do) and do not refer to rewards. Only then, partial order
+             * reduction may remove invisible steps from the model.
+             */
+            bool arePreservedFormulasStutterInvariant() const;
             uint64_t getReservedBitsForUnboundedVariables() const;
             bool isAddOverlappingGuardLabelSet() const;
             uint64_t getShowProgressDelay() const;
@@ -197,6 +206,21 @@ namespace storm {
              */
             BuilderOptions& setAddOverlappingGuardsLabel(bool newValue = true);
 
+            /**
+             * Should states be reduced with respect to symmetric (renamed) modules. Only supported for PRISM programs.
+             * @param newValue The new value (default true)
+             * @return this
+             */
+            BuilderOptions& setApplySymmetryReduction(bool newValue = true);
+
+            /**
+             * Should the choices of MDPs be reduced to ample sets of independent and invisible commands. Only supported
+             * for PRISM programs.
+             * @param newValue The new value (default true)
+             * @return this
+             */
+            BuilderOptions& setApplyPartialOrderReduction(bool newValue = true);
+
             /**
              * Sets the number of bits that will be reserved for unbounded integer variables.
              */
@@ -256,6 +280,15 @@ namespace storm {
             /// A flag indicating that the an additional state for out of bounds should be created.
             bool addOutOfBoundsState;
 
+            /// A flag indicating whether states are reduced with respect to symmetric modules.
+            bool applySymmetryReduction;
+
+            /// A flag indicating whether partial order reduction is applied.
+            bool applyPartialOrderReduction;
+
+            /// A flag indicating whether all preserved formulas are invariant under stuttering.
+            bool preservedFormulasStutterInvariant;
+
             /// Indicates the number of bits that are reserved for the storage of unbounded integer variables.
             uint64_t reservedBitsForUnboundedVariables;
 
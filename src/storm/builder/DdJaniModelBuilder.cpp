@@ -29,11 +29,15 @@
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
+#include "storm/settings/modules/BuildSettings.h"
+
+#include "storm/builder/DdVariableOrdering.h"
 
 #include "storm/utility/macros.h"
 #include "storm/utility/jani.h"
 #include "storm/utility/dd.h"
 #include "storm/utility/math.h"
+#include "storm/utility/Profiler.h"
 #include "storm/exceptions/WrongFormatException.h"
 #include "storm/exceptions/InvalidSettingsException.h"
 #include "storm/exceptions/InvalidArgumentException.h"
@@ -327,10 +331,31 @@ namespace storm {
                     result.allNondeterminismVariables.insert(result.probabilisticNondeterminismVariable);
                 }
                 
+                // Create the meta variables for the locations and the (non-transient) variables in the order determined
+                // by the build settings.
+                std::map<storm::expressions::Variable, storm::jani::Automaton const*> locationVariableToAutomatonMap;
                 for (auto const& automatonName : this->automata) {
-                    storm::jani::Automaton const& automaton =  this->model.getAutomaton(automatonName);
+                    storm::jani::Automaton const& automaton = this->model.getAutomaton(automatonName);
+                    locationVariableToAutomatonMap.emplace(automaton.getLocationExpressionVariable(), &automaton);
+                }
+                std::map<storm::expressions::Variable, storm::jani::Variable const*> expressionVariableToVariableMap;
+                for (auto const& variable : this->model.getGlobalVariables()) {
+                    expressionVariableToVariableMap.emplace(variable.getExpressionVariable(), &variable);
+                }
+                for (auto const& automaton : this->model.getAutomata()) {
+                    for (auto const& variable : automaton.getVariables()) {
+                        expressionVariableToVariableMap.emplace(variable.getExpressionVariable(), &variable);
+                    }
+                }
+                for (auto const& expressionVariable : storm::builder::getDdVariableOrder(this->model)) {
+                    auto locationIt = locationVariableToAutomatonMap.find(expressionVariable);
+                    if (locationIt == locationVariableToAutomatonMap.end()) {
+                        createVariable(*expressionVariableToVariableMap.at(expressionVariable), result);
+                        continue;
+                    }
+                    storm::jani::Automaton const& automaton = *locationIt->second;
                     
-                    // Start by creating a meta variable for the location of the automaton.
+                    // Create a meta variable for the location of the automaton.
                     storm::expressions::Variable locationExpressionVariable = automaton.getLocationExpressionVariable();
                     std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = result.manager->addMetaVariable("l_" + automaton.getName(), 0, automaton.getNumberOfLocations() - 1);
                     result.automatonToLocationDdVariableMap[automaton.getName()] = variablePair;
@@ -348,20 +373,19 @@ namespace storm {
                     result.variableToRangeMap.emplace(variablePair.second, result.manager->getRange(variablePair.second));
                 }
                 
-                // Create global variables.
+                // Build the ranges of the global variables.
                 storm::dd::Bdd<Type> globalVariableRanges = result.manager->getBddOne();
                 for (auto const& variable : this->model.getGlobalVariables()) {
-                    // Only create the variable if it's non-transient.
+                    // Only non-transient variables were created.
                     if (variable.isTransient()) {
                         continue;
                     }
                     
-                    createVariable(variable, result);
                     globalVariableRanges &= result.manager->getRange(result.variableToRowMetaVariableMap->at(variable.getExpressionVariable()));
                 }
                 result.globalVariableRanges = globalVariableRanges.template toAdd<ValueType>();
                 
-                // Create the variables for the individual automata.
+                // Build the identities and ranges of the individual automata.
                 for (auto const& automaton : this->model.getAutomata()) {
                     storm::dd::Bdd<Type> identity = result.manager->getBddOne();
                     storm::dd::Bdd<Type> range = result.manager->getBddOne();
@@ -372,14 +396,13 @@ namespace storm {
                     identity &= variableIdentity;
                     range &= result.manager->getRange(locationVariables.first);
                     
-                    // Then create variables for the variables of the automaton.
+                    // Then add the ones of the variables of the automaton.
                     for (auto const& variable : automaton.getVariables()) {
-                        // Only create the variable if it's non-transient.
+                        // Only non-transient variables were created.
                         if (variable.isTransient()) {
                             continue;
                         }
                         
-                        createVariable(variable, result);
                         identity &= result.variableToIdentityMap.at(variable.getExpressionVariable()).toBdd();
                         range &= result.manager->getRange(result.variableToRowMetaVariableMap->at(variable.getExpressionVariable()));
                     }
@@ -1261,8 +1284,8 @@ namespace storm {
                     }
                     
                     uint64_t numberOfLocalNondeterminismVariables = static_cast<uint64_t>(std::ceil(std::log2(actions.size())));
-                    storm::dd::Bdd<Type> guard = this->variables.manager->getBddZero();
-                    storm::dd::Add<Type, ValueType> transitions = this->variables.manager->template getAddZero<ValueType>();
+                    std::vector<storm::dd::Bdd<Type>> guards;
+                    std::vector<storm::dd::Add<Type, ValueType>> transitions;
                     std::map<storm::expressions::Variable, storm::dd::Add<Type, ValueType>> transientEdgeAssignments;
                     std::map<storm::expressions::Variable, storm::dd::Bdd<Type>> variableToWritingFragment;
                     storm::dd::Bdd<Type> illegalFragment = this->variables.manager->getBddZero();
@@ -1270,10 +1293,10 @@ namespace storm {
                     for (uint64_t actionIndex = 0; actionIndex < actions.size(); ++actionIndex) {
                         ActionDd& action = actions[actionIndex];
 
-                        guard |= action.guard;
+                        guards.push_back(action.guard);
 
                         storm::dd::Add<Type, ValueType> nondeterminismEncoding = encodeIndex(actionIndex, highestLocalNondeterminismVariable, numberOfLocalNondeterminismVariables, this->variables);
-                        transitions += nondeterminismEncoding * action.transitions;
+                        transitions.push_back(nondeterminismEncoding * action.transitions);
                         
                         joinTransientAssignmentMapsInPlace(transientEdgeAssignments, action.transientEdgeAssignments, nondeterminismEncoding);
                         
@@ -1285,7 +1308,8 @@ namespace storm {
                         illegalFragment |= action.illegalFragment;
                     }
                     
-                    return ActionDd(guard, transitions, transientEdgeAssignments, std::make_pair(lowestLocalNondeterminismVariable, highestLocalNondeterminismVariable + numberOfLocalNondeterminismVariables), variableToWritingFragment, illegalFragment);
+                    // Combine the guards and transitions of the actions in balanced trees.
+                    return ActionDd(storm::dd::Bdd<Type>::disjunction(*this->variables.manager, guards), storm::dd::Add<Type, ValueType>::sum(*this->variables.manager, transitions), transientEdgeAssignments, std::make_pair(lowestLocalNondeterminismVariable, highestLocalNondeterminismVariable + numberOfLocalNondeterminismVariables), variableToWritingFragment, illegalFragment);
                 } else {
                     STORM_LOG_THROW(false, storm::exceptions::InvalidStateException, "Illegal model type.");
                 }
@@ -1398,7 +1422,7 @@ namespace storm {
             
             EdgeDd combineMarkovianEdgesToSingleEdge(std::vector<EdgeDd> const& edgeDds) {
                 storm::dd::Bdd<Type> guard = this->variables.manager->getBddZero();
-                storm::dd::Add<Type, ValueType> transitions = this->variables.manager->template getAddZero<ValueType>();
+                std::vector<storm::dd::Add<Type, ValueType>> transitions;
                 std::map<storm::expressions::Variable, storm::dd::Add<Type, ValueType>> transientEdgeAssignments;
                 std::map<storm::expressions::Variable, storm::dd::Bdd<Type>> variableToWritingFragment;
 
@@ -1411,7 +1435,7 @@ namespace storm {
                     }
                     
                     guard |= edge.guard;
-                    transitions += edge.transitions;
+                    transitions.push_back(edge.transitions);
                     variableToWritingFragment = joinVariableWritingFragmentMaps(variableToWritingFragment, edge.variableToWritingFragment);
                     joinTransientAssignmentMapsInPlace(transientEdgeAssignments, edge.transientEdgeAssignments);
                 }
@@ -1419,7 +1443,7 @@ namespace storm {
                 // Currently, we can only combine the transient edge assignments if there is no overlap of the guards of the edges.
                 STORM_LOG_THROW(!overlappingGuards || transientEdgeAssignments.empty(), storm::exceptions::NotSupportedException, "Cannot have transient edge assignments when combining Markovian edges with overlapping guards.");
                 
-                return EdgeDd(true, guard, transitions, transientEdgeAssignments, variableToWritingFragment);
+                return EdgeDd(true, guard, storm::dd::Add<Type, ValueType>::sum(*this->variables.manager, transitions), transientEdgeAssignments, variableToWritingFragment);
             }
             
             ActionDd buildActionDdForActionInstantiation(storm::jani::Automaton const& automaton, ActionInstantiation const& instantiation) {
@@ -1505,7 +1529,7 @@ namespace storm {
 
             ActionDd combineEdgesToActionDeterministic(std::vector<EdgeDd> const& edgeDds) {
                 storm::dd::Bdd<Type> allGuards = this->variables.manager->getBddZero();
-                storm::dd::Add<Type, ValueType> allTransitions = this->variables.manager->template getAddZero<ValueType>();
+                std::vector<storm::dd::Add<Type, ValueType>> allTransitions;
                 storm::dd::Bdd<Type> temporary;
                 
                 std::map<storm::expressions::Variable, storm::dd::Bdd<Type>> globalVariableToWritingFragment;
@@ -1522,7 +1546,7 @@ namespace storm {
                     
                     // Add the elements of the current edge to the global ones.
                     allGuards |= edgeDd.guard;
-                    allTransitions += edgeDd.transitions;
+                    allTransitions.push_back(edgeDd.transitions);
                     
                     // Add the transient variable assignments to the resulting one. This transformation is illegal for
                     // CTMCs for which there is some overlap in edges that have some transient assignment (this needs to
@@ -1535,7 +1559,7 @@ namespace storm {
 
                 STORM_LOG_THROW(this->model.getModelType() == storm::jani::ModelType::DTMC || !overlappingGuards || transientEdgeAssignments.empty(), storm::exceptions::NotSupportedException, "Cannot have transient edge assignments when combining Markovian edges with overlapping guards.");
                 
-                return ActionDd(allGuards, allTransitions, transientEdgeAssignments, std::make_pair<uint64_t, uint64_t>(0, 0), globalVariableToWritingFragment, this->variables.manager->getBddZero());
+                return ActionDd(allGuards, storm::dd::Add<Type, ValueType>::sum(*this->variables.manager, allTransitions), transientEdgeAssignments, std::make_pair<uint64_t, uint64_t>(0, 0), globalVariableToWritingFragment, this->variables.manager->getBddZero());
             }
             
             void addToVariableWritingFragmentMap(std::map<storm::expressions::Variable, storm::dd::Bdd<Type>>& globalVariableToWritingFragment, storm::expressions::Variable const& variable, storm::dd::Bdd<Type> const& partToAdd) const {
@@ -1569,12 +1593,12 @@ namespace storm {
             }
             
             ActionDd combineEdgesBySummation(storm::dd::Bdd<Type> const& guard, std::vector<EdgeDd> const& edges) {
-                storm::dd::Add<Type, ValueType> transitions = this->variables.manager->template getAddZero<ValueType>();
+                std::vector<storm::dd::Add<Type, ValueType>> transitions;
                 std::map<storm::expressions::Variable, storm::dd::Bdd<Type>> globalVariableToWritingFragment;
                 std::map<storm::expressions::Variable, storm::dd::Add<Type, ValueType>> transientEdgeAssignments;
                 
                 for (auto const& edge : edges) {
-                    transitions += edge.transitions;
+                    transitions.push_back(edge.transitions);
                     for (auto const& assignment : edge.transientEdgeAssignments) {
                         addToTransientAssignmentMap(transientEdgeAssignments, assignment.first, assignment.second);
                     }
@@ -1583,18 +1607,20 @@ namespace storm {
                     }
                 }
                 
-                return ActionDd(guard, transitions, transientEdgeAssignments, std::make_pair<uint64_t, uint64_t>(0, 0), globalVariableToWritingFragment, this->variables.manager->getBddZero());
+                return ActionDd(guard, storm::dd::Add<Type, ValueType>::sum(*this->variables.manager, transitions), transientEdgeAssignments, std::make_pair<uint64_t, uint64_t>(0, 0), globalVariableToWritingFragment, this->variables.manager->getBddZero());
             }
             
             ActionDd combineEdgesToActionNondeterministic(std::vector<EdgeDd> const& edges, uint64_t localNondeterminismVariableOffset) {
                 // Sum all guards, so we can read off the maximal number of nondeterministic choices in any given state.
-                storm::dd::Bdd<Type> allGuards = this->variables.manager->getBddZero();
-                storm::dd::Add<Type, uint_fast64_t> sumOfGuards = this->variables.manager->template getAddZero<uint_fast64_t>();
+                std::vector<storm::dd::Bdd<Type>> guards;
+                std::vector<storm::dd::Add<Type, uint_fast64_t>> guardAdds;
                 for (auto const& edge : edges) {
                     STORM_LOG_ASSERT(!edge.isMarkovian, "Unexpected Markovian edge.");
-                    sumOfGuards += edge.guard.template toAdd<uint_fast64_t>();
-                    allGuards |= edge.guard;
+                    guardAdds.push_back(edge.guard.template toAdd<uint_fast64_t>());
+                    guards.push_back(edge.guard);
                 }
+                storm::dd::Add<Type, uint_fast64_t> sumOfGuards = storm::dd::Add<Type, uint_fast64_t>::sum(*this->variables.manager, guardAdds);
+                storm::dd::Bdd<Type> allGuards = storm::dd::Bdd<Type>::disjunction(*this->variables.manager, guards);
                 uint_fast64_t maxChoices = sumOfGuards.getMax();
                 STORM_LOG_TRACE("Found " << maxChoices << " non-Markovian local choices.");
                 
@@ -1605,12 +1631,12 @@ namespace storm {
                     // Calculate number of required variables to encode the nondeterminism.
                     uint_fast64_t numberOfBinaryVariables = static_cast<uint_fast64_t>(std::ceil(storm::utility::math::log2(maxChoices)));
                     
-                    storm::dd::Add<Type, ValueType> allEdges = this->variables.manager->template getAddZero<ValueType>();
+                    std::vector<storm::dd::Add<Type, ValueType>> allEdges;
                     std::map<storm::expressions::Variable, storm::dd::Bdd<Type>> globalVariableToWritingFragment;
                     std::map<storm::expressions::Variable, storm::dd::Add<Type, ValueType>> transientAssignments;
                     
                     storm::dd::Bdd<Type> equalsNumberOfChoicesDd;
-                    std::vector<storm::dd::Add<Type, ValueType>> choiceDds(maxChoices, this->variables.manager->template getAddZero<ValueType>());
+                    std::vector<std::vector<storm::dd::Add<Type, ValueType>>> choiceDds(maxChoices);
                     std::vector<storm::dd::Bdd<Type>> remainingDds(maxChoices, this->variables.manager->getBddZero());
                     std::vector<std::pair<storm::dd::Bdd<Type>, storm::dd::Add<Type, ValueType>>> indicesEncodedWithLocalNondeterminismVariables;
                     for (uint64_t j = 0; j < maxChoices; ++j) {
@@ -1629,7 +1655,7 @@ namespace storm {
                         
                         // Reset the previously used intermediate storage.
                         for (uint_fast64_t j = 0; j < currentChoices; ++j) {
-                            choiceDds[j] = this->variables.manager->template getAddZero<ValueType>();
+                            choiceDds[j].clear();
                             remainingDds[j] = equalsNumberOfChoicesDd;
                         }
                         
@@ -1656,7 +1682,7 @@ namespace storm {
                                     remainingDds[k] = remainingDds[k] && !remainingGuardChoicesIntersection;
                                     
                                     // Combine the overlapping part of the guard with command updates and add it to the resulting DD.
-                                    choiceDds[k] += remainingGuardChoicesIntersection.template toAdd<ValueType>() * currentEdge.transitions;
+                                    choiceDds[k].push_back(remainingGuardChoicesIntersection.template toAdd<ValueType>() * currentEdge.transitions);
                                     
                                     // Keep track of the fragment of transient assignments.
                                     for (auto const& transientAssignment : currentEdge.transientEdgeAssignments) {
@@ -1681,14 +1707,14 @@ namespace storm {
                         
                         // Add the meta variables that encode the nondeterminisim to the different choices.
                         for (uint_fast64_t j = 0; j < currentChoices; ++j) {
-                            allEdges += indicesEncodedWithLocalNondeterminismVariables[j].second * choiceDds[j];
+                            allEdges.push_back(indicesEncodedWithLocalNondeterminismVariables[j].second * storm::dd::Add<Type, ValueType>::sum(*this->variables.manager, choiceDds[j]));
                         }
                         
                         // Delete currentChoices out of overlapping DD
                         sumOfGuards = sumOfGuards * (!equalsNumberOfChoicesDd).template toAdd<uint_fast64_t>();
                     }
                     
-                    return ActionDd(allGuards, allEdges, transientAssignments, std::make_pair(localNondeterminismVariableOffset, localNondeterminismVariableOffset + numberOfBinaryVariables), globalVariableToWritingFragment, this->variables.manager->getBddZero());
+                    return ActionDd(allGuards, storm::dd::Add<Type, ValueType>::sum(*this->variables.manager, allEdges), transientAssignments, std::make_pair(localNondeterminismVariableOffset, localNondeterminismVariableOffset + numberOfBinaryVariables), globalVariableToWritingFragment, this->variables.manager->getBddZero());
                 }
             }
             
@@ -1758,7 +1784,7 @@ namespace storm {
                 
                 // If the model is an MDP, we need to encode the nondeterminism using additional variables.
                 if (modelType == storm::jani::ModelType::MDP || modelType == storm::jani::ModelType::MA || modelType == storm::jani::ModelType::LTS) {
-                    storm::dd::Add<Type, ValueType> result = this->variables.manager->template getAddZero<ValueType>();
+                    std::vector<storm::dd::Add<Type, ValueType>> actionTransitions;
                     storm::dd::Bdd<Type> illegalFragment = this->variables.manager->getBddZero();
                     
                     // First, determine the highest number of nondeterminism variables that is used in any action and make
@@ -1788,14 +1814,14 @@ namespace storm {
                             addToTransientAssignmentMap(transientEdgeAssignments, transientAssignment.first, actionEncoding * missingNondeterminismEncoding * transientAssignment.second);
                         }
                         
-                        result += extendedTransitions;
+                        actionTransitions.push_back(extendedTransitions);
                     }
                     
-                    return ComposerResult<Type, ValueType>(result, automaton.transientLocationAssignments, transientEdgeAssignments, illegalFragment, numberOfUsedNondeterminismVariables);
+                    return ComposerResult<Type, ValueType>(storm::dd::Add<Type, ValueType>::sum(*this->variables.manager, actionTransitions), automaton.transientLocationAssignments, transientEdgeAssignments, illegalFragment, numberOfUsedNondeterminismVariables);
                 } else if (modelType == storm::jani::ModelType::DTMC || modelType == storm::jani::ModelType::CTMC) {
                     // Simply add all actions, but make sure to include the missing global variable identities.
 
-                    storm::dd::Add<Type, ValueType> result = this->variables.manager->template getAddZero<ValueType>();
+                    std::vector<storm::dd::Add<Type, ValueType>> actionTransitions;
                     storm::dd::Bdd<Type> illegalFragment = this->variables.manager->getBddZero();
                     std::map<storm::expressions::Variable, storm::dd::Add<Type, ValueType>> transientEdgeAssignments;
                     std::unordered_set<uint64_t> actionIndices;
@@ -1805,10 +1831,10 @@ namespace storm {
                         illegalFragment |= action.second.illegalFragment;
                         addMissingGlobalVariableIdentities(action.second);
                         addToTransientAssignmentMap(transientEdgeAssignments, action.second.transientEdgeAssignments);
-                        result += action.second.transitions;
+                        actionTransitions.push_back(action.second.transitions);
                     }
 
-                    return ComposerResult<Type, ValueType>(result, automaton.transientLocationAssignments, transientEdgeAssignments, illegalFragment, 0);
+                    return ComposerResult<Type, ValueType>(storm::dd::Add<Type, ValueType>::sum(*this->variables.manager, actionTransitions), automaton.transientLocationAssignments, transientEdgeAssignments, illegalFragment, 0);
                 } else {
                     STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Model type '" << this->model.getModelType() << "' not supported.");
                 }
@@ -2107,7 +2133,25 @@ namespace storm {
             if (preparedModel.getModelType() == storm::jani::ModelType::MDP || preparedModel.getModelType() == storm::jani::ModelType::LTS || preparedModel.getModelType() == storm::jani::ModelType::MA) {
                 transitionMatrixBdd = transitionMatrixBdd.existsAbstract(variables.allNondeterminismVariables);
             }
-            modelComponents.reachableStates = storm::utility::dd::computeReachableStates(modelComponents.initialStates, transitionMatrixBdd, variables.rowMetaVariables, variables.columnMetaVariables);
+            storm::builder::SymbolicReachabilityStrategy reachabilityStrategy = storm::settings::getModule<storm::settings::modules::BuildSettings>().getSymbolicReachabilityStrategy();
+            if (reachabilityStrategy == storm::builder::SymbolicReachabilityStrategy::Bfs) {
+                modelComponents.reachableStates = storm::utility::dd::computeReachableStates(modelComponents.initialStates, transitionMatrixBdd, variables.rowMetaVariables, variables.columnMetaVariables);
+            } else {
+                // Split the transition relation into the moves that are local to an automaton or a global variable.
+                // Note that the identities of the automata already cover their local variables.
+                std::vector<storm::dd::Bdd<Type>> componentIdentities;
+                for (auto const& automatonIdentity : variables.automatonToIdentityMap) {
+                    componentIdentities.push_back(automatonIdentity.second.toBdd());
+                }
+                for (auto const& variable : preparedModel.getGlobalVariables()) {
+                    // Only non-transient variables were created.
+                    if (!variable.isTransient()) {
+                        componentIdentities.push_back(variables.variableToIdentityMap.at(variable.getExpressionVariable()).toBdd());
+                    }
+                }
+                std::vector<storm::dd::Bdd<Type>> transitionPartitions = storm::utility::dd::partitionTransitionRelation(transitionMatrixBdd, componentIdentities);
+                modelComponents.reachableStates = storm::utility::dd::computeReachableStates(modelComponents.initialStates, transitionPartitions, variables.rowMetaVariables, variables.columnMetaVariables, reachabilityStrategy);
+            }
             
             // Check that the reachable fragment does not overlap with the illegal fragment.
             storm::dd::Bdd<Type> reachableIllegalFragment = modelComponents.reachableStates && system.illegalFragment;
@@ -2130,6 +2174,7 @@ namespace storm {
             modelComponents.labelToExpressionMap = buildLabelExpressions(preparedModel, variables, options);
             
             // Finally, create the model.
+            storm::utility::addToProfilerCounter("dd nodes", modelComponents.transitionMatrix.getNodeCount());
             return createModel(preparedModel.getModelType(), variables, modelComponents);
         }
         
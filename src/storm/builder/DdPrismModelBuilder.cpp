@@ -16,6 +16,8 @@
 #include "storm/utility/prism.h"
 #include "storm/utility/math.h"
 #include "storm/utility/dd.h"
+#include "storm/builder/DdVariableOrdering.h"
+#include "storm/utility/Profiler.h"
 
 #include "storm/storage/dd/DdManager.h"
 #include "storm/storage/prism/Program.h"
@@ -25,6 +27,7 @@
 #include "storm/storage/dd/Bdd.h"
 
 #include "storm/settings/modules/CoreSettings.h"
+#include "storm/settings/modules/BuildSettings.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 
@@ -175,84 +178,57 @@ namespace storm {
                     allNondeterminismVariables.insert(variablePair.first);
                 }
                 
-                // Create meta variables for global program variables.
+                // Create meta variables for all program variables in the order determined by the build settings.
+                std::map<storm::expressions::Variable, std::pair<int_fast64_t, int_fast64_t>> integerVariableToBoundsMap;
                 for (storm::prism::IntegerVariable const& integerVariable : program.getGlobalIntegerVariables()) {
-                    int_fast64_t low = integerVariable.getLowerBoundExpression().evaluateAsInt();
-                    int_fast64_t high = integerVariable.getUpperBoundExpression().evaluateAsInt();
-                    std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(integerVariable.getName(), low, high);
-                    
-                    STORM_LOG_TRACE("Created meta variables for global integer variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex() << "] and " << variablePair.second.getName() << "[" << variablePair.second.getIndex() << "]");
+                    integerVariableToBoundsMap.emplace(integerVariable.getExpressionVariable(), std::make_pair(integerVariable.getLowerBoundExpression().evaluateAsInt(), integerVariable.getUpperBoundExpression().evaluateAsInt()));
+                }
+                for (storm::prism::Module const& module : program.getModules()) {
+                    for (storm::prism::IntegerVariable const& integerVariable : module.getIntegerVariables()) {
+                        integerVariableToBoundsMap.emplace(integerVariable.getExpressionVariable(), std::make_pair(integerVariable.getLowerBoundExpression().evaluateAsInt(), integerVariable.getUpperBoundExpression().evaluateAsInt()));
+                    }
+                }
+                for (storm::expressions::Variable const& variable : storm::builder::getDdVariableOrder(program)) {
+                    std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair;
+                    auto boundsIt = integerVariableToBoundsMap.find(variable);
+                    if (boundsIt != integerVariableToBoundsMap.end()) {
+                        variablePair = manager->addMetaVariable(variable.getName(), boundsIt->second.first, boundsIt->second.second);
+                        STORM_LOG_TRACE("Created meta variables for integer variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex() << "] and " << variablePair.second.getName() << "[" << variablePair.second.getIndex() << "]");
+                    } else {
+                        variablePair = manager->addMetaVariable(variable.getName());
+                        STORM_LOG_TRACE("Created meta variables for boolean variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex() << "] and " << variablePair.second.getName() << "[" << variablePair.second.getIndex() << "]");
+                    }
                     
                     rowMetaVariables.insert(variablePair.first);
-                    variableToRowMetaVariableMap->emplace(integerVariable.getExpressionVariable(), variablePair.first);
+                    variableToRowMetaVariableMap->emplace(variable, variablePair.first);
                     
                     columnMetaVariables.insert(variablePair.second);
-                    variableToColumnMetaVariableMap->emplace(integerVariable.getExpressionVariable(), variablePair.second);
+                    variableToColumnMetaVariableMap->emplace(variable, variablePair.second);
                     
                     storm::dd::Bdd<Type> variableIdentity = manager->getIdentity(variablePair.first, variablePair.second);
-                    variableToIdentityMap.emplace(integerVariable.getExpressionVariable(), variableIdentity.template toAdd<ValueType>());
+                    variableToIdentityMap.emplace(variable, variableIdentity.template toAdd<ValueType>());
                     rowColumnMetaVariablePairs.push_back(variablePair);
-                    
+                }
+                
+                for (storm::prism::IntegerVariable const& integerVariable : program.getGlobalIntegerVariables()) {
                     allGlobalVariables.insert(integerVariable.getExpressionVariable());
                 }
                 for (storm::prism::BooleanVariable const& booleanVariable : program.getGlobalBooleanVariables()) {
-                    std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(booleanVariable.getName());
-                    
-                    STORM_LOG_TRACE("Created meta variables for global boolean variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex() << "] and " << variablePair.second.getName() << "[" << variablePair.second.getIndex() << "]");
-                    
-                    rowMetaVariables.insert(variablePair.first);
-                    variableToRowMetaVariableMap->emplace(booleanVariable.getExpressionVariable(), variablePair.first);
-                    
-                    columnMetaVariables.insert(variablePair.second);
-                    variableToColumnMetaVariableMap->emplace(booleanVariable.getExpressionVariable(), variablePair.second);
-                    
-                    storm::dd::Bdd<Type> variableIdentity = manager->getIdentity(variablePair.first, variablePair.second);
-                    variableToIdentityMap.emplace(booleanVariable.getExpressionVariable(), variableIdentity.template toAdd<ValueType>());
-                    
-                    rowColumnMetaVariablePairs.push_back(variablePair);
                     allGlobalVariables.insert(booleanVariable.getExpressionVariable());
                 }
                 
-                // Create meta variables for each of the modules' variables.
+                // Create the identities and ranges of the modules.
                 for (storm::prism::Module const& module : program.getModules()) {
                     storm::dd::Bdd<Type> moduleIdentity = manager->getBddOne();
                     storm::dd::Bdd<Type> moduleRange = manager->getBddOne();
                     
                     for (storm::prism::IntegerVariable const& integerVariable : module.getIntegerVariables()) {
-                        int_fast64_t low = integerVariable.getLowerBoundExpression().evaluateAsInt();
-                        int_fast64_t high = integerVariable.getUpperBoundExpression().evaluateAsInt();
-                        std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(integerVariable.getName(), low, high);
-                        STORM_LOG_TRACE("Created meta variables for integer variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex() << "] and " << variablePair.second.getName() << "[" << variablePair.second.getIndex() << "]");
-                        
-                        rowMetaVariables.insert(variablePair.first);
-                        variableToRowMetaVariableMap->emplace(integerVariable.getExpressionVariable(), variablePair.first);
-                        
-                        columnMetaVariables.insert(variablePair.second);
-                        variableToColumnMetaVariableMap->emplace(integerVariable.getExpressionVariable(), variablePair.second);
-                        
-                        storm::dd::Bdd<Type> variableIdentity = manager->getIdentity(variablePair.first, variablePair.second);
-                        variableToIdentityMap.emplace(integerVariable.getExpressionVariable(), variableIdentity.template toAdd<ValueType>());
-                        moduleIdentity &= variableIdentity;
-                        moduleRange &= manager->getRange(variablePair.first);
-                        
-                        rowColumnMetaVariablePairs.push_back(variablePair);
+                        moduleIdentity &= variableToIdentityMap.at(integerVariable.getExpressionVariable()).toBdd();
+                        moduleRange &= manager->getRange(variableToRowMetaVariableMap->at(integerVariable.getExpressionVariable()));
                     }
                     for (storm::prism::BooleanVariable const& booleanVariable : module.getBooleanVariables()) {
-                        std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(booleanVariable.getName());
-                        STORM_LOG_TRACE("Created meta variables for boolean variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex() << "] and " << variablePair.second.getName() << "[" << variablePair.second.getIndex() << "]");
-                        
-                        rowMetaVariables.insert(variablePair.first);
-                        variableToRowMetaVariableMap->emplace(booleanVariable.getExpressionVariable(), variablePair.first);
-                        
-                        columnMetaVariables.insert(variablePair.second);
-                        variableToColumnMetaVariableMap->emplace(booleanVariable.getExpressionVariable(), variablePair.second);
-                        
-                        storm::dd::Bdd<Type> variableIdentity = manager->getIdentity(variablePair.first, variablePair.second);
-                        variableToIdentityMap.emplace(booleanVariable.getExpressionVariable(), variableIdentity.template toAdd<ValueType>());
-                        moduleIdentity &= variableIdentity;
-                        moduleRange &= manager->getRange(variablePair.first);
-                        
-                        rowColumnMetaVariablePairs.push_back(variablePair);
+                        moduleIdentity &= variableToIdentityMap.at(booleanVariable.getExpressionVariable()).toBdd();
+                        moduleRange &= manager->getRange(variableToRowMetaVariableMap->at(booleanVariable.getExpressionVariable()));
                     }
                     moduleToIdentityMap[module.getName()] = moduleIdentity.template toAdd<ValueType>();
                     moduleToRangeMap[module.getName()] = moduleRange.template toAdd<ValueType>();
@@ -820,7 +796,7 @@ namespace storm {
         template <storm::dd::DdType Type, typename ValueType>
         typename DdPrismModelBuilder<Type, ValueType>::ActionDecisionDiagram DdPrismModelBuilder<Type, ValueType>::combineCommandsToActionMarkovChain(GenerationInformation& generationInfo, std::vector<ActionDecisionDiagram>& commandDds) {
             storm::dd::Bdd<Type> allGuards = generationInfo.manager->getBddZero();
-            storm::dd::Add<Type, ValueType> allCommands = generationInfo.manager->template getAddZero<ValueType>();
+            std::vector<storm::dd::Add<Type, ValueType>> allCommands;
             storm::dd::Bdd<Type> temporary;
             
             // Make all command DDs assign to the same global variables.
@@ -835,10 +811,11 @@ namespace storm {
                 STORM_LOG_WARN_COND(temporary.isZero() || generationInfo.program.getModelType() == storm::prism::Program::ModelType::CTMC, "Guard of a command overlaps with previous guards.");
                 
                 allGuards |= commandDd.guardDd;
-                allCommands += commandDd.transitionsDd;
+                allCommands.push_back(commandDd.transitionsDd);
             }
             
-            return ActionDecisionDiagram(allGuards, allCommands, assignedGlobalVariables);
+            // Sum the commands in a balanced tree.
+            return ActionDecisionDiagram(allGuards, storm::dd::Add<Type, ValueType>::sum(*generationInfo.manager, allCommands), assignedGlobalVariables);
         }
         
         template <storm::dd::DdType Type, typename ValueType>
@@ -862,18 +839,20 @@ namespace storm {
         
         template <storm::dd::DdType Type, typename ValueType>
         typename DdPrismModelBuilder<Type, ValueType>::ActionDecisionDiagram DdPrismModelBuilder<Type, ValueType>::combineCommandsToActionMDP(GenerationInformation& generationInfo, std::vector<ActionDecisionDiagram>& commandDds, uint_fast64_t nondeterminismVariableOffset) {
-            storm::dd::Bdd<Type> allGuards = generationInfo.manager->getBddZero();
-            storm::dd::Add<Type, ValueType> allCommands = generationInfo.manager->template getAddZero<ValueType>();
+            std::vector<storm::dd::Add<Type, ValueType>> allCommands;
             
             // Make all command DDs assign to the same global variables.
             std::set<storm::expressions::Variable> assignedGlobalVariables = equalizeAssignedGlobalVariables(generationInfo, commandDds);
             
             // Sum all guards, so we can read off the maximal number of nondeterministic choices in any given state.
-            storm::dd::Add<Type, uint_fast64_t> sumOfGuards = generationInfo.manager->template getAddZero<uint_fast64_t>();
+            std::vector<storm::dd::Bdd<Type>> guards;
+            std::vector<storm::dd::Add<Type, uint_fast64_t>> guardAdds;
             for (auto const& commandDd : commandDds) {
-                sumOfGuards += commandDd.guardDd.template toAdd<uint_fast64_t>();
-                allGuards |= commandDd.guardDd;
+                guardAdds.push_back(commandDd.guardDd.template toAdd<uint_fast64_t>());
+                guards.push_back(commandDd.guardDd);
             }
+            storm::dd::Add<Type, uint_fast64_t> sumOfGuards = storm::dd::Add<Type, uint_fast64_t>::sum(*generationInfo.manager, guardAdds);
+            storm::dd::Bdd<Type> allGuards = storm::dd::Bdd<Type>::disjunction(*generationInfo.manager, guards);
             uint_fast64_t maxChoices = sumOfGuards.getMax();
             
             STORM_LOG_TRACE("Found " << maxChoices << " local choices.");
@@ -884,15 +863,15 @@ namespace storm {
             } else if (maxChoices == 1) {
                 // Sum up all commands.
                 for (auto const& commandDd : commandDds) {
-                    allCommands += commandDd.transitionsDd;
+                    allCommands.push_back(commandDd.transitionsDd);
                 }
-                return ActionDecisionDiagram(allGuards, allCommands, assignedGlobalVariables);
+                return ActionDecisionDiagram(allGuards, storm::dd::Add<Type, ValueType>::sum(*generationInfo.manager, allCommands), assignedGlobalVariables);
             } else {
                 // Calculate number of required variables to encode the nondeterminism.
                 uint_fast64_t numberOfBinaryVariables = static_cast<uint_fast64_t>(std::ceil(storm::utility::math::log2(maxChoices)));
                 
                 storm::dd::Bdd<Type> equalsNumberOfChoicesDd;
-                std::vector<storm::dd::Add<Type, ValueType>> choiceDds(maxChoices, generationInfo.manager->template getAddZero<ValueType>());
+                std::vector<std::vector<storm::dd::Add<Type, ValueType>>> choiceDds(maxChoices);
                 std::vector<storm::dd::Bdd<Type>> remainingDds(maxChoices, generationInfo.manager->getBddZero());
                 
                 for (uint_fast64_t currentChoices = 1; currentChoices <= maxChoices; ++currentChoices) {
@@ -906,7 +885,7 @@ namespace storm {
                     
                     // Reset the previously used intermediate storage.
                     for (uint_fast64_t j = 0; j < currentChoices; ++j) {
-                        choiceDds[j] = generationInfo.manager->template getAddZero<ValueType>();
+                        choiceDds[j].clear();
                         remainingDds[j] = equalsNumberOfChoicesDd;
                     }
                     
@@ -931,7 +910,7 @@ namespace storm {
                                 remainingDds[k] = remainingDds[k] && !remainingGuardChoicesIntersection;
                                 
                                 // Combine the overlapping part of the guard with command updates and add it to the resulting DD.
-                                choiceDds[k] += remainingGuardChoicesIntersection.template toAdd<ValueType>() * commandDds[j].transitionsDd;
+                                choiceDds[k].push_back(remainingGuardChoicesIntersection.template toAdd<ValueType>() * commandDds[j].transitionsDd);
                             }
                             
                             // Remove overlapping parts from the command guard DD
@@ -946,14 +925,14 @@ namespace storm {
                     
                     // Add the meta variables that encode the nondeterminisim to the different choices.
                     for (uint_fast64_t j = 0; j < currentChoices; ++j) {
-                        allCommands += encodeChoice(generationInfo, nondeterminismVariableOffset, numberOfBinaryVariables, j) * choiceDds[j];
+                        allCommands.push_back(encodeChoice(generationInfo, nondeterminismVariableOffset, numberOfBinaryVariables, j) * storm::dd::Add<Type, ValueType>::sum(*generationInfo.manager, choiceDds[j]));
                     }
                     
                     // Delete currentChoices out of overlapping DD
                     sumOfGuards = sumOfGuards * (!equalsNumberOfChoicesDd).template toAdd<uint_fast64_t>();
                 }
                 
-                return ActionDecisionDiagram(allGuards, allCommands, assignedGlobalVariables, nondeterminismVariableOffset + numberOfBinaryVariables);
+                return ActionDecisionDiagram(allGuards, storm::dd::Add<Type, ValueType>::sum(*generationInfo.manager, allCommands), assignedGlobalVariables, nondeterminismVariableOffset + numberOfBinaryVariables);
             }
         }
         
@@ -1408,7 +1387,22 @@ namespace storm {
                 transitionMatrixBdd = transitionMatrixBdd.existsAbstract(generationInfo.allNondeterminismVariables);
             }
             
-            storm::dd::Bdd<Type> reachableStates = storm::utility::dd::computeReachableStates<Type>(initialStates, transitionMatrixBdd, generationInfo.rowMetaVariables, generationInfo.columnMetaVariables);
+            storm::dd::Bdd<Type> reachableStates;
+            storm::builder::SymbolicReachabilityStrategy reachabilityStrategy = storm::settings::getModule<storm::settings::modules::BuildSettings>().getSymbolicReachabilityStrategy();
+            if (reachabilityStrategy == storm::builder::SymbolicReachabilityStrategy::Bfs) {
+                reachableStates = storm::utility::dd::computeReachableStates<Type>(initialStates, transitionMatrixBdd, generationInfo.rowMetaVariables, generationInfo.columnMetaVariables);
+            } else {
+                // Split the transition relation into the moves that are local to a module or a global variable.
+                std::vector<storm::dd::Bdd<Type>> componentIdentities;
+                for (auto const& moduleIdentity : generationInfo.moduleToIdentityMap) {
+                    componentIdentities.push_back(moduleIdentity.second.toBdd());
+                }
+                for (auto const& variable : generationInfo.allGlobalVariables) {
+                    componentIdentities.push_back(generationInfo.variableToIdentityMap.at(variable).toBdd());
+                }
+                std::vector<storm::dd::Bdd<Type>> transitionPartitions = storm::utility::dd::partitionTransitionRelation(transitionMatrixBdd, componentIdentities);
+                reachableStates = storm::utility::dd::computeReachableStates(initialStates, transitionPartitions, generationInfo.rowMetaVariables, generationInfo.columnMetaVariables, reachabilityStrategy);
+            }
             storm::dd::Add<Type, ValueType> reachableStatesAdd = reachableStates.template toAdd<ValueType>();
             transitionMatrix *= reachableStatesAdd;
             if (system.stateActionDd) {
@@ -1504,6 +1498,7 @@ namespace storm {
                 result->addParameters(generationInfo.parameters);
             }
             
+            storm::utility::addToProfilerCounter("dd nodes", transitionMatrix.getNodeCount());
             return result;
         }
         
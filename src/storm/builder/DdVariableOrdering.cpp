@@ -0,0 +1,283 @@
+#include "storm/builder/DdVariableOrdering.h"
+
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <numeric>
+
+#include <boost/algorithm/string/trim.hpp>
+
+#include "storm/storage/prism/Program.h"
+#include "storm/storage/jani/Model.h"
+#include "storm/storage/jani/Automaton.h"
+#include "storm/storage/jani/Edge.h"
+#include "storm/storage/jani/EdgeDestination.h"
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/BuildSettings.h"
+
+#include "storm/utility/file.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/WrongFormatException.h"
+
+namespace storm {
+    namespace builder {
+
+        namespace detail {
+            std::vector<storm::expressions::Variable> getDdVariableOrder(std::vector<storm::expressions::Variable> const& variables, std::vector<std::set<storm::expressions::Variable>> const& dependencies) {
+                storm::settings::modules::BuildSettings const& buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
+
+                std::vector<storm::expressions::Variable> result;
+                if (buildSettings.isImportDdVariableOrderSet()) {
+                    result = importDdVariableOrder(variables, buildSettings.getImportDdVariableOrderFilename());
+                } else if (buildSettings.getDdVariableOrderingHeuristic() == DdVariableOrderingHeuristic::Force) {
+                    result = computeForceOrder(variables, dependencies);
+                } else {
+                    result = variables;
+                }
+
+                if (buildSettings.isExportDdVariableOrderSet()) {
+                    exportDdVariableOrder(result, buildSettings.getExportDdVariableOrderFilename());
+                }
+                return result;
+            }
+
+            void addVariables(storm::expressions::Expression const& expression, std::set<storm::expressions::Variable>& variables) {
+                std::set<storm::expressions::Variable> expressionVariables = expression.getVariables();
+                variables.insert(expressionVariables.begin(), expressionVariables.end());
+            }
+        }
+
+        std::vector<storm::expressions::Variable> getDdVariableOrder(storm::prism::Program const& program) {
+            std::vector<storm::expressions::Variable> variables;
+            for (auto const& variable : program.getGlobalIntegerVariables()) {
+                variables.push_back(variable.getExpressionVariable());
+            }
+            for (auto const& variable : program.getGlobalBooleanVariables()) {
+                variables.push_back(variable.getExpressionVariable());
+            }
+            for (auto const& module : program.getModules()) {
+                for (auto const& variable : module.getIntegerVariables()) {
+                    variables.push_back(variable.getExpressionVariable());
+                }
+                for (auto const& variable : module.getBooleanVariables()) {
+                    variables.push_back(variable.getExpressionVariable());
+                }
+            }
+
+            // Each command relates the variables it reads and writes. Additionally, all commands synchronizing on the
+            // same action relate their variables.
+            std::vector<std::set<storm::expressions::Variable>> dependencies;
+            std::map<uint_fast64_t, std::set<storm::expressions::Variable>> actionDependencies;
+            for (auto const& module : program.getModules()) {
+                for (auto const& command : module.getCommands()) {
+                    std::set<storm::expressions::Variable> commandVariables;
+                    detail::addVariables(command.getGuardExpression(), commandVariables);
+                    for (auto const& update : command.getUpdates()) {
+                        detail::addVariables(update.getLikelihoodExpression(), commandVariables);
+                        for (auto const& assignment : update.getAssignments()) {
+                            commandVariables.insert(assignment.getVariable());
+                            detail::addVariables(assignment.getExpression(), commandVariables);
+                        }
+                    }
+                    if (command.isLabeled()) {
+                        actionDependencies[command.getActionIndex()].insert(commandVariables.begin(), commandVariables.end());
+                    }
+                    dependencies.push_back(std::move(commandVariables));
+                }
+            }
+            for (auto& actionVariables : actionDependencies) {
+                dependencies.push_back(std::move(actionVariables.second));
+            }
+
+            return detail::getDdVariableOrder(variables, dependencies);
+        }
+
+        std::vector<storm::expressions::Variable> getDdVariableOrder(storm::jani::Model const& model) {
+            // By default, the location variables come first, ordered by the names of their automata.
+            std::map<std::string, storm::expressions::Variable> automatonToLocationVariableMap;
+            for (auto const& automaton : model.getAutomata()) {
+                automatonToLocationVariableMap.emplace(automaton.getName(), automaton.getLocationExpressionVariable());
+            }
+            std::vector<storm::expressions::Variable> variables;
+            for (auto const& automatonLocationVariable : automatonToLocationVariableMap) {
+                variables.push_back(automatonLocationVariable.second);
+            }
+            for (auto const& variable : model.getGlobalVariables()) {
+                if (!variable.isTransient()) {
+                    variables.push_back(variable.getExpressionVariable());
+                }
+            }
+            for (auto const& automaton : model.getAutomata()) {
+                for (auto const& variable : automaton.getVariables()) {
+                    if (!variable.isTransient()) {
+                        variables.push_back(variable.getExpressionVariable());
+                    }
+                }
+            }
+
+            // Each edge relates the location of its automaton and the variables it reads and writes. Additionally, all
+            // edges labeled with the same (non-silent) action relate their variables.
+            std::vector<std::set<storm::expressions::Variable>> dependencies;
+            std::map<uint64_t, std::set<storm::expressions::Variable>> actionDependencies;
+            for (auto const& automaton : model.getAutomata()) {
+                for (auto const& edge : automaton.getEdges()) {
+                    std::set<storm::expressions::Variable> edgeVariables = {automaton.getLocationExpressionVariable()};
+                    detail::addVariables(edge.getGuard(), edgeVariables);
+                    for (auto const& destination : edge.getDestinations()) {
+                        detail::addVariables(destination.getProbability(), edgeVariables);
+                        for (auto const& assignment : destination.getOrderedAssignments()) {
+                            edgeVariables.insert(assignment.getExpressionVariable());
+                            detail::addVariables(assignment.getAssignedExpression(), edgeVariables);
+                        }
+                    }
+                    if (edge.getActionIndex() != storm::jani::Model::SILENT_ACTION_INDEX) {
+                        actionDependencies[edge.getActionIndex()].insert(edgeVariables.begin(), edgeVariables.end());
+                    }
+                    dependencies.push_back(std::move(edgeVariables));
+                }
+            }
+            for (auto& actionVariables : actionDependencies) {
+                dependencies.push_back(std::move(actionVariables.second));
+            }
+
+            return detail::getDdVariableOrder(variables, dependencies);
+        }
+
+        std::vector<storm::expressions::Variable> computeForceOrder(std::vector<storm::expressions::Variable> const& variables, std::vector<std::set<storm::expressions::Variable>> const& dependencies) {
+            std::map<storm::expressions::Variable, uint64_t> variableToIndexMap;
+            for (uint64_t index = 0; index < variables.size(); ++index) {
+                variableToIndexMap[variables[index]] = index;
+            }
+
+            // Translate the dependencies to indices and drop the ones that cannot influence the order.
+            std::vector<std::vector<uint64_t>> hyperedges;
+            for (auto const& dependency : dependencies) {
+                std::vector<uint64_t> hyperedge;
+                for (auto const& variable : dependency) {
+                    auto it = variableToIndexMap.find(variable);
+                    if (it != variableToIndexMap.end()) {
+                        hyperedge.push_back(it->second);
+                    }
+                }
+                if (hyperedge.size() > 1) {
+                    hyperedges.push_back(std::move(hyperedge));
+                }
+            }
+
+            // The order maps positions to variable indices and the positions map variable indices to positions.
+            std::vector<uint64_t> order(variables.size());
+            std::iota(order.begin(), order.end(), 0);
+            std::vector<uint64_t> positions = order;
+
+            auto computeSpan = [&hyperedges, &positions] () {
+                uint64_t span = 0;
+                for (auto const& hyperedge : hyperedges) {
+                    auto minMax = std::minmax_element(hyperedge.begin(), hyperedge.end(), [&positions] (uint64_t first, uint64_t second) { return positions[first] < positions[second]; });
+                    span += positions[*minMax.second] - positions[*minMax.first];
+                }
+                return span;
+            };
+
+            std::vector<uint64_t> bestOrder = order;
+            uint64_t bestSpan = computeSpan();
+            STORM_LOG_TRACE("Initial variable order has a span of " << bestSpan << ".");
+
+            uint64_t const maximalNumberOfIterations = 100;
+            std::vector<double> centersOfGravity(hyperedges.size());
+            std::vector<double> positionSums(variables.size());
+            std::vector<uint64_t> hyperedgeCounts(variables.size());
+            for (uint64_t iteration = 0; iteration < maximalNumberOfIterations && bestSpan > 0; ++iteration) {
+                for (uint64_t hyperedgeIndex = 0; hyperedgeIndex < hyperedges.size(); ++hyperedgeIndex) {
+                    double sum = 0;
+                    for (auto const& variableIndex : hyperedges[hyperedgeIndex]) {
+                        sum += positions[variableIndex];
+                    }
+                    centersOfGravity[hyperedgeIndex] = sum / hyperedges[hyperedgeIndex].size();
+                }
+
+                // Move each variable to the average of the centers of gravity of its hyperedges. Variables without
+                // hyperedges keep their position.
+                std::fill(positionSums.begin(), positionSums.end(), 0.0);
+                std::fill(hyperedgeCounts.begin(), hyperedgeCounts.end(), 0);
+                for (uint64_t hyperedgeIndex = 0; hyperedgeIndex < hyperedges.size(); ++hyperedgeIndex) {
+                    for (auto const& variableIndex : hyperedges[hyperedgeIndex]) {
+                        positionSums[variableIndex] += centersOfGravity[hyperedgeIndex];
+                        ++hyperedgeCounts[variableIndex];
+                    }
+                }
+                for (uint64_t variableIndex = 0; variableIndex < variables.size(); ++variableIndex) {
+                    if (hyperedgeCounts[variableIndex] == 0) {
+                        positionSums[variableIndex] = positions[variableIndex];
+                    } else {
+                        positionSums[variableIndex] /= hyperedgeCounts[variableIndex];
+                    }
+                }
+
+                // Sorting stably keeps the previous relative order of variables with the same tentative position.
+                std::stable_sort(order.begin(), order.end(), [&positionSums] (uint64_t first, uint64_t second) { return positionSums[first] < positionSums[second]; });
+                for (uint64_t position = 0; position < order.size(); ++position) {
+                    positions[order[position]] = position;
+                }
+
+                uint64_t span = computeSpan();
+                STORM_LOG_TRACE("Variable order after iteration " << (iteration + 1) << " of FORCE has a span of " << span << ".");
+                if (span >= bestSpan) {
+                    break;
+                }
+                bestSpan = span;
+                bestOrder = order;
+            }
+
+            std::vector<storm::expressions::Variable> result;
+            result.reserve(variables.size());
+            for (auto const& variableIndex : bestOrder) {
+                result.push_back(variables[variableIndex]);
+            }
+            return result;
+        }
+
+        std::vector<storm::expressions::Variable> importDdVariableOrder(std::vector<storm::expressions::Variable> const& variables, std::string const& filename) {
+            std::map<std::string, storm::expressions::Variable> nameToVariableMap;
+            for (auto const& variable : variables) {
+                nameToVariableMap.emplace(variable.getName(), variable);
+            }
+
+            std::ifstream stream;
+            storm::utility::openFile(filename, stream);
+            std::vector<storm::expressions::Variable> result;
+            std::set<storm::expressions::Variable> orderedVariables;
+            std::string line;
+            while (std::getline(stream, line)) {
+                boost::algorithm::trim(line);
+                if (line.empty()) {
+                    continue;
+                }
+                auto it = nameToVariableMap.find(line);
+                STORM_LOG_THROW(it != nameToVariableMap.end(), storm::exceptions::WrongFormatException, "The variable order in file '" << filename << "' refers to the unknown state variable '" << line << "'.");
+                STORM_LOG_THROW(orderedVariables.insert(it->second).second, storm::exceptions::WrongFormatException, "The variable order in file '" << filename << "' contains the variable '" << line << "' multiple times.");
+                result.push_back(it->second);
+            }
+            storm::utility::closeFile(stream);
+
+            for (auto const& variable : variables) {
+                if (orderedVariables.find(variable) == orderedVariables.end()) {
+                    STORM_LOG_WARN("The variable order in file '" << filename << "' does not contain the variable '" << variable.getName() << "', placing it after the listed variables.");
+                    result.push_back(variable);
+                }
+            }
+            return result;
+        }
+
+        void exportDdVariableOrder(std::vector<storm::expressions::Variable> const& order, std::string const& filename) {
+            std::ofstream stream;
+            storm::utility::openFile(filename, stream);
+            for (auto const& variable : order) {
+                stream << variable.getName() << std::endl;
+            }
+            storm::utility::closeFile(stream);
+        }
+
+    }
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <set>
+#include <string>
+#include <vector>
+
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+    namespace prism {
+        class Program;
+    }
+    
+    namespace jani {
+        class Model;
+    }
+    
+    namespace builder {
+        
+        /*!
+         * Determines the order in which the symbolic builders are to create the meta variables of the (non-transient)
+         * state variables of the given program. The order is computed according to the build settings, that is it is
+         * imported from a file, computed by the chosen heuristic and optionally exported to a file.
+         *
+         * @param program The program whose variables to order.
+         * @return The state variables of the program in the order in which to create them.
+         */
+        std::vector<storm::expressions::Variable> getDdVariableOrder(storm::prism::Program const& program);
+        
+        /*!
+         * Determines the order in which the symbolic builders are to create the meta variables of the (non-transient)
+         * state variables of the given model, including the location variables of the automata. The order is computed
+         * according to the build settings, that is it is imported from a file, computed by the chosen heuristic and
+         * optionally exported to a file.
+         *
+         * @param model The model whose variables to order.
+         * @return The state variables of the model in the order in which to create them.
+         */
+        std::vector<storm::expressions::Variable> getDdVariableOrder(storm::jani::Model const& model);
+        
+        /*!
+         * Orders the given variables using the FORCE heuristic, which repeatedly moves each variable to the average
+         * center of gravity of the dependencies it is involved in. Variables that depend on each other thereby end up
+         * close to each other, which typically keeps the DDs of the transition relation small.
+         *
+         * @param variables The variables to order, where the given order serves as the initial order.
+         * @param dependencies Sets of variables that depend on each other (e.g. all variables of a command).
+         * Variables that are not contained in the given variables are ignored.
+         * @return The variables in the order with the smallest total span of the dependencies that was encountered.
+         */
+        std::vector<storm::expressions::Variable> computeForceOrder(std::vector<storm::expressions::Variable> const& variables, std::vector<std::set<storm::expressions::Variable>> const& dependencies);
+        
+        /*!
+         * Reorders the given variables according to the order of the variable names in the given file (one name per
+         * line). Variables that do not appear in the file are placed after all others (in the given order).
+         *
+         * @param variables The variables to order.
+         * @param filename The file from which to read the order.
+         * @return The ordered variables.
+         */
+        std::vector<storm::expressions::Variable> importDdVariableOrder(std::vector<storm::expressions::Variable> const& variables, std::string const& filename);
+        
+        /*!
+         * Writes the names of the given variables to the given file (one name per line) such that the order can be
+         * imported again via importDdVariableOrder.
+         *
+         * @param order The ordered variables.
+         * @param filename The file to which to write the order.
+         */
+        void exportDdVariableOrder(std::vector<storm::expressions::Variable> const& order, std::string const& filename);
+        
+    }
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <ostream>
+
+namespace storm {
+    namespace builder {
+        
+        // An enum that contains all heuristics to order the state variables of symbolically built models.
+        enum class DdVariableOrderingHeuristic { Declaration, Force };
+        
+        std::ostream& operator<<(std::ostream& out, DdVariableOrderingHeuristic const& heuristic);
+        
+    }
+}
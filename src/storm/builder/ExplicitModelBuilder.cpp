@@ -34,6 +34,7 @@
 #include "storm/utility/macros.h"
 #include "storm/utility/ConstantsComparator.h"
 #include "storm/utility/builder.h"
+#include "storm/utility/Profiler.h"
 
 #include "storm/exceptions/WrongFormatException.h"
 #include "storm/exceptions/InvalidArgumentException.h"
@@ -86,6 +87,17 @@ namespace storm {
         
         template <typename ValueType, typename RewardModelType, typename StateType>
         StateType ExplicitModelBuilder<ValueType, RewardModelType, StateType>::getOrAddStateIndex(CompressedState const& state) {
+            // If the generator found symmetries, we only store the canonical representative of the state.
+            if (generator->hasSymmetries()) {
+                CompressedState canonicalState = state;
+                generator->canonicalize(canonicalState);
+                return getOrAddCanonicalStateIndex(canonicalState);
+            }
+            return getOrAddCanonicalStateIndex(state);
+        }
+        
+        template <typename ValueType, typename RewardModelType, typename StateType>
+        StateType ExplicitModelBuilder<ValueType, RewardModelType, StateType>::getOrAddCanonicalStateIndex(CompressedState const& state) {
             StateType newIndex = static_cast<StateType>(stateStorage.getNumberOfStates());
             
             // Check, if the state was already registered.
@@ -312,7 +324,11 @@ namespace storm {
             ChoiceInformationBuilder choiceInformationBuilder;
             boost::optional<storm::storage::BitVector> markovianStates;
             
-            buildMatrices(transitionMatrixBuilder, rewardModelBuilders, choiceInformationBuilder, markovianStates);
+            {
+                storm::utility::ProfilerPhase phase("exploration");
+                buildMatrices(transitionMatrixBuilder, rewardModelBuilders, choiceInformationBuilder, markovianStates);
+                storm::utility::addToProfilerCounter("states explored", stateStorage.getNumberOfStates());
+            }
             
             // Initialize the model components with the obtained information.
             storm::storage::sparse::ModelComponents<ValueType, RewardModelType> modelComponents(transitionMatrixBuilder.build(0, transitionMatrixBuilder.getCurrentRowGroupCount()), buildStateLabeling(), std::unordered_map<std::string, RewardModelType>(), !generator->isDiscreteTimeModel(), std::move(markovianStates));
@@ -407,6 +423,7 @@ namespace storm {
         
         template <typename ValueType, typename RewardModelType, typename StateType>
         storm::models::sparse::StateLabeling ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildStateLabeling() {
+            storm::utility::ProfilerPhase phase("labeling");
             return generator->label(stateStorage, stateStorage.initialStateIndices, stateStorage.deadlockStateIndices);
         }
         
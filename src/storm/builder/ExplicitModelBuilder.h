@@ -101,6 +101,15 @@ namespace storm {
              * @return A pair indicating whether the state was already discovered before and the state id of the state.
              */
             StateType getOrAddStateIndex(CompressedState const& state);
+
+            /*!
+             * Retrieves the state id of the given state, which is assumed to be canonical with respect to the symmetries
+             * found by the generator. If the state has not been encountered yet, it is added.
+             *
+             * @param state The (canonical) state for which to retrieve the index.
+             * @return The state id of the state.
+             */
+            StateType getOrAddCanonicalStateIndex(CompressedState const& state);
     
             /*!
              * Builds the transition matrix and the transition reward matrix based for the given program.
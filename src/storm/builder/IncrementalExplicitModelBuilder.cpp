@@ -0,0 +1,240 @@
+#include "storm/builder/IncrementalExplicitModelBuilder.h"
+
+#include <carl/core/VariablePool.h>
+
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/generator/PrismNextStateGenerator.h"
+#include "storm/generator/JaniNextStateGenerator.h"
+
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/sparse/ModelComponents.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/exceptions/WrongFormatException.h"
+
+namespace storm {
+    namespace builder {
+
+        template<typename ValueType>
+        IncrementalExplicitModelBuilder<ValueType>::IncrementalExplicitModelBuilder(storm::storage::SymbolicModelDescription const& model, storm::builder::BuilderOptions const& options) : model(model), options(options), graphPreserving(canHandle(model)), lastBuildIncremental(false), lastBuildReturnedInstantiatedModel(false) {
+            STORM_LOG_INFO_COND(graphPreserving, "The undefined constants may affect the structure of the model, so the model is rebuilt for every valuation.");
+        }
+
+        template<typename ValueType>
+        bool IncrementalExplicitModelBuilder<ValueType>::canHandle(storm::storage::SymbolicModelDescription const& model) {
+            // Updating the model in place requires that no derived information (such as exit rates) depends on the values.
+            if (model.getModelType() != storm::storage::SymbolicModelDescription::ModelType::DTMC && model.getModelType() != storm::storage::SymbolicModelDescription::ModelType::MDP) {
+                return false;
+            }
+            if (model.isPrismProgram()) {
+                return model.asPrismProgram().undefinedConstantsAreGraphPreserving();
+            } else if (model.isJaniModel()) {
+                return model.asJaniModel().undefinedConstantsAreGraphPreserving();
+            }
+            return false;
+        }
+
+        template<typename ValueType>
+        std::shared_ptr<storm::models::sparse::Model<ValueType>> IncrementalExplicitModelBuilder<ValueType>::build(std::map<storm::expressions::Variable, storm::expressions::Expression> const& constantDefinitions) {
+            std::shared_ptr<storm::models::sparse::Model<ValueType>> result;
+            if (graphPreserving) {
+                if (!instantiatedModel) {
+                    buildParametricModel();
+                    createInstantiatedModel();
+                }
+                if (instantiate(constantDefinitions)) {
+                    // The model was only updated if the previous call returned the very same model. After a rebuild
+                    // from scratch, the previous model may have different states.
+                    lastBuildIncremental = lastBuildReturnedInstantiatedModel;
+                    lastBuildReturnedInstantiatedModel = true;
+                    result = instantiatedModel;
+                } else {
+                    STORM_LOG_INFO("The given valuation changes the structure of the model. Rebuilding the model.");
+                }
+            }
+
+            if (!result) {
+                lastBuildIncremental = false;
+                lastBuildReturnedInstantiatedModel = false;
+                result = buildFromScratch(constantDefinitions);
+            }
+
+            // Values of the constants may yield negative probabilities or probabilities that do not sum to one.
+            STORM_LOG_THROW(result->getTransitionMatrix().isProbabilistic(), storm::exceptions::WrongFormatException, "The transition probabilities do not form probability distributions for the given values of the constants.");
+            return result;
+        }
+
+        template<typename ValueType>
+        bool IncrementalExplicitModelBuilder<ValueType>::isLastBuildIncremental() const {
+            return lastBuildIncremental;
+        }
+
+        template<typename ValueType>
+        void IncrementalExplicitModelBuilder<ValueType>::buildParametricModel() {
+            std::shared_ptr<storm::generator::NextStateGenerator<storm::RationalFunction, uint32_t>> generator;
+            if (model.isPrismProgram()) {
+                generator = std::make_shared<storm::generator::PrismNextStateGenerator<storm::RationalFunction, uint32_t>>(model.asPrismProgram(), options);
+            } else {
+                STORM_LOG_ASSERT(model.isJaniModel(), "Unexpected model description.");
+                generator = std::make_shared<storm::generator::JaniNextStateGenerator<storm::RationalFunction, uint32_t>>(model.asJaniModel(), options);
+            }
+            storm::builder::ExplicitModelBuilder<storm::RationalFunction> builder(generator);
+            parametricModel = builder.build();
+        }
+
+        template<typename ValueType>
+        void IncrementalExplicitModelBuilder<ValueType>::createInstantiatedModel() {
+            storm::storage::SparseMatrix<storm::RationalFunction> const& parametricMatrix = parametricModel->getTransitionMatrix();
+
+            // Build a matrix with the same structure. The values of entries with non-constant functions are set upon instantiation.
+            storm::storage::SparseMatrixBuilder<ValueType> matrixBuilder(parametricMatrix.getRowCount(), parametricMatrix.getColumnCount(), parametricMatrix.getEntryCount(), true, !parametricMatrix.hasTrivialRowGrouping(), parametricMatrix.hasTrivialRowGrouping() ? 0 : parametricMatrix.getRowGroupCount());
+            uint64_t entryOffset = 0;
+            for (uint64_t rowGroup = 0; rowGroup < parametricMatrix.getRowGroupCount(); ++rowGroup) {
+                if (!parametricMatrix.hasTrivialRowGrouping()) {
+                    matrixBuilder.newRowGroup(parametricMatrix.getRowGroupIndices()[rowGroup]);
+                }
+                for (uint64_t row = parametricMatrix.getRowGroupIndices()[rowGroup]; row < parametricMatrix.getRowGroupIndices()[rowGroup + 1]; ++row) {
+                    for (auto const& entry : parametricMatrix.getRow(row)) {
+                        if (storm::utility::isConstant(entry.getValue())) {
+                            matrixBuilder.addNextValue(row, entry.getColumn(), storm::utility::convertNumber<ValueType>(entry.getValue()));
+                        } else {
+                            matrixBuilder.addNextValue(row, entry.getColumn(), storm::utility::one<ValueType>());
+                            matrixEntryToFunction.emplace_back(entryOffset, getFunctionIndex(entry.getValue()));
+                        }
+                        ++entryOffset;
+                    }
+                }
+            }
+
+            std::unordered_map<std::string, storm::models::sparse::StandardRewardModel<ValueType>> rewardModels;
+            for (auto const& parametricRewardModel : parametricModel->getRewardModels()) {
+                STORM_LOG_THROW(!parametricRewardModel.second.hasTransitionRewards(), storm::exceptions::NotSupportedException, "Transition rewards are not supported when building incrementally.");
+                boost::optional<std::vector<ValueType>> stateRewards;
+                if (parametricRewardModel.second.hasStateRewards()) {
+                    stateRewards = std::vector<ValueType>(parametricRewardModel.second.getStateRewardVector().size());
+                }
+                boost::optional<std::vector<ValueType>> stateActionRewards;
+                if (parametricRewardModel.second.hasStateActionRewards()) {
+                    stateActionRewards = std::vector<ValueType>(parametricRewardModel.second.getStateActionRewardVector().size());
+                }
+                rewardModels.emplace(parametricRewardModel.first, storm::models::sparse::StandardRewardModel<ValueType>(std::move(stateRewards), std::move(stateActionRewards)));
+            }
+
+            storm::storage::sparse::ModelComponents<ValueType> components(matrixBuilder.build(), parametricModel->getStateLabeling(), std::move(rewardModels));
+            components.choiceLabeling = parametricModel->getOptionalChoiceLabeling();
+            components.stateValuations = parametricModel->getOptionalStateValuations();
+            components.choiceOrigins = parametricModel->getOptionalChoiceOrigins();
+            if (parametricModel->getType() == storm::models::ModelType::Dtmc) {
+                instantiatedModel = std::make_shared<storm::models::sparse::Dtmc<ValueType>>(std::move(components));
+            } else {
+                STORM_LOG_ASSERT(parametricModel->getType() == storm::models::ModelType::Mdp, "Unexpected model type.");
+                instantiatedModel = std::make_shared<storm::models::sparse::Mdp<ValueType>>(std::move(components));
+            }
+
+            // Now that the reward vectors are at their final location, record the functions of their entries.
+            for (auto& rewardModel : instantiatedModel->getRewardModels()) {
+                auto const& parametricRewardModel = parametricModel->getRewardModel(rewardModel.first);
+                std::vector<std::pair<std::vector<ValueType>*, std::vector<storm::RationalFunction> const*>> vectors;
+                if (rewardModel.second.hasStateRewards()) {
+                    vectors.emplace_back(&rewardModel.second.getStateRewardVector(), &parametricRewardModel.getStateRewardVector());
+                }
+                if (rewardModel.second.hasStateActionRewards()) {
+                    vectors.emplace_back(&rewardModel.second.getStateActionRewardVector(), &parametricRewardModel.getStateActionRewardVector());
+                }
+                for (auto const& vectorPair : vectors) {
+                    std::vector<std::pair<uint64_t, uint64_t>> entryToFunction;
+                    for (uint64_t offset = 0; offset < vectorPair.second->size(); ++offset) {
+                        storm::RationalFunction const& function = (*vectorPair.second)[offset];
+                        if (storm::utility::isConstant(function)) {
+                            (*vectorPair.first)[offset] = storm::utility::convertNumber<ValueType>(function);
+                        } else {
+                            entryToFunction.emplace_back(offset, getFunctionIndex(function));
+                        }
+                    }
+                    if (!entryToFunction.empty()) {
+                        rewardEntryToFunction.emplace_back(vectorPair.first, std::move(entryToFunction));
+                    }
+                }
+            }
+
+            functionValues.resize(functions.size());
+            STORM_LOG_INFO("Recorded " << functions.size() << " distinct functions for " << matrixEntryToFunction.size() << " matrix entries.");
+        }
+
+        template<typename ValueType>
+        uint64_t IncrementalExplicitModelBuilder<ValueType>::getFunctionIndex(storm::RationalFunction const& function) {
+            auto insertionResult = functionToIndex.emplace(function, functions.size());
+            if (insertionResult.second) {
+                functions.push_back(function);
+            }
+            return insertionResult.first->second;
+        }
+
+        template<typename ValueType>
+        bool IncrementalExplicitModelBuilder<ValueType>::instantiate(std::map<storm::expressions::Variable, storm::expressions::Expression> const& constantDefinitions) {
+            // The functions refer to the constants by their name.
+            std::map<std::string, storm::RationalFunctionCoefficient> nameToValue;
+            for (auto const& definition : constantDefinitions) {
+                nameToValue.emplace(definition.first.getName(), storm::utility::convertNumber<storm::RationalFunctionCoefficient>(storm::utility::convertNumber<storm::RationalFunction>(definition.second.evaluateAsRational())));
+            }
+
+            std::map<storm::RationalFunctionVariable, storm::RationalFunctionCoefficient> valuation;
+            for (uint64_t functionIndex = 0; functionIndex < functions.size(); ++functionIndex) {
+                std::set<storm::RationalFunctionVariable> variables;
+                functions[functionIndex].gatherVariables(variables);
+                for (auto const& variable : variables) {
+                    if (valuation.find(variable) == valuation.end()) {
+                        std::string name = carl::VariablePool::getInstance().getName(variable, true);
+                        auto valueIt = nameToValue.find(name);
+                        STORM_LOG_THROW(valueIt != nameToValue.end(), storm::exceptions::InvalidArgumentException, "No value given for constant '" << name << "'.");
+                        valuation.emplace(variable, valueIt->second);
+                    }
+                }
+                functionValues[functionIndex] = storm::utility::convertNumber<ValueType>(functions[functionIndex].evaluate(valuation));
+            }
+
+            // Check all transitions before writing any value, so that the model is left untouched if it can not be reused.
+            for (auto const& entryFunctionPair : matrixEntryToFunction) {
+                if (functionValues[entryFunctionPair.second] <= storm::utility::zero<ValueType>()) {
+                    // The transition vanishes, so the previous model can not be reused.
+                    return false;
+                }
+            }
+            
+            auto matrixBegin = instantiatedModel->getTransitionMatrix().begin();
+            for (auto const& entryFunctionPair : matrixEntryToFunction) {
+                (matrixBegin + entryFunctionPair.first)->setValue(functionValues[entryFunctionPair.second]);
+            }
+            for (auto const& vectorEntries : rewardEntryToFunction) {
+                for (auto const& entryFunctionPair : vectorEntries.second) {
+                    (*vectorEntries.first)[entryFunctionPair.first] = functionValues[entryFunctionPair.second];
+                }
+            }
+            return true;
+        }
+
+        template<typename ValueType>
+        std::shared_ptr<storm::models::sparse::Model<ValueType>> IncrementalExplicitModelBuilder<ValueType>::buildFromScratch(std::map<storm::expressions::Variable, storm::expressions::Expression> const& constantDefinitions) const {
+            storm::storage::SymbolicModelDescription instantiatedDescription = model.preprocess(constantDefinitions);
+            std::shared_ptr<storm::generator::NextStateGenerator<ValueType, uint32_t>> generator;
+            if (instantiatedDescription.isPrismProgram()) {
+                generator = std::make_shared<storm::generator::PrismNextStateGenerator<ValueType, uint32_t>>(instantiatedDescription.asPrismProgram(), options);
+            } else {
+                STORM_LOG_ASSERT(instantiatedDescription.isJaniModel(), "Unexpected model description.");
+                generator = std::make_shared<storm::generator::JaniNextStateGenerator<ValueType, uint32_t>>(instantiatedDescription.asJaniModel(), options);
+            }
+            storm::builder::ExplicitModelBuilder<ValueType> builder(generator);
+            return builder.build();
+        }
+
+        template class IncrementalExplicitModelBuilder<double>;
+        template class IncrementalExplicitModelBuilder<storm::RationalNumber>;
+
+    }
+}
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <vector>
+#include <unordered_map>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm/builder/BuilderOptions.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/SymbolicModelDescription.h"
+#include "storm/storage/expressions/Variable.h"
+#include "storm/storage/expressions/Expression.h"
+
+namespace storm {
+    namespace builder {
+
+        /*!
+         * Builds sparse models of a symbolic model description for changing values of some of its constants. The model
+         * is built only once with the (swept) constants being kept symbolic. The value of every transition and reward
+         * is recorded as a function over these constants, so that the model for new values of the constants can be
+         * obtained by patching the values of the previously built model in place.
+         *
+         * This is only possible if the constants do not affect the graph structure of the model, which is checked on
+         * the description level (the constants may not appear in guards, bounds, initial values, etc.) and for every
+         * valuation (no transition may vanish). If either check fails, the model is rebuilt from scratch.
+         */
+        template<typename ValueType>
+        class IncrementalExplicitModelBuilder {
+        public:
+            /*!
+             * Creates a builder for the given model description. All constants of the description that are not defined
+             * are treated as swept constants and need to be given a value upon every call to build.
+             *
+             * @param model The model description whose undefined constants are swept.
+             * @param options The options used for building the model.
+             */
+            IncrementalExplicitModelBuilder(storm::storage::SymbolicModelDescription const& model, storm::builder::BuilderOptions const& options);
+
+            /*!
+             * Retrieves whether the undefined constants of the given description only affect the values of the
+             * transitions and rewards such that incremental building can be applied at all.
+             */
+            static bool canHandle(storm::storage::SymbolicModelDescription const& model);
+
+            /*!
+             * Retrieves the model for the given values of the swept constants. If possible, the model returned by the
+             * previous call is updated in place and returned again. Hence, callers must not rely on a previously
+             * returned model to keep its values. Throws a WrongFormatException if the transition probabilities do not
+             * form probability distributions for the given values.
+             *
+             * @param constantDefinitions A mapping from all swept constants to their values.
+             * @return The model.
+             */
+            std::shared_ptr<storm::models::sparse::Model<ValueType>> build(std::map<storm::expressions::Variable, storm::expressions::Expression> const& constantDefinitions);
+
+            /*!
+             * Retrieves whether the last call to build obtained the model by updating the model returned by the call
+             * before in place. If so, the model has the same states and transitions as the previously returned one and
+             * results of the previous model may serve as hints for the current one.
+             */
+            bool isLastBuildIncremental() const;
+
+        private:
+            /*!
+             * Builds the model in which the swept constants are kept symbolic and records the functions of all
+             * transitions and rewards.
+             */
+            void buildParametricModel();
+
+            /*!
+             * Creates a model with the structure of the parametric model whose values are set by instantiate().
+             */
+            void createInstantiatedModel();
+
+            /*!
+             * Builds the model for the given values of the swept constants from scratch.
+             */
+            std::shared_ptr<storm::models::sparse::Model<ValueType>> buildFromScratch(std::map<storm::expressions::Variable, storm::expressions::Expression> const& constantDefinitions) const;
+
+            /*!
+             * Evaluates all recorded functions and writes the values to the instantiated model. Returns false if the
+             * graph structure is not preserved under the given values, i.e., if some transition gets probability zero.
+             * In this case, the values of the instantiated model are left unchanged.
+             */
+            bool instantiate(std::map<storm::expressions::Variable, storm::expressions::Expression> const& constantDefinitions);
+
+            /*!
+             * Retrieves the index of the given function in the list of recorded functions (and inserts it if necessary).
+             */
+            uint64_t getFunctionIndex(storm::RationalFunction const& function);
+
+            /// The description of the model whose undefined constants are swept.
+            storm::storage::SymbolicModelDescription model;
+
+            /// The options used for building the model.
+            storm::builder::BuilderOptions options;
+
+            /// Whether the structure of the model is independent of the swept constants.
+            bool graphPreserving;
+
+            /// The model in which the swept constants are kept symbolic (if it was built already).
+            std::shared_ptr<storm::models::sparse::Model<storm::RationalFunction>> parametricModel;
+
+            /// The model that is updated in place.
+            std::shared_ptr<storm::models::sparse::Model<ValueType>> instantiatedModel;
+
+            /// The distinct functions occurring in the parametric model, their indices and their values of the current valuation.
+            std::vector<storm::RationalFunction> functions;
+            std::unordered_map<storm::RationalFunction, uint64_t> functionToIndex;
+            std::vector<ValueType> functionValues;
+
+            /// For each non-constant matrix entry (given by its offset in the matrix), the index of the function that yields its value.
+            std::vector<std::pair<uint64_t, uint64_t>> matrixEntryToFunction;
+
+            /// For each non-constant reward vector entry (given by the reward model, the vector and the offset), the index of the function that yields its value.
+            std::vector<std::pair<std::vector<ValueType>*, std::vector<std::pair<uint64_t, uint64_t>>>> rewardEntryToFunction;
+
+            /// Whether the last call to build updated the model in place.
+            bool lastBuildIncremental;
+
+            /// Whether the last call to build returned the instantiated model (rather than a model built from scratch).
+            bool lastBuildReturnedInstantiatedModel;
+        };
+
+    }
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <ostream>
+
+namespace storm {
+    namespace builder {
+        
+        // An enum that contains all strategies to compute the reachable states of symbolically built models.
+        enum class SymbolicReachabilityStrategy { Bfs, Chaining, Saturation };
+        
+        std::ostream& operator<<(std::ostream& out, SymbolicReachabilityStrategy const& strategy);
+        
+    }
+}
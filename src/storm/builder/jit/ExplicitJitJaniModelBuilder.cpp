@@ -4,6 +4,8 @@
 #include <cstdio>
 #include <chrono>
 #include <errno.h>
+#include <fstream>
+#include <iomanip>
 
 #include "storm/solver/SmtSolver.h"
 
@@ -24,6 +26,8 @@
 
 #include "storm/utility/macros.h"
 #include "storm/utility/solver.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/storm-version.h"
 #include "storm/exceptions/WrongFormatException.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/InvalidArgumentException.h"
@@ -100,26 +104,15 @@ namespace storm {
                     carlIncludeDirectory = STORM_CARL_INCLUDE_DIR;
                 }
                 sparseppIncludeDirectory = STORM_BUILD_DIR "/include/resources/3rdparty/sparsepp/";
+                if (settings.isCacheDirectorySet()) {
+                    cacheDirectory = settings.getCacheDirectory();
+                }
                 
                 // Register all transient variables as transient.
                 for (auto const& variable : this->model.getGlobalVariables().getTransientVariables()) {
                     transientVariables.insert(variable.getExpressionVariable());
                 }
                 
-                // Construct vector of the automata to be put in parallel.
-                storm::jani::Composition const& topLevelComposition = this->model.getSystemComposition();
-                if (topLevelComposition.isAutomatonComposition()) {
-                    parallelAutomata.push_back(this->model.getAutomaton(topLevelComposition.asAutomatonComposition().getAutomatonName()));
-                } else {
-                    STORM_LOG_THROW(topLevelComposition.isParallelComposition(), storm::exceptions::WrongFormatException, "Expected parallel composition.");
-                    storm::jani::ParallelComposition const& parallelComposition = topLevelComposition.asParallelComposition();
-                    
-                    for (auto const& composition : parallelComposition.getSubcompositions()) {
-                        STORM_LOG_THROW(composition->isAutomatonComposition(), storm::exceptions::WrongFormatException, "Expected flat parallel composition.");
-                        parallelAutomata.push_back(this->model.getAutomaton(composition->asAutomatonComposition().getAutomatonName()));
-                    }
-                }
-                
                 // If the program still contains undefined constants and we are not in a parametric setting, assemble an appropriate error message.
 #ifdef STORM_HAVE_CARL
                 if (!std::is_same<ValueType, storm::RationalFunction>::value && this->model.hasUndefinedConstants()) {
@@ -151,6 +144,28 @@ namespace storm {
                 features.remove(storm::jani::ModelFeature::StateExitRewards);
                 STORM_LOG_THROW(features.empty(), storm::exceptions::InvalidArgumentException, "The jit model builder does not support the following model feature(s): " << features.toString() << ".");
                 
+                if (settings.isLoadTimeConstantsSet()) {
+                    if (std::is_same<double, ValueType>::value) {
+                        liftLoadTimeConstants(model);
+                    } else {
+                        STORM_LOG_WARN("Passing constants at load time is only supported for floating point models. The constants are compiled into the builder instead.");
+                    }
+                }
+
+                // Construct vector of the automata to be put in parallel.
+                storm::jani::Composition const& topLevelComposition = this->model.getSystemComposition();
+                if (topLevelComposition.isAutomatonComposition()) {
+                    parallelAutomata.push_back(this->model.getAutomaton(topLevelComposition.asAutomatonComposition().getAutomatonName()));
+                } else {
+                    STORM_LOG_THROW(topLevelComposition.isParallelComposition(), storm::exceptions::WrongFormatException, "Expected parallel composition.");
+                    storm::jani::ParallelComposition const& parallelComposition = topLevelComposition.asParallelComposition();
+                    
+                    for (auto const& composition : parallelComposition.getSubcompositions()) {
+                        STORM_LOG_THROW(composition->isAutomatonComposition(), storm::exceptions::WrongFormatException, "Expected flat parallel composition.");
+                        parallelAutomata.push_back(this->model.getAutomaton(composition->asAutomatonComposition().getAutomatonName()));
+                    }
+                }
+                
                 //STORM_LOG_THROW(!model.reusesActionsInComposition(), storm::exceptions::InvalidArgumentException, "The jit JANI model builder currently does not support reusing actions in parallel composition");
 
                 // Comment this in to print the JANI model for debugging purposes.
@@ -158,6 +173,85 @@ namespace storm {
                 // storm::jani::JsonExporter::toStream(this->model, std::vector<std::shared_ptr<storm::logic::Formula const>>(), std::cout, false);
             }
             
+            template <typename ValueType, typename RewardModelType>
+            void ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::liftLoadTimeConstants(storm::jani::Model const& originalModel) {
+                // The model in which all constants are substituted determines the values of the constants.
+                storm::jani::Model substitutedModel = originalModel.substituteConstants();
+                std::set<storm::expressions::Variable> candidates;
+                for (auto const& constant : substitutedModel.getConstants()) {
+                    if (constant.isDefined() && constant.isRealConstant() && !constant.getExpression().containsVariables()) {
+                        candidates.insert(constant.getExpressionVariable());
+                    }
+                }
+                
+                // Constants that occur in expressions that are evaluated while generating the source code (bounds,
+                // initial values and initial states restrictions) cannot be passed at load time. Since constants may be
+                // defined in terms of other constants, we repeat the substitution until no such constant remains.
+                while (!candidates.empty()) {
+                    storm::jani::Model liftedModel(originalModel);
+                    for (auto& constant : liftedModel.getConstants()) {
+                        if (candidates.find(constant.getExpressionVariable()) != candidates.end()) {
+                            constant = storm::jani::Constant(constant.getName(), constant.getExpressionVariable(), storm::expressions::Expression(), constant.hasConstraint() ? constant.getConstraintExpression() : storm::expressions::Expression());
+                        }
+                    }
+                    liftedModel = liftedModel.substituteConstantsFunctions();
+                    
+                    std::set<storm::expressions::Variable> generationTimeVariables;
+                    auto addVariables = [&generationTimeVariables] (storm::expressions::Expression const& expression) {
+                        if (expression.isInitialized()) {
+                            auto variables = expression.getVariables();
+                            generationTimeVariables.insert(variables.begin(), variables.end());
+                        }
+                    };
+                    auto addVariableSet = [&addVariables] (storm::jani::VariableSet const& variableSet) {
+                        for (auto const& variable : variableSet) {
+                            if (variable.hasInitExpression()) {
+                                addVariables(variable.getInitExpression());
+                            }
+                        }
+                        for (auto const& variable : variableSet.getBoundedIntegerVariables()) {
+                            if (variable.hasLowerBound()) {
+                                addVariables(variable.getLowerBound());
+                            }
+                            if (variable.hasUpperBound()) {
+                                addVariables(variable.getUpperBound());
+                            }
+                        }
+                    };
+                    addVariableSet(liftedModel.getGlobalVariables());
+                    if (liftedModel.hasInitialStatesRestriction()) {
+                        addVariables(liftedModel.getInitialStatesRestriction());
+                    }
+                    for (auto const& automaton : liftedModel.getAutomata()) {
+                        addVariableSet(automaton.getVariables());
+                        if (automaton.hasInitialStatesRestriction()) {
+                            addVariables(automaton.getInitialStatesRestriction());
+                        }
+                    }
+                    
+                    bool foundGenerationTimeConstant = false;
+                    for (auto const& variable : generationTimeVariables) {
+                        if (candidates.erase(variable) > 0) {
+                            STORM_LOG_DEBUG("Constant '" << variable.getName() << "' is needed while generating the builder and is therefore compiled into it.");
+                            foundGenerationTimeConstant = true;
+                        }
+                    }
+                    
+                    if (!foundGenerationTimeConstant) {
+                        this->model = std::move(liftedModel);
+                        break;
+                    }
+                }
+                
+                for (auto const& constant : substitutedModel.getConstants()) {
+                    if (candidates.find(constant.getExpressionVariable()) != candidates.end()) {
+                        loadTimeConstants.push_back(constant.getExpressionVariable());
+                        loadTimeConstantValues.push_back(storm::utility::convertNumber<double>(constant.getExpression().evaluateAsRational()));
+                    }
+                }
+                STORM_LOG_DEBUG("Passing " << loadTimeConstants.size() << " constant(s) to the builder at load time.");
+            }
+            
             template <typename ValueType, typename RewardModelType>
             boost::optional<std::string> ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::execute(std::string command) {
                 auto start = std::chrono::high_resolution_clock::now();
@@ -468,28 +562,145 @@ namespace storm {
             }
             
             template <typename ValueType, typename RewardModelType>
-            std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::build() {
-                // (0) Assemble information about the model.
-                cpptempl::data_map modelData = generateModelData();
-                
-                // (1) generate the source code of the shared library
-                std::string source;
-                try {
-                    source = createSourceCodeFromSkeleton(modelData);
-                } catch (std::exception const& e) {
-                    STORM_LOG_THROW(false, storm::exceptions::UnexpectedException, "Could not create the source code for model generation (error: " << e.what() << ").");
+            std::string const& ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::getSourceCode() {
+                if (!sourceCode) {
+                    // Assemble information about the model.
+                    cpptempl::data_map modelData = generateModelData();
+                    
+                    // Generate the source code of the shared library.
+                    try {
+                        sourceCode = createSourceCodeFromSkeleton(modelData);
+                    } catch (std::exception const& e) {
+                        STORM_LOG_THROW(false, storm::exceptions::UnexpectedException, "Could not create the source code for model generation (error: " << e.what() << ").");
+                    }
+                    STORM_LOG_TRACE("Successfully created source code for model generation: " << sourceCode.get());
+                }
+                return sourceCode.get();
+            }
+            
+            template <typename ValueType, typename RewardModelType>
+            std::string ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::getCacheKey(std::string const& source) const {
+                std::stringstream keyStream;
+                keyStream << "// " << storm::utility::StormVersion::longVersionString() << std::endl;
+                keyStream << "// " << compiler << " " << compilerFlags << std::endl;
+                keyStream << "// -I" << stormIncludeDirectory << " -I" << sparseppIncludeDirectory << " -I" << boostIncludeDirectory << " -I" << carlIncludeDirectory << std::endl;
+                keyStream << source;
+                return keyStream.str();
+            }
+            
+            /*!
+             * Computes the 64-bit FNV-1a hash of the given string as a hexadecimal string. Unlike std::hash, the result
+             * is stable across runs and platforms, which is required for naming the entries of the compile cache.
+             */
+            static std::string computeStableHash(std::string const& content) {
+                uint64_t hash = 14695981039346656037ull;
+                for (char c : content) {
+                    hash ^= static_cast<uint64_t>(static_cast<unsigned char>(c));
+                    hash *= 1099511628211ull;
+                }
+                std::stringstream hashStream;
+                hashStream << std::hex << std::setw(16) << std::setfill('0') << hash;
+                return hashStream.str();
+            }
+            
+            template <typename ValueType, typename RewardModelType>
+            boost::optional<boost::filesystem::path> ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::getCachedLibraryPath(std::string const& cacheKey) const {
+                STORM_LOG_ASSERT(cacheDirectory, "Expected compile cache directory.");
+                std::string hash = computeStableHash(cacheKey);
+                boost::filesystem::path keyFile = boost::filesystem::path(cacheDirectory.get()) / (hash + ".key");
+                boost::filesystem::path libraryFile = boost::filesystem::path(cacheDirectory.get()) / (hash + DYLIB_EXTENSION);
+                
+                // The key file is written after the library, so its presence signals a complete cache entry.
+                if (!boost::filesystem::exists(keyFile) || !boost::filesystem::exists(libraryFile)) {
+                    return boost::none;
                 }
-                STORM_LOG_TRACE("Successfully created source code for model generation: " << source);
                 
-                // (2) Write the source code to a temporary file.
-                boost::filesystem::path temporarySourceFile = writeToTemporaryFile(source);
+                // Compare the full key to rule out hash collisions.
+                std::ifstream keyStream(keyFile.native(), std::ios::binary);
+                std::string storedKey((std::istreambuf_iterator<char>(keyStream)), std::istreambuf_iterator<char>());
+                if (storedKey != cacheKey) {
+                    STORM_LOG_DEBUG("Compile cache entry " << hash << " belongs to a different source.");
+                    return boost::none;
+                }
+                return libraryFile;
+            }
+            
+            template <typename ValueType, typename RewardModelType>
+            boost::optional<boost::filesystem::path> ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::storeInCache(std::string const& cacheKey, boost::filesystem::path const& dynamicLibraryPath) const {
+                STORM_LOG_ASSERT(cacheDirectory, "Expected compile cache directory.");
+                std::string hash = computeStableHash(cacheKey);
+                boost::filesystem::path directory(cacheDirectory.get());
+                boost::filesystem::path keyFile = directory / (hash + ".key");
+                boost::filesystem::path libraryFile = directory / (hash + DYLIB_EXTENSION);
                 
-                // (3) Compile the source code to a shared library.
-                boost::filesystem::path dynamicLibraryPath = compileToSharedLibrary(temporarySourceFile);
-                STORM_LOG_TRACE("Successfully compiled shared library.");
+                try {
+                    boost::filesystem::create_directories(directory);
+                    
+                    // Concurrent runs may populate the same entry, so we write to unique files and rename them, which
+                    // replaces existing entries atomically.
+                    boost::filesystem::path temporaryLibraryFile = directory / boost::filesystem::unique_path(hash + "-%%%%-%%%%" + DYLIB_EXTENSION);
+                    boost::filesystem::copy_file(dynamicLibraryPath, temporaryLibraryFile);
+                    boost::filesystem::rename(temporaryLibraryFile, libraryFile);
+                    
+                    boost::filesystem::path temporaryKeyFile = directory / boost::filesystem::unique_path(hash + "-%%%%-%%%%.key");
+                    std::ofstream keyStream(temporaryKeyFile.native(), std::ios::binary);
+                    keyStream << cacheKey;
+                    keyStream.close();
+                    boost::filesystem::rename(temporaryKeyFile, keyFile);
+                } catch (boost::filesystem::filesystem_error const& e) {
+                    STORM_LOG_WARN("Unable to store the compiled builder in the compile cache '" << cacheDirectory.get() << "': " << e.what());
+                    return boost::none;
+                }
                 
-                // (4) Remove the source code of the shared library we just compiled.
-                boost::filesystem::remove(temporarySourceFile);
+                boost::filesystem::remove(dynamicLibraryPath);
+                return libraryFile;
+            }
+            
+            template <typename ValueType, typename RewardModelType>
+            bool ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::isCompiledLibraryCached() {
+                if (!cacheDirectory) {
+                    return false;
+                }
+                return static_cast<bool>(getCachedLibraryPath(getCacheKey(getSourceCode())));
+            }
+            
+            template <typename ValueType, typename RewardModelType>
+            std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::build() {
+                // (0) Assemble information about the model and generate the source code of the shared library.
+                std::string const& source = getSourceCode();
+                
+                // (1) Look up the shared library in the compile cache.
+                boost::filesystem::path dynamicLibraryPath;
+                bool libraryIsCached = false;
+                std::string cacheKey;
+                if (cacheDirectory) {
+                    cacheKey = getCacheKey(source);
+                    boost::optional<boost::filesystem::path> cachedLibraryPath = getCachedLibraryPath(cacheKey);
+                    if (cachedLibraryPath) {
+                        STORM_LOG_INFO("Reusing compiled builder " << cachedLibraryPath.get() << " from compile cache.");
+                        dynamicLibraryPath = cachedLibraryPath.get();
+                        libraryIsCached = true;
+                    }
+                }
+                
+                if (!libraryIsCached) {
+                    // (2) Write the source code to a temporary file.
+                    boost::filesystem::path temporarySourceFile = writeToTemporaryFile(source);
+                    
+                    // (3) Compile the source code to a shared library.
+                    dynamicLibraryPath = compileToSharedLibrary(temporarySourceFile);
+                    STORM_LOG_TRACE("Successfully compiled shared library.");
+                    
+                    // (4) Remove the source code of the shared library we just compiled and store the library in the cache.
+                    boost::filesystem::remove(temporarySourceFile);
+                    if (cacheDirectory) {
+                        boost::optional<boost::filesystem::path> cachedLibraryPath = storeInCache(cacheKey, dynamicLibraryPath);
+                        if (cachedLibraryPath) {
+                            dynamicLibraryPath = cachedLibraryPath.get();
+                            libraryIsCached = true;
+                        }
+                    }
+                }
                 
                 // (5) Create the builder from the shared library.
                 createBuilder(dynamicLibraryPath);
@@ -510,8 +721,10 @@ namespace storm {
                 auto end = std::chrono::high_resolution_clock::now();
                 STORM_LOG_TRACE("Building model took " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms.");
                 
-                // (7) Delete the shared library.
-                boost::filesystem::remove(dynamicLibraryPath);
+                // (7) Delete the shared library unless it is kept in the compile cache.
+                if (!libraryIsCached) {
+                    boost::filesystem::remove(dynamicLibraryPath);
+                }
                 
                 STORM_LOG_THROW(!error, storm::exceptions::WrongFormatException, "Model building failed. Reason: " << error.get());
                 
@@ -567,6 +780,7 @@ namespace storm {
                 if (std::is_same<storm::RationalFunction, ValueType>::value) {
                     generateParameters(modelData);
                 }
+                generateLoadTimeConstants(modelData);
                 
                 // Generate non-trivial model-information.
                 generateVariables(modelData);
@@ -1619,6 +1833,19 @@ namespace storm {
                 modelData["parameters"] = cpptempl::make_data(parameters);
             }
 
+            template <typename ValueType, typename RewardModelType>
+            void ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::generateLoadTimeConstants(cpptempl::data_map& modelData) {
+                cpptempl::data_list constants;
+                for (auto const& constant : loadTimeConstants) {
+                    // Since the constant name might be illegal as a C++ identifier, we need to prepare it a bit.
+                    variableToName[constant] = constant.getName() + JIT_VARIABLE_EXTENSION;
+                    cpptempl::data_map constantData;
+                    constantData["name"] = variableToName[constant];
+                    constants.push_back(constantData);
+                }
+                modelData["load_time_constants"] = cpptempl::make_data(constants);
+            }
+
             template <typename ValueType, typename RewardModelType>
             std::string const& ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::getVariableName(storm::expressions::Variable const& variable) const {
                 return variableToName.at(variable);
@@ -1930,6 +2157,16 @@ namespace storm {
                             }
                             {% endif %}
                             
+                            {% if load_time_constants %}
+                            {% for constant in load_time_constants %}static double {$constant.name};
+                            {% endfor %}
+                            
+                            void initialize_constants(std::vector<double> const& values) {
+                                {% for constant in load_time_constants %}{$constant.name} = values[{$loop.index} - 1];
+                                {% endfor %}
+                            }
+                            {% endif %}
+                            
                             // Non-synchronizing edges.
                             {% for edge in nonsynch_edges %}static bool edge_enabled_{$edge.name}(StateType const& in, TransientVariables const& transientIn) {
                                 if ({$edge.guard}) {
@@ -2474,6 +2711,9 @@ namespace storm {
                             {% if parametric %}
                             BOOST_DLL_ALIAS(storm::builder::jit::initialize_parameters, initialize_parameters)
                             {% endif %}
+                            {% if load_time_constants %}
+                            BOOST_DLL_ALIAS(storm::builder::jit::initialize_constants, initialize_constants)
+                            {% endif %}
                         }
                     }
                 }
@@ -2542,6 +2782,14 @@ namespace storm {
                     std::vector<storm::RationalFunction> parameters = getParameters<ValueType>(this->model, cache);
                     initializeParametersFunction(parameters);
                 }
+                
+                if (!loadTimeConstants.empty()) {
+                    typedef void (InitializeConstantsFunctionType)(std::vector<double> const&);
+                    typedef boost::function<InitializeConstantsFunctionType> ImportInitializeConstantsFunctionType;
+                    
+                    ImportInitializeConstantsFunctionType initializeConstantsFunction = boost::dll::import_alias<InitializeConstantsFunctionType>(dynamicLibraryPath, "initialize_constants");
+                    initializeConstantsFunction(loadTimeConstantValues);
+                }
             }
             
             template class ExplicitJitJaniModelBuilder<double, storm::models::sparse::StandardRewardModel<double>>;
@@ -64,6 +64,12 @@ namespace storm {
                  * general infrastructure for the model builder appears to be working.
                  */
                 bool doctor() const;
+                
+                /*!
+                 * Retrieves whether a compile cache is used and it already contains a compiled builder for the model.
+                 * In this case, building the model does not invoke the compiler.
+                 */
+                bool isCompiledLibraryCached();
 
             private:
                 // Helper methods for the doctor() procedure.
@@ -86,6 +92,35 @@ namespace storm {
                  */
                 static boost::filesystem::path writeToTemporaryFile(std::string const& content, std::string const& suffix = ".cpp");
 
+                /*!
+                 * Replaces the model by a version in which all real-valued constants whose value is not needed while
+                 * generating the source code are kept symbolic. Their values are passed to the shared library when it
+                 * is loaded, so the compiled library does not depend on them.
+                 */
+                void liftLoadTimeConstants(storm::jani::Model const& originalModel);
+                
+                /*!
+                 * Retrieves the source code of the shared library. The source is only generated upon the first call.
+                 */
+                std::string const& getSourceCode();
+                
+                /*!
+                 * Retrieves the key under which the shared library for the given source is stored in the compile cache.
+                 * Besides the source, the key comprises the compiler, its flags and the include directories.
+                 */
+                std::string getCacheKey(std::string const& source) const;
+                
+                /*!
+                 * Retrieves the path of the cached shared library for the given key (if there is any).
+                 */
+                boost::optional<boost::filesystem::path> getCachedLibraryPath(std::string const& cacheKey) const;
+                
+                /*!
+                 * Moves the given shared library to the compile cache and returns its new location. If storing the
+                 * library fails, boost::none is returned and the library is left untouched.
+                 */
+                boost::optional<boost::filesystem::path> storeInCache(std::string const& cacheKey, boost::filesystem::path const& dynamicLibraryPath) const;
+                
                 /*!
                  * Assembles the information of the model such that it can be put into the source skeleton.
                  */
@@ -104,6 +139,7 @@ namespace storm {
                 void generateLabels(cpptempl::data_map& modelData);
                 void generateTerminalExpressions(cpptempl::data_map& modelData);
                 void generateParameters(cpptempl::data_map& modelData);
+                void generateLoadTimeConstants(cpptempl::data_map& modelData);
                 
                 // Functions related to the generation of edge data.
                 void generateEdges(cpptempl::data_map& modelData);
@@ -195,6 +231,16 @@ namespace storm {
                 /// The include directory of sparsepp.
                 std::string sparseppIncludeDirectory;
                 
+                /// The directory of the compile cache (if any).
+                boost::optional<std::string> cacheDirectory;
+                
+                /// The constants whose values are passed to the shared library when it is loaded and their values.
+                std::vector<storm::expressions::Variable> loadTimeConstants;
+                std::vector<double> loadTimeConstantValues;
+                
+                /// The source code of the shared library (once it has been generated).
+                boost::optional<std::string> sourceCode;
+                
                 /// A cache that is used by carl.
                 std::shared_ptr<carl::Cache<carl::PolynomialFactorizationPair<RawPolynomial>>> cache;
             };
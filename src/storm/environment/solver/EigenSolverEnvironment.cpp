@@ -20,6 +20,7 @@ namespace storm {
             maxIterationCount = std::numeric_limits<uint_fast64_t>::max();
         }
         precision = storm::utility::convertNumber<storm::RationalNumber>(eigenSettings.getPrecision());
+        floatingPointGuided = eigenSettings.isFloatingPointGuidedSet();
     }
 
     EigenSolverEnvironment::~EigenSolverEnvironment() {
@@ -70,4 +71,12 @@ namespace storm {
     void EigenSolverEnvironment::setPrecision(storm::RationalNumber value) {
         precision = value;
     }
+    
+    bool const& EigenSolverEnvironment::isFloatingPointGuidedSet() const {
+        return floatingPointGuided;
+    }
+    
+    void EigenSolverEnvironment::setFloatingPointGuided(bool value) {
+        floatingPointGuided = value;
+    }
 }
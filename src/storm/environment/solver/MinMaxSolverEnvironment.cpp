@@ -22,6 +22,12 @@ namespace storm {
         STORM_LOG_ASSERT(considerRelativeTerminationCriterion || minMaxSettings.getConvergenceCriterion() == storm::settings::modules::MinMaxEquationSolverSettings::ConvergenceCriterion::Absolute, "Unknown convergence criterion");
         multiplicationStyle = minMaxSettings.getValueIterationMultiplicationStyle();
         symmetricUpdates = minMaxSettings.isForceIntervalIterationSymmetricUpdatesSet();
+        if (minMaxSettings.isDdRoundingBitsSet()) {
+            ddRoundingBits = minMaxSettings.getDdRoundingBits();
+        }
+        if (minMaxSettings.isDdRoundingGridSet()) {
+            ddRoundingGrid = storm::utility::convertNumber<storm::RationalNumber>(minMaxSettings.getDdRoundingGrid());
+        }
     }
 
     MinMaxSolverEnvironment::~MinMaxSolverEnvironment() {
@@ -81,4 +87,20 @@ namespace storm {
         symmetricUpdates = value;
     }
     
+    boost::optional<uint64_t> const& MinMaxSolverEnvironment::getDdRoundingBits() const {
+        return ddRoundingBits;
+    }
+    
+    void MinMaxSolverEnvironment::setDdRoundingBits(boost::optional<uint64_t> const& value) {
+        ddRoundingBits = value;
+    }
+    
+    boost::optional<storm::RationalNumber> const& MinMaxSolverEnvironment::getDdRoundingGrid() const {
+        return ddRoundingGrid;
+    }
+    
+    void MinMaxSolverEnvironment::setDdRoundingGrid(boost::optional<storm::RationalNumber> const& value) {
+        ddRoundingGrid = value;
+    }
+    
 }
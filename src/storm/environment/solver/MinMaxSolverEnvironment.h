@@ -29,6 +29,10 @@ namespace storm {
         void setForceBounds(bool value);
         bool isSymmetricUpdatesSet() const;
         void setSymmetricUpdates(bool value);
+        boost::optional<uint64_t> const& getDdRoundingBits() const;
+        void setDdRoundingBits(boost::optional<uint64_t> const& value);
+        boost::optional<storm::RationalNumber> const& getDdRoundingGrid() const;
+        void setDdRoundingGrid(boost::optional<storm::RationalNumber> const& value);
         
     private:
         storm::solver::MinMaxMethod minMaxMethod;
@@ -39,6 +43,8 @@ namespace storm {
         storm::solver::MultiplicationStyle multiplicationStyle;
         bool forceBounds;
         bool symmetricUpdates;
+        boost::optional<uint64_t> ddRoundingBits;
+        boost::optional<storm::RationalNumber> ddRoundingGrid;
     };
 }
 
@@ -23,6 +23,12 @@ namespace storm {
         powerMethodMultiplicationStyle = nativeSettings.getPowerMethodMultiplicationStyle();
         sorOmega = storm::utility::convertNumber<storm::RationalNumber>(nativeSettings.getOmega());
         symmetricUpdates = nativeSettings.isForceIntervalIterationSymmetricUpdatesSet();
+        if (nativeSettings.isDdRoundingBitsSet()) {
+            ddRoundingBits = nativeSettings.getDdRoundingBits();
+        }
+        if (nativeSettings.isDdRoundingGridSet()) {
+            ddRoundingGrid = storm::utility::convertNumber<storm::RationalNumber>(nativeSettings.getDdRoundingGrid());
+        }
 
     }
 
@@ -90,5 +96,21 @@ namespace storm {
     void NativeSolverEnvironment::setSymmetricUpdates(bool value) {
         symmetricUpdates = value;
     }
+    
+    boost::optional<uint64_t> const& NativeSolverEnvironment::getDdRoundingBits() const {
+        return ddRoundingBits;
+    }
+    
+    void NativeSolverEnvironment::setDdRoundingBits(boost::optional<uint64_t> const& value) {
+        ddRoundingBits = value;
+    }
+    
+    boost::optional<storm::RationalNumber> const& NativeSolverEnvironment::getDdRoundingGrid() const {
+        return ddRoundingGrid;
+    }
+    
+    void NativeSolverEnvironment::setDdRoundingGrid(boost::optional<storm::RationalNumber> const& value) {
+        ddRoundingGrid = value;
+    }
   
 }
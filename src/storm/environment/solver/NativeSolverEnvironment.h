@@ -29,6 +29,10 @@ namespace storm {
         void setSorOmega(storm::RationalNumber const& value);
         bool isSymmetricUpdatesSet() const;
         void setSymmetricUpdates(bool value);
+        boost::optional<uint64_t> const& getDdRoundingBits() const;
+        void setDdRoundingBits(boost::optional<uint64_t> const& value);
+        boost::optional<storm::RationalNumber> const& getDdRoundingGrid() const;
+        void setDdRoundingGrid(boost::optional<storm::RationalNumber> const& value);
         
     private:
         storm::solver::NativeLinearEquationSolverMethod method;
@@ -39,6 +43,8 @@ namespace storm {
         storm::solver::MultiplicationStyle powerMethodMultiplicationStyle;
         storm::RationalNumber sorOmega;
         bool symmetricUpdates;
+        boost::optional<uint64_t> ddRoundingBits;
+        boost::optional<storm::RationalNumber> ddRoundingGrid;
     };
 }
 
@@ -15,6 +15,8 @@ namespace storm {
         
         underlyingMinMaxMethod = topologicalSettings.getUnderlyingMinMaxMethod();
         underlyingMinMaxMethodSetFromDefault = topologicalSettings.isUnderlyingMinMaxMethodSetFromDefaultValue();
+        
+        adaptivePrecision = topologicalSettings.isAdaptivePrecisionSet();
     }
 
     TopologicalSolverEnvironment::~TopologicalSolverEnvironment() {
@@ -49,6 +51,14 @@ namespace storm {
         underlyingMinMaxMethod = value;
     }
     
+    bool const& TopologicalSolverEnvironment::isAdaptivePrecisionSet() const {
+        return adaptivePrecision;
+    }
+    
+    void TopologicalSolverEnvironment::setAdaptivePrecision(bool value) {
+        adaptivePrecision = value;
+    }
+    
 
 
 }
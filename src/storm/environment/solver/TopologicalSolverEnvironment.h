@@ -20,12 +20,17 @@ namespace storm {
         bool const& isUnderlyingMinMaxMethodSetFromDefault() const;
         void setUnderlyingMinMaxMethod(storm::solver::MinMaxMethod value);
         
+        bool const& isAdaptivePrecisionSet() const;
+        void setAdaptivePrecision(bool value);
+        
     private:
         storm::solver::EquationSolverType underlyingEquationSolverType;
         bool underlyingEquationSolverTypeSetFromDefault;
         
         storm::solver::MinMaxMethod underlyingMinMaxMethod;
         bool underlyingMinMaxMethodSetFromDefault;
+        
+        bool adaptivePrecision;
     };
 }
 
@@ -178,6 +178,16 @@ namespace storm {
             return nullptr;
         }
 
+        template<typename ValueType, typename StateType>
+        bool NextStateGenerator<ValueType, StateType>::hasSymmetries() const {
+            return false;
+        }
+        
+        template<typename ValueType, typename StateType>
+        void NextStateGenerator<ValueType, StateType>::canonicalize(CompressedState&) const {
+            // Intentionally left empty.
+        }
+
         template<typename ValueType, typename StateType>
         uint32_t NextStateGenerator<ValueType, StateType>::observabilityClass(CompressedState const &state) const {
             if (this->mask.size() == 0) {
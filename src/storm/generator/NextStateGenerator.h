@@ -70,6 +70,17 @@ namespace storm {
             NextStateGeneratorOptions const& getOptions() const;
             
             virtual std::shared_ptr<storm::storage::sparse::ChoiceOrigins> generateChoiceOrigins(std::vector<boost::any>& dataForChoiceOrigins) const;
+            
+            /*!
+             * Retrieves whether the generator found symmetries that are to be exploited. In this case, states need to be
+             * canonicalized before they are looked up.
+             */
+            virtual bool hasSymmetries() const;
+            
+            /*!
+             * Replaces the given state by the canonical representative of its symmetry class.
+             */
+            virtual void canonicalize(CompressedState& state) const;
 
             /*!
              * Performs a remapping of all values stored by applying the given remapping.
@@ -1,5 +1,7 @@
 #include "storm/generator/PrismNextStateGenerator.h"
 
+#include <algorithm>
+
 #include <boost/container/flat_map.hpp>
 #include <boost/any.hpp>
 
@@ -27,7 +29,7 @@ namespace storm {
         }
         
         template<typename ValueType, typename StateType>
-        PrismNextStateGenerator<ValueType, StateType>::PrismNextStateGenerator(storm::prism::Program const& program, NextStateGeneratorOptions const& options, bool) : NextStateGenerator<ValueType, StateType>(program.getManager(), options), program(program), rewardModels(), hasStateActionRewards(false) {
+        PrismNextStateGenerator<ValueType, StateType>::PrismNextStateGenerator(storm::prism::Program const& program, NextStateGeneratorOptions const& options, bool) : NextStateGenerator<ValueType, StateType>(program.getManager(), options), program(program), rewardModels(), hasStateActionRewards(false), numberOfKnownStates(0) {
             STORM_LOG_TRACE("Creating next-state generator for PRISM program: " << program);
             STORM_LOG_THROW(!this->program.specifiesSystemComposition(), storm::exceptions::WrongFormatException, "The explicit next-state generator currently does not support custom system compositions.");
                         
@@ -80,6 +82,25 @@ namespace storm {
                     }
                 }
             }
+            
+            if (this->options.isApplySymmetryReductionSet()) {
+                STORM_LOG_WARN_COND(!this->program.isPartiallyObservable(), "Symmetry reduction is not applied to partially observable models.");
+                if (!this->program.isPartiallyObservable()) {
+                    symmetryReduction = SymmetryReduction(this->program, this->variableInformation, getObservedExpressions());
+                    STORM_LOG_WARN_COND(symmetryReduction.get().hasSymmetries(), "Symmetry reduction was requested, but no symmetric modules were found.");
+                }
+            }
+            
+            if (this->options.isApplyPartialOrderReductionSet()) {
+                STORM_LOG_WARN_COND(this->program.getModelType() == storm::prism::Program::ModelType::MDP, "Partial order reduction is only applied to MDPs.");
+                // Removing invisible steps changes the rewards collected along the paths.
+                bool buildRewards = this->program.getNumberOfRewardModels() > 0 && (this->options.isBuildAllRewardModelsSet() || !this->options.getRewardModelNames().empty());
+                STORM_LOG_WARN_COND(this->options.arePreservedFormulasStutterInvariant(), "Partial order reduction is not applied, because some property counts steps or rewards (e.g. via next formulas, step bounds or reward operators).");
+                STORM_LOG_WARN_COND(!buildRewards || !this->options.arePreservedFormulasStutterInvariant(), "Partial order reduction is not applied, because reward models are built.");
+                if (this->program.getModelType() == storm::prism::Program::ModelType::MDP && this->options.arePreservedFormulasStutterInvariant() && !buildRewards) {
+                    initializePartialOrderReduction();
+                }
+            }
         }
 
         template<typename ValueType, typename StateType>
@@ -112,6 +133,142 @@ namespace storm {
 #endif
         }
         
+        template<typename ValueType, typename StateType>
+        std::vector<storm::expressions::Expression> PrismNextStateGenerator<ValueType, StateType>::getObservedExpressions() const {
+            std::vector<storm::expressions::Expression> observedExpressions;
+            for (auto const& label : this->program.getLabels()) {
+                if (this->options.isBuildAllLabelsSet() || this->options.getLabelNames().count(label.getName()) > 0) {
+                    observedExpressions.push_back(label.getStatePredicateExpression());
+                }
+            }
+            for (auto const& expressionLabel : this->options.getExpressionLabels()) {
+                observedExpressions.push_back(expressionLabel.second);
+            }
+            for (auto const& terminalState : this->terminalStates) {
+                observedExpressions.push_back(terminalState.first);
+            }
+            for (auto const& rewardModel : rewardModels) {
+                for (auto const& stateReward : rewardModel.get().getStateRewards()) {
+                    observedExpressions.push_back(stateReward.getStatePredicateExpression());
+                    observedExpressions.push_back(stateReward.getRewardValueExpression());
+                }
+                for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
+                    observedExpressions.push_back(stateActionReward.getStatePredicateExpression());
+                    observedExpressions.push_back(stateActionReward.getRewardValueExpression());
+                }
+                for (auto const& transitionReward : rewardModel.get().getTransitionRewards()) {
+                    observedExpressions.push_back(transitionReward.getSourceStatePredicateExpression());
+                    observedExpressions.push_back(transitionReward.getTargetStatePredicateExpression());
+                    observedExpressions.push_back(transitionReward.getRewardValueExpression());
+                }
+            }
+            return observedExpressions;
+        }
+        
+        template<typename ValueType, typename StateType>
+        void PrismNextStateGenerator<ValueType, StateType>::initializePartialOrderReduction() {
+            std::set<storm::expressions::Variable> observedVariables;
+            for (auto const& expression : getObservedExpressions()) {
+                std::set<storm::expressions::Variable> variables = expression.getVariables();
+                observedVariables.insert(variables.begin(), variables.end());
+            }
+            
+            // Actions whose choices carry rewards are visible.
+            std::set<uint_fast64_t> rewardedActionIndices;
+            for (auto const& rewardModel : rewardModels) {
+                for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
+                    rewardedActionIndices.insert(stateActionReward.getActionIndex());
+                }
+                for (auto const& transitionReward : rewardModel.get().getTransitionRewards()) {
+                    rewardedActionIndices.insert(transitionReward.getActionIndex());
+                }
+            }
+            
+            std::vector<std::set<storm::expressions::Variable>> readVariables;
+            std::vector<std::set<storm::expressions::Variable>> writtenVariables;
+            for (auto const& module : program.getModules()) {
+                readVariables.push_back(module.getReadVariables());
+                writtenVariables.push_back(module.getWrittenVariables());
+            }
+            auto intersects = [] (std::set<storm::expressions::Variable> const& first, std::set<storm::expressions::Variable> const& second) {
+                return std::any_of(first.begin(), first.end(), [&second] (storm::expressions::Variable const& variable) { return second.count(variable) > 0; });
+            };
+            
+            // A module is independent if its commands are not synchronizing, neither read variables written by other
+            // modules nor write variables accessed by other modules, and are invisible.
+            independentModules = storm::storage::BitVector(program.getNumberOfModules());
+            for (uint_fast64_t moduleIndex = 0; moduleIndex < program.getNumberOfModules(); ++moduleIndex) {
+                storm::prism::Module const& module = program.getModule(moduleIndex);
+                bool isIndependent = !intersects(writtenVariables[moduleIndex], observedVariables);
+                for (uint_fast64_t commandIndex = 0; isIndependent && commandIndex < module.getNumberOfCommands(); ++commandIndex) {
+                    storm::prism::Command const& command = module.getCommand(commandIndex);
+                    isIndependent = !command.isLabeled() && rewardedActionIndices.count(command.getActionIndex()) == 0;
+                }
+                for (uint_fast64_t otherModuleIndex = 0; isIndependent && otherModuleIndex < program.getNumberOfModules(); ++otherModuleIndex) {
+                    if (otherModuleIndex != moduleIndex) {
+                        isIndependent = !intersects(writtenVariables[moduleIndex], readVariables[otherModuleIndex]) && !intersects(writtenVariables[moduleIndex], writtenVariables[otherModuleIndex]) && !intersects(readVariables[moduleIndex], writtenVariables[otherModuleIndex]);
+                    }
+                }
+                independentModules.get().set(moduleIndex, isIndependent);
+            }
+            STORM_LOG_INFO("Partial order reduction may reduce the choices of " << independentModules.get().getNumberOfSetBits() << " of " << program.getNumberOfModules() << " modules.");
+        }
+        
+        template<typename ValueType, typename StateType>
+        boost::optional<Choice<ValueType>> PrismNextStateGenerator<ValueType, StateType>::getAmpleChoice(CompressedState const& state, StateToIdCallback stateToIdCallback) {
+            for (auto const& moduleIndex : independentModules.get()) {
+                storm::prism::Module const& module = program.getModule(moduleIndex);
+                
+                // The ample set consists of the only enabled command of the module, which needs to be deterministic.
+                storm::prism::Command const* enabledCommand = nullptr;
+                bool hasSeveralEnabledCommands = false;
+                for (auto const& command : module.getCommands()) {
+                    if (this->evaluator->asBool(command.getGuardExpression())) {
+                        hasSeveralEnabledCommands = enabledCommand != nullptr;
+                        enabledCommand = &command;
+                        if (hasSeveralEnabledCommands) {
+                            break;
+                        }
+                    }
+                }
+                if (enabledCommand == nullptr || hasSeveralEnabledCommands || enabledCommand->getNumberOfUpdates() != 1) {
+                    continue;
+                }
+                
+                // To make sure that every cycle of the reduced model contains a fully expanded state, we only reduce if
+                // the successor is a new state. Along reduced choices, state ids are then strictly increasing.
+                uint64_t numberOfKnownStatesBefore = numberOfKnownStates;
+                StateType successor = stateToIdCallback(applyUpdate(state, enabledCommand->getUpdate(0)));
+                if (successor < numberOfKnownStatesBefore) {
+                    continue;
+                }
+                
+                Choice<ValueType> choice(enabledCommand->getActionIndex(), enabledCommand->isMarkovian());
+                if (this->options.isBuildChoiceOriginsSet()) {
+                    CommandSet commandIndex { enabledCommand->getGlobalIndex() };
+                    choice.addOriginData(boost::any(std::move(commandIndex)));
+                }
+                choice.addProbability(successor, this->evaluator->asRational(enabledCommand->getUpdate(0).getLikelihoodExpression()));
+                for (uint64_t rewardModelIndex = 0; rewardModelIndex < rewardModels.size(); ++rewardModelIndex) {
+                    choice.addReward(storm::utility::zero<ValueType>());
+                }
+                return choice;
+            }
+            return boost::none;
+        }
+        
+        template<typename ValueType, typename StateType>
+        bool PrismNextStateGenerator<ValueType, StateType>::hasSymmetries() const {
+            return symmetryReduction && symmetryReduction.get().hasSymmetries();
+        }
+        
+        template<typename ValueType, typename StateType>
+        void PrismNextStateGenerator<ValueType, StateType>::canonicalize(CompressedState& state) const {
+            if (symmetryReduction) {
+                symmetryReduction.get().canonicalize(state);
+            }
+        }
+        
         template<typename ValueType, typename StateType>
         ModelType PrismNextStateGenerator<ValueType, StateType>::getModelType() const {
             switch (program.getModelType()) {
@@ -246,6 +403,10 @@ namespace storm {
                 STORM_LOG_DEBUG("Enumerated " << initialStateIndices.size() << " initial states using SMT solving.");
             }
             
+            for (auto const& initialStateIndex : initialStateIndices) {
+                numberOfKnownStates = std::max<uint64_t>(numberOfKnownStates, initialStateIndex + 1);
+            }
+            
             return initialStateIndices;
         }
         
@@ -280,20 +441,37 @@ namespace storm {
             // Get all choices for the state.
             result.setExpanded();
             
+            // If partial order reduction is applied, we keep track of the states that were handed out so far and try to
+            // restrict the state to an ample set.
+            StateToIdCallback idCallback = stateToIdCallback;
+            if (independentModules) {
+                idCallback = [this, &stateToIdCallback] (CompressedState const& state) {
+                    StateType id = stateToIdCallback(state);
+                    numberOfKnownStates = std::max<uint64_t>(numberOfKnownStates, id + 1);
+                    return id;
+                };
+                boost::optional<Choice<ValueType>> ampleChoice = getAmpleChoice(*this->state, idCallback);
+                if (ampleChoice) {
+                    result.addChoice(std::move(ampleChoice.get()));
+                    this->postprocess(result);
+                    return result;
+                }
+            }
+            
             std::vector<Choice<ValueType>> allChoices;
             std::vector<Choice<ValueType>> allLabeledChoices;
             if (this->getOptions().isApplyMaximalProgressAssumptionSet()) {
                 // First explore only edges without a rate
-                allChoices = getUnlabeledChoices(*this->state, stateToIdCallback, CommandFilter::Probabilistic);
-                allLabeledChoices = getLabeledChoices(*this->state, stateToIdCallback, CommandFilter::Probabilistic);
+                allChoices = getUnlabeledChoices(*this->state, idCallback, CommandFilter::Probabilistic);
+                allLabeledChoices = getLabeledChoices(*this->state, idCallback, CommandFilter::Probabilistic);
                 if (allChoices.empty() && allLabeledChoices.empty()) {
                     // Expand the Markovian edges if there are no probabilistic ones.
-                    allChoices = getUnlabeledChoices(*this->state, stateToIdCallback, CommandFilter::Markovian);
-                    allLabeledChoices = getLabeledChoices(*this->state, stateToIdCallback, CommandFilter::Markovian);
+                    allChoices = getUnlabeledChoices(*this->state, idCallback, CommandFilter::Markovian);
+                    allLabeledChoices = getLabeledChoices(*this->state, idCallback, CommandFilter::Markovian);
                 }
             } else {
-                allChoices = getUnlabeledChoices(*this->state, stateToIdCallback);
-                allLabeledChoices = getLabeledChoices(*this->state, stateToIdCallback);
+                allChoices = getUnlabeledChoices(*this->state, idCallback);
+                allLabeledChoices = getLabeledChoices(*this->state, idCallback);
             }
             for (auto& choice : allLabeledChoices) {
                     allChoices.push_back(std::move(choice));
@@ -312,7 +490,7 @@ namespace storm {
                 Choice<ValueType> globalChoice;
 
                 if (this->options.isAddOverlappingGuardLabelSet()) {
-                    this->overlappingGuardStates->push_back(stateToIdCallback(*this->state));
+                    this->overlappingGuardStates->push_back(idCallback(*this->state));
                 }
                 
                 // For CTMCs, we need to keep track of the total exit rate to scale the action rewards later. For DTMCs
@@ -4,6 +4,7 @@
 #include <boost/container/flat_set.hpp>
 
 #include "storm/generator/NextStateGenerator.h"
+#include "storm/generator/SymmetryReduction.h"
 
 #include "storm/storage/prism/Program.h"
 
@@ -41,9 +42,33 @@ namespace storm {
 
             virtual std::shared_ptr<storm::storage::sparse::ChoiceOrigins> generateChoiceOrigins(std::vector<boost::any>& dataForChoiceOrigins) const override;
 
+            virtual bool hasSymmetries() const override;
+            virtual void canonicalize(CompressedState& state) const override;
+
         private:
             void checkValid() const;
 
+            /*!
+             * Retrieves the expressions (of the labels, terminal states and reward models to build) whose values need
+             * to be preserved by reductions of the state space.
+             */
+            std::vector<storm::expressions::Expression> getObservedExpressions() const;
+            
+            /*!
+             * Determines the modules whose commands are independent of all other commands and invisible, such that
+             * they may form ample sets for partial order reduction.
+             */
+            void initializePartialOrderReduction();
+            
+            /*!
+             * Tries to find an ample set for the currently loaded state. An ample set consists of the only enabled
+             * command of an independent module, the command needs to be deterministic and its successor needs to be a
+             * new state. The latter ensures that every cycle of the reduced model contains a fully expanded state.
+             *
+             * @return The choice of the ample set, if there is one.
+             */
+            boost::optional<Choice<ValueType>> getAmpleChoice(CompressedState const& state, StateToIdCallback stateToIdCallback);
+
             /*!
              * A delegate constructor that is used to preprocess the program before the constructor of the superclass is
              * being called. The last argument is only present to distinguish the signature of this constructor from the
@@ -107,6 +132,15 @@ namespace storm {
             
             // A flag that stores whether at least one of the selected reward models has state-action rewards.
             bool hasStateActionRewards;
+            
+            // The symmetries of the modules (if symmetry reduction is applied).
+            boost::optional<SymmetryReduction> symmetryReduction;
+            
+            // The modules whose commands may form ample sets (if partial order reduction is applied).
+            boost::optional<storm::storage::BitVector> independentModules;
+            
+            // The number of states whose ids were handed out so far. This is only tracked for partial order reduction.
+            uint64_t numberOfKnownStates;
         };
         
     }
@@ -0,0 +1,194 @@
+#include "storm/generator/SymmetryReduction.h"
+
+#include <algorithm>
+#include <map>
+#include <set>
+
+#include "storm/generator/VariableInformation.h"
+#include "storm/storage/prism/Program.h"
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace generator {
+        
+        namespace {
+            bool haveEqualInitialValues(storm::prism::Variable const& first, storm::prism::Variable const& second) {
+                if (first.hasInitialValue() != second.hasInitialValue()) {
+                    return false;
+                }
+                return !first.hasInitialValue() || first.getInitialValueExpression().toString() == second.getInitialValueExpression().toString();
+            }
+        }
+        
+        SymmetryReduction::SymmetryReduction(storm::prism::Program const& program, VariableInformation const& variableInformation, std::vector<storm::expressions::Expression> const& observedExpressions) {
+            // Collect the variables whose values need to be preserved.
+            std::set<storm::expressions::Variable> observedVariables;
+            for (auto const& expression : observedExpressions) {
+                std::set<storm::expressions::Variable> variables = expression.getVariables();
+                observedVariables.insert(variables.begin(), variables.end());
+            }
+            if (program.hasInitialConstruct()) {
+                std::set<storm::expressions::Variable> variables = program.getInitialConstruct().getInitialStatesExpression().getVariables();
+                observedVariables.insert(variables.begin(), variables.end());
+            }
+            
+            std::vector<storm::prism::Module> const& modules = program.getModules();
+            std::vector<std::set<storm::expressions::Variable>> readVariables;
+            for (auto const& module : modules) {
+                readVariables.push_back(module.getReadVariables());
+            }
+            
+            std::map<storm::expressions::Variable, std::pair<uint64_t, uint64_t>> variableToBits;
+            for (auto const& booleanVariable : variableInformation.booleanVariables) {
+                variableToBits[booleanVariable.variable] = std::make_pair(booleanVariable.bitOffset, 1);
+            }
+            for (auto const& integerVariable : variableInformation.integerVariables) {
+                variableToBits[integerVariable.variable] = std::make_pair(integerVariable.bitOffset, integerVariable.bitWidth);
+            }
+            
+            std::vector<bool> moduleIsGrouped(modules.size(), false);
+            for (uint64_t moduleIndex = 0; moduleIndex < modules.size(); ++moduleIndex) {
+                if (moduleIsGrouped[moduleIndex]) {
+                    continue;
+                }
+                
+                std::vector<uint64_t> group = {moduleIndex};
+                for (uint64_t otherModuleIndex = moduleIndex + 1; otherModuleIndex < modules.size(); ++otherModuleIndex) {
+                    if (!moduleIsGrouped[otherModuleIndex] && isRenaming(modules[moduleIndex], modules[otherModuleIndex])) {
+                        group.push_back(otherModuleIndex);
+                    }
+                }
+                if (group.size() < 2) {
+                    continue;
+                }
+                
+                // Permuting the modules of the group is only a symmetry if the local variables of each module are not
+                // read anywhere outside the module.
+                std::set<storm::expressions::Variable> groupVariables;
+                for (auto const& member : group) {
+                    std::set<storm::expressions::Variable> localVariables = modules[member].getAllExpressionVariables();
+                    groupVariables.insert(localVariables.begin(), localVariables.end());
+                }
+                bool isSymmetric = std::none_of(observedVariables.begin(), observedVariables.end(), [&groupVariables] (storm::expressions::Variable const& variable) { return groupVariables.count(variable) > 0; });
+                for (uint64_t otherModuleIndex = 0; isSymmetric && otherModuleIndex < modules.size(); ++otherModuleIndex) {
+                    std::set<storm::expressions::Variable> localVariables = modules[otherModuleIndex].getAllExpressionVariables();
+                    for (auto const& variable : readVariables[otherModuleIndex]) {
+                        if (groupVariables.count(variable) > 0 && localVariables.count(variable) == 0) {
+                            isSymmetric = false;
+                            break;
+                        }
+                    }
+                }
+                if (!isSymmetric) {
+                    STORM_LOG_INFO("Module " << modules[moduleIndex].getName() << " has renamed copies, but their variables are read outside of their modules.");
+                    continue;
+                }
+                
+                std::vector<std::vector<std::pair<uint64_t, uint64_t>>> groupBits;
+                for (auto const& member : group) {
+                    moduleIsGrouped[member] = true;
+                    std::vector<std::pair<uint64_t, uint64_t>> moduleBits;
+                    for (auto const& booleanVariable : modules[member].getBooleanVariables()) {
+                        moduleBits.push_back(variableToBits.at(booleanVariable.getExpressionVariable()));
+                    }
+                    for (auto const& integerVariable : modules[member].getIntegerVariables()) {
+                        moduleBits.push_back(variableToBits.at(integerVariable.getExpressionVariable()));
+                    }
+                    groupBits.push_back(std::move(moduleBits));
+                }
+                groups.push_back(std::move(groupBits));
+                STORM_LOG_INFO("Applying symmetry reduction to " << group.size() << " copies of module " << modules[moduleIndex].getName() << ".");
+            }
+        }
+        
+        bool SymmetryReduction::hasSymmetries() const {
+            return !groups.empty();
+        }
+        
+        uint64_t SymmetryReduction::getNumberOfSymmetricGroups() const {
+            return groups.size();
+        }
+        
+        void SymmetryReduction::canonicalize(CompressedState& state) const {
+            std::vector<std::vector<uint64_t>> moduleValuations;
+            for (auto const& group : groups) {
+                moduleValuations.resize(group.size());
+                for (uint64_t member = 0; member < group.size(); ++member) {
+                    moduleValuations[member].clear();
+                    for (auto const& bits : group[member]) {
+                        moduleValuations[member].push_back(state.getAsInt(bits.first, bits.second));
+                    }
+                }
+                
+                if (std::is_sorted(moduleValuations.begin(), moduleValuations.end())) {
+                    continue;
+                }
+                std::sort(moduleValuations.begin(), moduleValuations.end());
+                
+                for (uint64_t member = 0; member < group.size(); ++member) {
+                    for (uint64_t variable = 0; variable < group[member].size(); ++variable) {
+                        state.setFromInt(group[member][variable].first, group[member][variable].second, moduleValuations[member][variable]);
+                    }
+                }
+            }
+        }
+        
+        bool SymmetryReduction::isRenaming(storm::prism::Module const& first, storm::prism::Module const& second) {
+            if (first.getNumberOfBooleanVariables() != second.getNumberOfBooleanVariables() || first.getNumberOfIntegerVariables() != second.getNumberOfIntegerVariables() || first.getNumberOfClockVariables() > 0 || second.getNumberOfClockVariables() > 0 || first.getNumberOfCommands() != second.getNumberOfCommands()) {
+                return false;
+            }
+            
+            // Map the variables of the first module to the corresponding ones of the second module.
+            std::map<storm::expressions::Variable, storm::expressions::Variable> variableRenaming;
+            std::map<storm::expressions::Variable, storm::expressions::Expression> renaming;
+            for (uint64_t index = 0; index < first.getNumberOfBooleanVariables(); ++index) {
+                storm::prism::BooleanVariable const& firstVariable = first.getBooleanVariables()[index];
+                storm::prism::BooleanVariable const& secondVariable = second.getBooleanVariables()[index];
+                if (!haveEqualInitialValues(firstVariable, secondVariable)) {
+                    return false;
+                }
+                variableRenaming.emplace(firstVariable.getExpressionVariable(), secondVariable.getExpressionVariable());
+                renaming[firstVariable.getExpressionVariable()] = secondVariable.getExpressionVariable().getExpression();
+            }
+            for (uint64_t index = 0; index < first.getNumberOfIntegerVariables(); ++index) {
+                storm::prism::IntegerVariable const& firstVariable = first.getIntegerVariables()[index];
+                storm::prism::IntegerVariable const& secondVariable = second.getIntegerVariables()[index];
+                if (!haveEqualInitialValues(firstVariable, secondVariable) || firstVariable.getLowerBoundExpression().toString() != secondVariable.getLowerBoundExpression().toString() || firstVariable.getUpperBoundExpression().toString() != secondVariable.getUpperBoundExpression().toString()) {
+                    return false;
+                }
+                variableRenaming.emplace(firstVariable.getExpressionVariable(), secondVariable.getExpressionVariable());
+                renaming[firstVariable.getExpressionVariable()] = secondVariable.getExpressionVariable().getExpression();
+            }
+            
+            // Now check whether renaming the commands of the first module yields the commands of the second one. We
+            // substitute in the commands of the second module as well, so both are simplified in the same way.
+            std::map<storm::expressions::Variable, storm::expressions::Expression> identity;
+            for (uint64_t commandIndex = 0; commandIndex < first.getNumberOfCommands(); ++commandIndex) {
+                storm::prism::Command firstCommand = first.getCommands()[commandIndex].substitute(renaming);
+                storm::prism::Command secondCommand = second.getCommands()[commandIndex].substitute(identity);
+                if (firstCommand.isMarkovian() != secondCommand.isMarkovian() || firstCommand.getActionName() != secondCommand.getActionName() || firstCommand.getGuardExpression().toString() != secondCommand.getGuardExpression().toString() || firstCommand.getNumberOfUpdates() != secondCommand.getNumberOfUpdates()) {
+                    return false;
+                }
+                for (uint64_t updateIndex = 0; updateIndex < firstCommand.getNumberOfUpdates(); ++updateIndex) {
+                    storm::prism::Update const& firstUpdate = firstCommand.getUpdate(updateIndex);
+                    storm::prism::Update const& secondUpdate = secondCommand.getUpdate(updateIndex);
+                    if (firstUpdate.getLikelihoodExpression().toString() != secondUpdate.getLikelihoodExpression().toString() || firstUpdate.getNumberOfAssignments() != secondUpdate.getNumberOfAssignments()) {
+                        return false;
+                    }
+                    for (uint64_t assignmentIndex = 0; assignmentIndex < firstUpdate.getNumberOfAssignments(); ++assignmentIndex) {
+                        storm::prism::Assignment const& firstAssignment = firstUpdate.getAssignments()[assignmentIndex];
+                        storm::prism::Assignment const& secondAssignment = secondUpdate.getAssignments()[assignmentIndex];
+                        auto renamingIt = variableRenaming.find(firstAssignment.getVariable());
+                        storm::expressions::Variable const& renamedVariable = renamingIt == variableRenaming.end() ? firstAssignment.getVariable() : renamingIt->second;
+                        if (renamedVariable != secondAssignment.getVariable() || firstAssignment.getExpression().toString() != secondAssignment.getExpression().toString()) {
+                            return false;
+                        }
+                    }
+                }
+            }
+            return true;
+        }
+        
+    }
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "storm/generator/CompressedState.h"
+#include "storm/storage/expressions/Expression.h"
+
+namespace storm {
+    namespace prism {
+        class Program;
+        class Module;
+    }
+    
+    namespace generator {
+        struct VariableInformation;
+        
+        /*!
+         * Detects groups of fully symmetric modules of a PRISM program and maps states to canonical representatives
+         * of their orbits under permuting the modules of a group. A group consists of modules that are obtained from
+         * each other by renaming their local variables (as done by PRISM module renaming) and whose local variables
+         * are only read within the module itself. A state is canonical if, for each group, the valuations of the local
+         * variables of the modules are sorted. Exploring only canonical states yields the quotient model, which is
+         * bisimilar to the full model with respect to the given (observed) expressions.
+         */
+        class SymmetryReduction {
+        public:
+            /*!
+             * Detects the symmetric modules of the given program. The program is expected to have all constants and
+             * formulas substituted.
+             *
+             * @param program The program.
+             * @param variableInformation The information how the variables are packed in the states.
+             * @param observedExpressions Expressions (of labels, rewards, etc.) that need to be preserved. Modules whose
+             * variables occur in these expressions are not considered symmetric.
+             */
+            SymmetryReduction(storm::prism::Program const& program, VariableInformation const& variableInformation, std::vector<storm::expressions::Expression> const& observedExpressions);
+            
+            /*!
+             * Retrieves whether at least one group of symmetric modules was found.
+             */
+            bool hasSymmetries() const;
+            
+            /*!
+             * Retrieves the number of groups of symmetric modules.
+             */
+            uint64_t getNumberOfSymmetricGroups() const;
+            
+            /*!
+             * Replaces the given state by the canonical representative of its orbit.
+             */
+            void canonicalize(CompressedState& state) const;
+            
+        private:
+            /*!
+             * Retrieves whether the second module is obtained from the first one by renaming the local variables.
+             */
+            static bool isRenaming(storm::prism::Module const& first, storm::prism::Module const& second);
+            
+            // For each group of symmetric modules, for each module of the group, the bit offsets and widths of the local
+            // variables. The variables of all modules in a group are listed in corresponding order.
+            std::vector<std::vector<std::vector<std::pair<uint64_t, uint64_t>>>> groups;
+        };
+        
+    }
+}
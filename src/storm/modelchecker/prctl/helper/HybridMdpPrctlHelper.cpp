@@ -63,7 +63,7 @@ namespace storm {
                     
                     for (uint64_t state = 0; state < numberOfMaybeStates; ++state) {
                         if (!targetStates.get(state)) {
-                            result[state] = validScheduler.getChoice(state).getDeterministicChoice();
+                            result[state] = validScheduler.getDeterministicChoice(state);
                         }
                     }
                 }
@@ -419,7 +419,7 @@ namespace storm {
                 
                 for (uint64_t state = 0; state < numberOfMaybeStates; ++state) {
                     if (!targetStates.get(state)) {
-                        result[state] = validScheduler.getChoice(state).getDeterministicChoice();
+                        result[state] = validScheduler.getDeterministicChoice(state);
                     }
                 }
                 
@@ -197,7 +197,7 @@ namespace storm {
                 std::vector<uint_fast64_t> schedulerHint(maybeStates.getNumberOfSetBits());
                 auto maybeIt = maybeStates.begin();
                 for (auto& choice : schedulerHint) {
-                    choice = validScheduler.getChoice(*maybeIt).getDeterministicChoice();
+                    choice = validScheduler.getDeterministicChoice(*maybeIt);
                     ++maybeIt;
                 }
                 return schedulerHint;
@@ -291,7 +291,7 @@ namespace storm {
                         if (!skipECWithinMaybeStatesCheck) {
                             hintChoices.reserve(maybeStates.size());
                             for (uint_fast64_t state = 0; state < maybeStates.size(); ++state) {
-                                hintChoices.push_back(schedulerHint.getChoice(state).getDeterministicChoice());
+                                hintChoices.push_back(schedulerHint.getDeterministicChoice(state));
                             }
                             hintApplicable = storm::utility::graph::performProb1(transitionMatrix.transposeSelectedRowsFromRowGroups(hintChoices), maybeStates, ~maybeStates).full();
                         } else {
@@ -303,7 +303,7 @@ namespace storm {
                             hintChoices.clear();
                             hintChoices.reserve(maybeStates.getNumberOfSetBits());
                             for (auto const& state : maybeStates) {
-                                uint_fast64_t hintChoice = schedulerHint.getChoice(state).getDeterministicChoice();
+                                uint_fast64_t hintChoice = schedulerHint.getDeterministicChoice(state);
                                 if (selectedChoices) {
                                     uint_fast64_t firstChoice = transitionMatrix.getRowGroupIndices()[state];
                                     uint_fast64_t lastChoice = firstChoice + hintChoice;
@@ -689,7 +689,7 @@ namespace storm {
             STORM_LOG_INFO("Eliminating " << numberOfStatesToEliminate << " states using the state elimination technique." << std::endl);
             performPrioritizedStateElimination(statePriorities, flexibleMatrix, flexibleBackwardTransitions, oneStepProbabilities, this->getModel().getInitialStates(), true);
             
-            storm::solver::stateelimination::ConditionalStateEliminator<ValueType> stateEliminator = storm::solver::stateelimination::ConditionalStateEliminator<ValueType>(flexibleMatrix, flexibleBackwardTransitions, oneStepProbabilities, phiStates, psiStates);
+            storm::solver::stateelimination::ConditionalStateEliminator<ValueType> stateEliminator(flexibleMatrix, flexibleBackwardTransitions, oneStepProbabilities, phiStates, psiStates);
             
             // Eliminate the transitions going into the initial state (if there are any).
             if (!flexibleBackwardTransitions.getRow(*newInitialStates.begin()).empty()) {
@@ -812,6 +812,12 @@ namespace storm {
             
             storm::solver::stateelimination::PrioritizedStateEliminator<ValueType> stateEliminator(transitionMatrix, backwardTransitions, priorityQueue, values);
             
+            uint_fast64_t numberOfThreads = storm::solver::stateelimination::PrioritizedStateEliminator<ValueType>::getNumberOfEliminationThreads(storm::settings::getModule<storm::settings::modules::EliminationSettings>().getNumberOfThreads());
+            if (numberOfThreads > 1 && transitionMatrix.hasTrivialRowGrouping()) {
+                stateEliminator.eliminateAllInParallel(numberOfThreads, [&initialStates, computeResultsForInitialStatesOnly] (storm::storage::sparse::state_type const& state) { return computeResultsForInitialStatesOnly && !initialStates.get(state); });
+                return;
+            }
+            
             while (priorityQueue->hasNext()) {
                 storm::storage::sparse::state_type state = priorityQueue->pop();
                 bool removeForwardTransitions = computeResultsForInitialStatesOnly && !initialStates.get(state);
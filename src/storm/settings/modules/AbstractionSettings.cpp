@@ -34,6 +34,7 @@ namespace storm {
             const std::string AbstractionSettings::fixPlayer1StrategyOptionName = "fixpl1strat";
             const std::string AbstractionSettings::fixPlayer2StrategyOptionName = "fixpl2strat";
             const std::string AbstractionSettings::validBlockModeOptionName = "validmode";
+            const std::string AbstractionSettings::numberOfThreadsOptionName = "threads";
             
             AbstractionSettings::AbstractionSettings() : ModuleSettings(moduleName) {
                 std::vector<std::string> methods = {"games", "bisimulation", "bisim"};
@@ -139,6 +140,10 @@ namespace storm {
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("mode", "The mode to use.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(validModes))
                                              .setDefaultValueString("morepreds").build())
                                 .build());
+                
+                this->addOption(storm::settings::OptionBuilder(moduleName, numberOfThreadsOptionName, true, "Sets the number of threads used to recompute the abstractions of commands (edges) concurrently.")
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads.").setDefaultValueUnsignedInteger(1).addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build())
+                                .build());
 
             }
             
@@ -284,6 +289,14 @@ namespace storm {
                 return ValidBlockMode::MorePredicates;
             }
             
+            uint_fast64_t AbstractionSettings::getNumberOfThreads() const {
+                return this->getOption(numberOfThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+            
+            void AbstractionSettings::setNumberOfThreads(uint_fast64_t value) {
+                this->getOption(numberOfThreadsOptionName).getArgumentByName("count").setFromStringValue(std::to_string(value));
+            }
+            
         }
     }
 }
@@ -195,6 +195,16 @@ namespace storm {
                  */
                 ValidBlockMode getValidBlockMode() const;
                 
+                /*!
+                 * Retrieves the number of threads used to recompute the abstractions of commands (edges).
+                 */
+                uint_fast64_t getNumberOfThreads() const;
+                
+                /*!
+                 * Sets the number of threads used to recompute the abstractions of commands (edges).
+                 */
+                void setNumberOfThreads(uint_fast64_t value);
+                
                 const static std::string moduleName;
                 
             private:
@@ -219,6 +229,7 @@ namespace storm {
                 const static std::string fixPlayer1StrategyOptionName;
                 const static std::string fixPlayer2StrategyOptionName;
                 const static std::string validBlockModeOptionName;
+                const static std::string numberOfThreadsOptionName;
             };
             
         }
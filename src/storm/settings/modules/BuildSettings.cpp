@@ -31,6 +31,12 @@ namespace storm {
             const std::string buildStateValuationsOptionName = "buildstateval";
             const std::string buildOutOfBoundsStateOptionName = "buildoutofboundsstate";
             const std::string bitsForUnboundedVariablesOptionName = "int-bits";
+            const std::string symmetryReductionOptionName = "symmetry";
+            const std::string partialOrderReductionOptionName = "por";
+            const std::string symbolicReachabilityOptionName = "ddreach";
+            const std::string ddVariableOrderingOptionName = "ddorder";
+            const std::string importDdVariableOrderOptionName = "ddorder-import";
+            const std::string exportDdVariableOrderOptionName = "ddorder-export";
             BuildSettings::BuildSettings() : ModuleSettings(moduleName) {
 
                 std::vector<std::string> explorationOrders = {"dfs", "bfs"};
@@ -45,6 +51,18 @@ namespace storm {
                                         .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the exploration order to choose.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(explorationOrders)).setDefaultValueString("bfs").build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, explorationChecksOptionName, false, "If set, additional checks (if available) are performed during model exploration to debug the model.").setShortName(explorationChecksOptionShortName).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, buildOutOfBoundsStateOptionName, false, "If set, a state for out-of-bounds valuations is added").build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, symmetryReductionOptionName, false, "If set, the explicit builder only explores one representative for states that differ by permuting fully symmetric (renamed) PRISM modules.").build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, partialOrderReductionOptionName, false, "If set, the explicit builder reduces the choices of MDP states to ample sets of independent and invisible PRISM commands.").build());
+                std::vector<std::string> symbolicReachabilityStrategies = {"bfs", "chaining", "saturation"};
+                this->addOption(storm::settings::OptionBuilder(moduleName, symbolicReachabilityOptionName, false, "Sets how the symbolic builders compute the reachable states. Chaining and saturation apply the transitions of each module/automaton separately.")
+                                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the strategy to choose.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(symbolicReachabilityStrategies)).setDefaultValueString("bfs").build()).build());
+                std::vector<std::string> ddVariableOrderingHeuristics = {"declaration", "force"};
+                this->addOption(storm::settings::OptionBuilder(moduleName, ddVariableOrderingOptionName, false, "Sets how the symbolic builders order the state variables.")
+                                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the heuristic to choose.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(ddVariableOrderingHeuristics)).setDefaultValueString("declaration").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, importDdVariableOrderOptionName, false, "If given, the symbolic builders order the state variables as given in the specified file (one variable name per line). Variables that are not listed are placed after the listed ones.")
+                                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The name of the file from which to read the order.").addValidatorString(ArgumentValidatorFactory::createExistingFileValidator()).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, exportDdVariableOrderOptionName, false, "If given, the symbolic builders write the order of the state variables to the specified file.")
+                                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The name of the file to which to write the order.").build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, bitsForUnboundedVariablesOptionName, false, "Sets the number of bits that is used for unbounded integer variables.")
                                         .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("number", "The number of bits.").addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedRangeValidatorExcluding(0,63)).setDefaultValueUnsignedInteger(32).build()).build());
             }
@@ -81,6 +99,14 @@ namespace storm {
                 return this->getOption(buildOutOfBoundsStateOptionName).getHasOptionBeenSet();
             }
 
+            bool BuildSettings::isSymmetryReductionSet() const {
+                return this->getOption(symmetryReductionOptionName).getHasOptionBeenSet();
+            }
+
+            bool BuildSettings::isPartialOrderReductionSet() const {
+                return this->getOption(partialOrderReductionOptionName).getHasOptionBeenSet();
+            }
+
             storm::builder::ExplorationOrder BuildSettings::getExplorationOrder() const {
                 std::string explorationOrderAsString = this->getOption(explorationOrderOptionName).getArgumentByName("name").getValueAsString();
                 if (explorationOrderAsString == "dfs") {
@@ -91,6 +117,44 @@ namespace storm {
                 STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown exploration order '" << explorationOrderAsString << "'.");
             }
             
+            storm::builder::SymbolicReachabilityStrategy BuildSettings::getSymbolicReachabilityStrategy() const {
+                std::string strategyAsString = this->getOption(symbolicReachabilityOptionName).getArgumentByName("name").getValueAsString();
+                if (strategyAsString == "bfs") {
+                    return storm::builder::SymbolicReachabilityStrategy::Bfs;
+                } else if (strategyAsString == "chaining") {
+                    return storm::builder::SymbolicReachabilityStrategy::Chaining;
+                } else if (strategyAsString == "saturation") {
+                    return storm::builder::SymbolicReachabilityStrategy::Saturation;
+                }
+                STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown symbolic reachability strategy '" << strategyAsString << "'.");
+            }
+            
+            storm::builder::DdVariableOrderingHeuristic BuildSettings::getDdVariableOrderingHeuristic() const {
+                std::string heuristicAsString = this->getOption(ddVariableOrderingOptionName).getArgumentByName("name").getValueAsString();
+                if (heuristicAsString == "declaration") {
+                    return storm::builder::DdVariableOrderingHeuristic::Declaration;
+                } else if (heuristicAsString == "force") {
+                    return storm::builder::DdVariableOrderingHeuristic::Force;
+                }
+                STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown variable ordering heuristic '" << heuristicAsString << "'.");
+            }
+            
+            bool BuildSettings::isImportDdVariableOrderSet() const {
+                return this->getOption(importDdVariableOrderOptionName).getHasOptionBeenSet();
+            }
+            
+            std::string BuildSettings::getImportDdVariableOrderFilename() const {
+                return this->getOption(importDdVariableOrderOptionName).getArgumentByName("filename").getValueAsString();
+            }
+            
+            bool BuildSettings::isExportDdVariableOrderSet() const {
+                return this->getOption(exportDdVariableOrderOptionName).getHasOptionBeenSet();
+            }
+            
+            std::string BuildSettings::getExportDdVariableOrderFilename() const {
+                return this->getOption(exportDdVariableOrderOptionName).getArgumentByName("filename").getValueAsString();
+            }
+            
             bool BuildSettings::isExplorationChecksSet() const {
                 return this->getOption(explorationChecksOptionName).getHasOptionBeenSet();
             }
@@ -4,6 +4,8 @@
 #include "storm-config.h"
 #include "storm/settings/modules/ModuleSettings.h"
 #include "storm/builder/ExplorationOrder.h"
+#include "storm/builder/SymbolicReachabilityStrategy.h"
+#include "storm/builder/DdVariableOrderingHeuristic.h"
 
 namespace storm {
     namespace settings {
@@ -80,6 +82,60 @@ namespace storm {
                  * @return
                  */
                 bool isBuildOutOfBoundsStateSet() const;
+
+                /*!
+                 * Retrieves whether states that only differ by permuting symmetric modules are to be merged.
+                 * @return
+                 */
+                bool isSymmetryReductionSet() const;
+
+                /*!
+                 * Retrieves whether partial order reduction is to be applied when building MDPs.
+                 * @return
+                 */
+                bool isPartialOrderReductionSet() const;
+                
+                /*!
+                 * Retrieves the strategy that the symbolic builders use to compute the reachable states.
+                 *
+                 * @return The chosen strategy.
+                 */
+                storm::builder::SymbolicReachabilityStrategy getSymbolicReachabilityStrategy() const;
+                
+                /*!
+                 * Retrieves the heuristic that the symbolic builders use to order the state variables.
+                 *
+                 * @return The chosen heuristic.
+                 */
+                storm::builder::DdVariableOrderingHeuristic getDdVariableOrderingHeuristic() const;
+                
+                /*!
+                 * Retrieves whether the order of the state variables is to be read from a file.
+                 *
+                 * @return True iff the option was set.
+                 */
+                bool isImportDdVariableOrderSet() const;
+                
+                /*!
+                 * Retrieves the name of the file from which the order of the state variables is to be read.
+                 *
+                 * @return The name of the file.
+                 */
+                std::string getImportDdVariableOrderFilename() const;
+                
+                /*!
+                 * Retrieves whether the order of the state variables is to be written to a file.
+                 *
+                 * @return True iff the option was set.
+                 */
+                bool isExportDdVariableOrderSet() const;
+                
+                /*!
+                 * Retrieves the name of the file to which the order of the state variables is to be written.
+                 *
+                 * @return The name of the file.
+                 */
+                std::string getExportDdVariableOrderFilename() const;
                 
                 /*!
                  * Retrieves the number of bits that should be used to represent unbounded integer variables
@@ -99,6 +99,14 @@ namespace storm {
                  * @return The precision to use for detecting convergence.
                  */
                 double getPrecision() const;
+                
+                /*!
+                 * Retrieves whether exact systems are to be solved by reconstructing the exact solution from a
+                 * floating point solution first.
+                 *
+                 * @return True iff the floating point guided solving has been requested.
+                 */
+                bool isFloatingPointGuidedSet() const;
                                 
                 bool check() const override;
                 
@@ -113,6 +121,7 @@ namespace storm {
                 static const std::string maximalIterationsOptionShortName;
                 static const std::string precisionOptionName;
                 static const std::string restartOptionName;
+                static const std::string floatingPointGuidedOptionName;
             };
             
             std::ostream& operator<<(std::ostream& out, EigenEquationSolverSettings::LinearEquationMethod const& method);
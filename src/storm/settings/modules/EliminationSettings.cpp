@@ -18,6 +18,8 @@ namespace storm {
             const std::string EliminationSettings::entryStatesLastOptionName = "entrylast";
             const std::string EliminationSettings::maximalSccSizeOptionName = "sccsize";
             const std::string EliminationSettings::useDedicatedModelCheckerOptionName = "use-dedicated-mc";
+            const std::string EliminationSettings::numberOfThreadsOptionName = "threads";
+            const std::string EliminationSettings::arithmeticCacheSizeOptionName = "cachesize";
             
             EliminationSettings::EliminationSettings() : ModuleSettings(moduleName) {
                 std::vector<std::string> orders = {"fw", "fwrev", "bw", "bwrev", "rand", "spen", "dpen", "regex"};
@@ -30,6 +32,10 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, maximalSccSizeOptionName, true, "Sets the maximal size of the SCCs for which state elimination is applied.")
                                 .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("maxsize", "The maximal size of an SCC on which state elimination is applied.").setDefaultValueUnsignedInteger(20).setIsOptional(true).build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, useDedicatedModelCheckerOptionName, true, "Sets whether to use the dedicated model elimination checker (only DTMCs).").build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, numberOfThreadsOptionName, true, "Sets the number of threads used to eliminate states with disjoint neighbourhoods concurrently. Only models with floating point values are eliminated concurrently.")
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads.").setDefaultValueUnsignedInteger(1).addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, arithmeticCacheSizeOptionName, true, "Sets the maximal number of entries of each table of the cache that memoizes the products and sums computed during elimination (0 disables the cache).")
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("size", "The maximal number of entries.").setDefaultValueUnsignedInteger(100000).build()).build());
             }
             
             EliminationSettings::EliminationMethod EliminationSettings::getEliminationMethod() const {
@@ -77,6 +83,14 @@ namespace storm {
             bool EliminationSettings::isUseDedicatedModelCheckerSet() const {
                 return this->getOption(useDedicatedModelCheckerOptionName).getHasOptionBeenSet();
             }
+            
+            uint_fast64_t EliminationSettings::getNumberOfThreads() const {
+                return this->getOption(numberOfThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+            
+            uint_fast64_t EliminationSettings::getArithmeticCacheSize() const {
+                return this->getOption(arithmeticCacheSizeOptionName).getArgumentByName("size").getValueAsUnsignedInteger();
+            }
         } // namespace modules
     } // namespace settings
 } // namespace storm
@@ -61,6 +61,21 @@ namespace storm {
                  * @return True iff the option was set.
                  */
                 bool isUseDedicatedModelCheckerSet() const;
+                
+                /*!
+                 * Retrieves the number of threads used to eliminate independent states concurrently.
+                 *
+                 * @return The number of threads.
+                 */
+                uint_fast64_t getNumberOfThreads() const;
+                
+                /*!
+                 * Retrieves the maximal number of entries of each table of the cache for the arithmetic operations
+                 * performed during state elimination.
+                 *
+                 * @return The maximal size of the cache tables.
+                 */
+                uint_fast64_t getArithmeticCacheSize() const;
 				
                 const static std::string moduleName;
                 
@@ -70,6 +85,8 @@ namespace storm {
                 const static std::string entryStatesLastOptionName;
                 const static std::string maximalSccSizeOptionName;
                 const static std::string useDedicatedModelCheckerOptionName;
+                const static std::string numberOfThreadsOptionName;
+                const static std::string arithmeticCacheSizeOptionName;
             };
             
         } // namespace modules
@@ -37,6 +37,8 @@ namespace storm {
             const std::string IOSettings::choiceLabelingOptionName = "choicelab";
             const std::string IOSettings::constantsOptionName = "constants";
             const std::string IOSettings::constantsOptionShortName = "const";
+            const std::string IOSettings::constantsSweepOptionName = "constants-sweep";
+            const std::string IOSettings::constantsSweepOptionShortName = "sweep";
 
             const std::string IOSettings::janiPropertyOptionName = "janiproperty";
             const std::string IOSettings::janiPropertyOptionShortName = "jprop";
@@ -83,6 +85,8 @@ namespace storm {
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The file from which to read the choice labels.").addValidatorString(ArgumentValidatorFactory::createExistingFileValidator()).build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, constantsOptionName, false, "Specifies the constant replacements to use in symbolic models. Note that this requires the model to be given as an symbolic model (i.e., via --" + prismInputOptionName + " or --" + janiInputOptionName + ").").setShortName(constantsOptionShortName)
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("values", "A comma separated list of constants and their value, e.g. a=1,b=2,c=3.").setDefaultValueString("").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, constantsSweepOptionName, false, "Checks the properties for several values of constants of a symbolic model. If the swept constants do not affect the structure of the model, the model is built once and only its values are updated. Constants not swept need to be defined via --" + constantsOptionName + ".").setShortName(constantsSweepOptionShortName)
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("values", "A semicolon separated list of constant definitions, e.g. p=0.1,q=0.5;p=0.2,q=0.5.").build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, janiPropertyOptionName, false, "Specifies the properties from the jani model (given by --" + janiInputOptionName + ")  to be checked.").setShortName(janiPropertyOptionShortName)
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("values", "A comma separated list of properties to be checked").setDefaultValueString("").build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, toNondetOptionName, false, "If set, DTMCs/CTMCs are converted to MDPs/MAs (without actual nondeterminism) before model checking.").build());
@@ -221,6 +225,14 @@ namespace storm {
                 return this->getOption(constantsOptionName).getArgumentByName("values").getValueAsString();
             }
 
+            bool IOSettings::isConstantsSweepSet() const {
+                return this->getOption(constantsSweepOptionName).getHasOptionBeenSet();
+            }
+
+            std::string IOSettings::getConstantsSweepString() const {
+                return this->getOption(constantsSweepOptionName).getArgumentByName("values").getValueAsString();
+            }
+
             bool IOSettings::isJaniPropertiesSet() const {
                 return this->getOption(janiPropertyOptionName).getHasOptionBeenSet();
             }
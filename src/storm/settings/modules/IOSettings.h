@@ -229,6 +229,21 @@ namespace storm {
                  */
                 std::string getConstantDefinitionString() const;
 
+                /*!
+                 * Retrieves whether the constants sweep option was set.
+                 *
+                 * @return True if the constants sweep option was set.
+                 */
+                bool isConstantsSweepSet() const;
+
+                /*!
+                 * Retrieves the string that defines the values of the swept constants. The definitions of the
+                 * individual sweep points are separated by semicolons.
+                 *
+                 * @return The string that defines the values of the swept constants.
+                 */
+                std::string getConstantsSweepString() const;
+
                 /*!
                  * Retrieves whether the jani-property option was set
                  * @return
@@ -324,6 +339,8 @@ namespace storm {
                 static const std::string choiceLabelingOptionName;
                 static const std::string constantsOptionName;
                 static const std::string constantsOptionShortName;
+                static const std::string constantsSweepOptionName;
+                static const std::string constantsSweepOptionShortName;
                 static const std::string janiPropertyOptionName;
                 static const std::string janiPropertyOptionShortName;
                 static const std::string propertyOptionName;
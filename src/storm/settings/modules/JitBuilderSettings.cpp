@@ -21,6 +21,8 @@ namespace storm {
             const std::string JitBuilderSettings::carlIncludeDirectoryOptionName = "carl";
             const std::string JitBuilderSettings::compilerFlagsOptionName = "cxxflags";
             const std::string JitBuilderSettings::optimizationLevelOptionName = "opt";
+            const std::string JitBuilderSettings::cacheDirectoryOptionName = "cache";
+            const std::string JitBuilderSettings::loadTimeConstantsOptionName = "loadtimeconstants";
 
             JitBuilderSettings::JitBuilderSettings() : ModuleSettings(moduleName) {
                 this->addOption(storm::settings::OptionBuilder(moduleName, doctorOptionName, false, "Show debugging information on why the jit-based model builder is not working on your system.").build());
@@ -36,6 +38,9 @@ namespace storm {
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("flags", "The compiler flags.").build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, optimizationLevelOptionName, false, "Sets the optimization level.")
                                 .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("level", "The level to use.").setDefaultValueUnsignedInteger(3).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, cacheDirectoryOptionName, false, "If set, compiled model builders are stored in (and reused from) the given directory.")
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("dir", "The directory of the compile cache.").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, loadTimeConstantsOptionName, false, "If set, the values of real-valued constants are passed to the compiled builder when it is loaded instead of being compiled into it. This allows to reuse a cached builder across different constant definitions.").build());
             }
             
             bool JitBuilderSettings::isCompilerSet() const {
@@ -86,6 +91,18 @@ namespace storm {
                 return this->getOption(optimizationLevelOptionName).getArgumentByName("level").getValueAsUnsignedInteger();
             }
             
+            bool JitBuilderSettings::isCacheDirectorySet() const {
+                return this->getOption(cacheDirectoryOptionName).getHasOptionBeenSet();
+            }
+            
+            std::string JitBuilderSettings::getCacheDirectory() const {
+                return this->getOption(cacheDirectoryOptionName).getArgumentByName("dir").getValueAsString();
+            }
+            
+            bool JitBuilderSettings::isLoadTimeConstantsSet() const {
+                return this->getOption(loadTimeConstantsOptionName).getHasOptionBeenSet();
+            }
+            
             void JitBuilderSettings::finalize() {
                 // Intentionally left empty.
             }
@@ -32,6 +32,11 @@ namespace storm {
                 
                 uint64_t getOptimizationLevel() const;
                 
+                bool isCacheDirectorySet() const;
+                std::string getCacheDirectory() const;
+                
+                bool isLoadTimeConstantsSet() const;
+                
                 bool check() const override;
                 void finalize() override;
                 
@@ -45,6 +50,8 @@ namespace storm {
                 static const std::string compilerFlagsOptionName;
                 static const std::string doctorOptionName;
                 static const std::string optimizationLevelOptionName;
+                static const std::string cacheDirectoryOptionName;
+                static const std::string loadTimeConstantsOptionName;
             };
             
         }
@@ -21,6 +21,8 @@ namespace storm {
             const std::string MinMaxEquationSolverSettings::markovAutomatonBoundedReachabilityMethodOptionName = "mamethod";
             const std::string MinMaxEquationSolverSettings::valueIterationMultiplicationStyleOptionName = "vimult";
             const std::string MinMaxEquationSolverSettings::intervalIterationSymmetricUpdatesOptionName = "symmetricupdates";
+            const std::string MinMaxEquationSolverSettings::ddRoundingBitsOptionName = "ddround-bits";
+            const std::string MinMaxEquationSolverSettings::ddRoundingGridOptionName = "ddround-grid";
 
             MinMaxEquationSolverSettings::MinMaxEquationSolverSettings() : ModuleSettings(moduleName) {
                 std::vector<std::string> minMaxSolvingTechniques = {"vi", "value-iteration", "pi", "policy-iteration", "lp", "linear-programming", "rs", "ratsearch", "ii", "interval-iteration", "svi", "sound-value-iteration", "topological", "vi-to-pi"};
@@ -46,6 +48,10 @@ namespace storm {
                 
                 this->addOption(storm::settings::OptionBuilder(moduleName, intervalIterationSymmetricUpdatesOptionName, false, "If set, interval iteration performs an update on both, lower and upper bound in each iteration").build());
                 
+                this->addOption(storm::settings::OptionBuilder(moduleName, ddRoundingBitsOptionName, true, "If set, the symbolic engines round the intermediate values of value iteration to the given number of significant bits (relative to the largest value).").addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("bits", "The number of significant bits.").addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
+                
+                this->addOption(storm::settings::OptionBuilder(moduleName, ddRoundingGridOptionName, true, "If set, the symbolic engines round the intermediate values of value iteration to multiples of the given width.").addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("width", "The width of the grid.").addValidatorDouble(ArgumentValidatorFactory::createDoubleGreaterValidator(0.0)).build()).build());
+                
             }
             
             storm::solver::MinMaxMethod MinMaxEquationSolverSettings::getMinMaxEquationSolvingMethod() const {
@@ -139,6 +145,22 @@ namespace storm {
                 return this->getOption(intervalIterationSymmetricUpdatesOptionName).getHasOptionBeenSet();
             }
             
+            bool MinMaxEquationSolverSettings::isDdRoundingBitsSet() const {
+                return this->getOption(ddRoundingBitsOptionName).getHasOptionBeenSet();
+            }
+            
+            uint64_t MinMaxEquationSolverSettings::getDdRoundingBits() const {
+                return this->getOption(ddRoundingBitsOptionName).getArgumentByName("bits").getValueAsUnsignedInteger();
+            }
+            
+            bool MinMaxEquationSolverSettings::isDdRoundingGridSet() const {
+                return this->getOption(ddRoundingGridOptionName).getHasOptionBeenSet();
+            }
+            
+            double MinMaxEquationSolverSettings::getDdRoundingGrid() const {
+                return this->getOption(ddRoundingGridOptionName).getArgumentByName("width").getValueAsDouble();
+            }
+            
         }
     }
 }
@@ -117,6 +117,26 @@ namespace storm {
                  */
                 bool isForceIntervalIterationSymmetricUpdatesSet() const;
                 
+                /*!
+                 * Retrieves whether the symbolic engines are to round intermediate values to a number of significant bits.
+                 */
+                bool isDdRoundingBitsSet() const;
+                
+                /*!
+                 * Retrieves the number of significant bits to which intermediate values of the symbolic engines are rounded.
+                 */
+                uint64_t getDdRoundingBits() const;
+                
+                /*!
+                 * Retrieves whether the symbolic engines are to round intermediate values to a grid of fixed width.
+                 */
+                bool isDdRoundingGridSet() const;
+                
+                /*!
+                 * Retrieves the width of the grid to which intermediate values of the symbolic engines are rounded.
+                 */
+                double getDdRoundingGrid() const;
+                
                 // The name of the module.
                 static const std::string moduleName;
                 
@@ -130,6 +150,8 @@ namespace storm {
                 static const std::string markovAutomatonBoundedReachabilityMethodOptionName;
                 static const std::string valueIterationMultiplicationStyleOptionName;
                 static const std::string intervalIterationSymmetricUpdatesOptionName;
+                static const std::string ddRoundingBitsOptionName;
+                static const std::string ddRoundingGridOptionName;
                 static const std::string forceBoundsOptionName;
             };
             
@@ -24,6 +24,8 @@ namespace storm {
             const std::string NativeEquationSolverSettings::absoluteOptionName = "absolute";
             const std::string NativeEquationSolverSettings::powerMethodMultiplicationStyleOptionName = "powmult";
             const std::string NativeEquationSolverSettings::intervalIterationSymmetricUpdatesOptionName = "symmetricupdates";
+            const std::string NativeEquationSolverSettings::ddRoundingBitsOptionName = "ddround-bits";
+            const std::string NativeEquationSolverSettings::ddRoundingGridOptionName = "ddround-grid";
 
             NativeEquationSolverSettings::NativeEquationSolverSettings() : ModuleSettings(moduleName) {
                 std::vector<std::string> methods = { "jacobi", "gaussseidel", "sor", "walkerchae", "power", "sound-value-iteration", "svi", "interval-iteration", "ii", "ratsearch" };
@@ -42,6 +44,10 @@ namespace storm {
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of a multiplication style.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(multiplicationStyles)).setDefaultValueString("gaussseidel").build()).build());
                                 
                 this->addOption(storm::settings::OptionBuilder(moduleName, intervalIterationSymmetricUpdatesOptionName, false, "If set, interval iteration performs an update on both, lower and upper bound in each iteration").build());
+                
+                this->addOption(storm::settings::OptionBuilder(moduleName, ddRoundingBitsOptionName, true, "If set, the symbolic engines round the intermediate values of value iteration to the given number of significant bits (relative to the largest value).").addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("bits", "The number of significant bits.").addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
+                
+                this->addOption(storm::settings::OptionBuilder(moduleName, ddRoundingGridOptionName, true, "If set, the symbolic engines round the intermediate values of value iteration to multiples of the given width.").addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("width", "The width of the grid.").addValidatorDouble(ArgumentValidatorFactory::createDoubleGreaterValidator(0.0)).build()).build());
             }
             
             bool NativeEquationSolverSettings::isLinearEquationSystemTechniqueSet() const {
@@ -115,6 +121,22 @@ namespace storm {
             bool NativeEquationSolverSettings::isForceIntervalIterationSymmetricUpdatesSet() const {
                 return this->getOption(intervalIterationSymmetricUpdatesOptionName).getHasOptionBeenSet();
             }
+            
+            bool NativeEquationSolverSettings::isDdRoundingBitsSet() const {
+                return this->getOption(ddRoundingBitsOptionName).getHasOptionBeenSet();
+            }
+            
+            uint64_t NativeEquationSolverSettings::getDdRoundingBits() const {
+                return this->getOption(ddRoundingBitsOptionName).getArgumentByName("bits").getValueAsUnsignedInteger();
+            }
+            
+            bool NativeEquationSolverSettings::isDdRoundingGridSet() const {
+                return this->getOption(ddRoundingGridOptionName).getHasOptionBeenSet();
+            }
+            
+            double NativeEquationSolverSettings::getDdRoundingGrid() const {
+                return this->getOption(ddRoundingGridOptionName).getArgumentByName("width").getValueAsDouble();
+            }
 
             bool NativeEquationSolverSettings::check() const {
                 return true;
@@ -15,11 +15,17 @@ namespace storm {
             const std::string ResourceSettings::timeoutOptionShortName = "t";
             const std::string ResourceSettings::printTimeAndMemoryOptionName = "timemem";
             const std::string ResourceSettings::printTimeAndMemoryOptionShortName = "tm";
+            const std::string ResourceSettings::exportProfileOptionName = "exportprofile";
+            const std::string ResourceSettings::exportTraceOptionName = "exporttrace";
 
             ResourceSettings::ResourceSettings() : ModuleSettings(moduleName) {
                 this->addOption(storm::settings::OptionBuilder(moduleName, timeoutOptionName, false, "If given, computation will abort after the timeout has been reached.").setShortName(timeoutOptionShortName)
                                 .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("time", "The number of seconds after which to timeout.").setDefaultValueUnsignedInteger(0).build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, printTimeAndMemoryOptionName, false, "Prints CPU time and memory consumption at the end.").setShortName(printTimeAndMemoryOptionShortName).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, exportProfileOptionName, false, "Collects the time spent in the individual phases together with counters (e.g. explored states, solver iterations) and exports them as json.")
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The name of the file to which the profile is to be written.").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, exportTraceOptionName, false, "Collects the time spent in the individual phases and exports them in the Chrome trace event format.")
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The name of the file to which the trace is to be written.").build()).build());
             }
             
             bool ResourceSettings::isTimeoutSet() const {
@@ -33,6 +39,26 @@ namespace storm {
             bool ResourceSettings::isPrintTimeAndMemorySet() const {
                 return this->getOption(printTimeAndMemoryOptionName).getHasOptionBeenSet();
             }
+            
+            bool ResourceSettings::isProfilingSet() const {
+                return isExportProfileSet() || isExportTraceSet();
+            }
+            
+            bool ResourceSettings::isExportProfileSet() const {
+                return this->getOption(exportProfileOptionName).getHasOptionBeenSet();
+            }
+            
+            std::string ResourceSettings::getExportProfileFilename() const {
+                return this->getOption(exportProfileOptionName).getArgumentByName("filename").getValueAsString();
+            }
+            
+            bool ResourceSettings::isExportTraceSet() const {
+                return this->getOption(exportTraceOptionName).getHasOptionBeenSet();
+            }
+            
+            std::string ResourceSettings::getExportTraceFilename() const {
+                return this->getOption(exportTraceOptionName).getArgumentByName("filename").getValueAsString();
+            }
 
         }
     }
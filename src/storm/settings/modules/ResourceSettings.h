@@ -39,6 +39,42 @@ namespace storm {
                  */
                 uint_fast64_t getTimeoutInSeconds() const;
 
+                /*!
+                 * Retrieves whether phase timings and counters are to be collected, i.e. whether one of the profile
+                 * export options was set.
+                 *
+                 * @return True iff profiling is enabled.
+                 */
+                bool isProfilingSet() const;
+
+                /*!
+                 * Retrieves whether the collected phase timings and counters are to be exported as json.
+                 *
+                 * @return True iff the option was set.
+                 */
+                bool isExportProfileSet() const;
+
+                /*!
+                 * Retrieves the name of the file to which the phase timings and counters are exported.
+                 *
+                 * @return The name of the file.
+                 */
+                std::string getExportProfileFilename() const;
+
+                /*!
+                 * Retrieves whether the collected phase timings are to be exported in the Chrome trace event format.
+                 *
+                 * @return True iff the option was set.
+                 */
+                bool isExportTraceSet() const;
+
+                /*!
+                 * Retrieves the name of the file to which the trace is exported.
+                 *
+                 * @return The name of the file.
+                 */
+                std::string getExportTraceFilename() const;
+
                 // The name of the module.
                 static const std::string moduleName;
 
@@ -48,6 +84,8 @@ namespace storm {
                 static const std::string timeoutOptionShortName;
                 static const std::string printTimeAndMemoryOptionName;
                 static const std::string printTimeAndMemoryOptionShortName;
+                static const std::string exportProfileOptionName;
+                static const std::string exportTraceOptionName;
             };
         }
     }
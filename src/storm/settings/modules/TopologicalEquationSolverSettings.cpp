@@ -24,6 +24,7 @@ namespace storm {
             const std::string TopologicalEquationSolverSettings::moduleName = "topological";
             const std::string TopologicalEquationSolverSettings::underlyingEquationSolverOptionName = "eqsolver";
             const std::string TopologicalEquationSolverSettings::underlyingMinMaxMethodOptionName = "minmax";
+            const std::string TopologicalEquationSolverSettings::adaptivePrecisionOptionName = "adaptive-precision";
             
             TopologicalEquationSolverSettings::TopologicalEquationSolverSettings() : ModuleSettings(moduleName) {
                 std::vector<std::string> linearEquationSolver = {"gmm++", "native", "eigen", "elimination"};
@@ -32,6 +33,7 @@ namespace storm {
                 std::vector<std::string> minMaxSolvingTechniques = {"vi", "value-iteration", "pi", "policy-iteration", "lp", "linear-programming", "rs", "ratsearch", "ii", "interval-iteration", "svi", "sound-value-iteration", "vi-to-pi"};
                 this->addOption(storm::settings::OptionBuilder(moduleName, underlyingMinMaxMethodOptionName, true, "Sets which minmax method is considered for solving the underlying minmax equation systems.")
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the used min max method.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(minMaxSolvingTechniques)).setDefaultValueString("value-iteration").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, adaptivePrecisionOptionName, true, "If set, the precision of each SCC is derived from the longest chain of relevant SCCs through it and SCCs that do not influence the relevant values are skipped.").build());
             }
 
             bool TopologicalEquationSolverSettings::isUnderlyingEquationSolverTypeSet() const {
@@ -85,6 +87,10 @@ namespace storm {
                 STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown underlying equation solver '" << minMaxEquationSolvingTechnique << "'.");
             }
             
+            bool TopologicalEquationSolverSettings::isAdaptivePrecisionSet() const {
+                return this->getOption(adaptivePrecisionOptionName).getHasOptionBeenSet();
+            }
+            
             bool TopologicalEquationSolverSettings::check() const {
                 if (this->isUnderlyingEquationSolverTypeSet() && getUnderlyingEquationSolverType() == storm::solver::EquationSolverType::Topological) {
                     STORM_LOG_WARN("Underlying solver type of the topological solver can not be the topological solver.");
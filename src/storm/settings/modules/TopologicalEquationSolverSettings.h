@@ -61,6 +61,14 @@ namespace storm {
                  */
                 storm::solver::MinMaxMethod getUnderlyingMinMaxMethod() const;
                 
+                /*!
+                 * Retrieves whether the precision of each SCC is to be derived from the SCC graph and SCCs that do not
+                 * influence the relevant values are to be skipped.
+                 *
+                 * @return True iff adaptive precision is to be used.
+                 */
+                bool isAdaptivePrecisionSet() const;
+                
                 bool check() const override;
                 
                 // The name of the module.
@@ -70,6 +78,7 @@ namespace storm {
                 // Define the string names of the options as constants.
                 static const std::string underlyingEquationSolverOptionName;
                 static const std::string underlyingMinMaxMethodOptionName;
+                static const std::string adaptivePrecisionOptionName;
             };
             
         } // namespace modules
@@ -5,6 +5,8 @@
 #include "storm/environment/solver/EigenSolverEnvironment.h"
 
 #include "storm/utility/vector.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/KwekMehlhorn.h"
 #include "storm/utility/macros.h"
 #include "storm/exceptions/InvalidSettingsException.h"
 
@@ -64,11 +66,78 @@ namespace storm {
         }
         
         #ifdef STORM_HAVE_CARL
+        /*!
+         * Checks whether the given values satisfy the given system exactly.
+         */
+        static bool isExactSolution(StormEigen::SparseMatrix<storm::RationalNumber> const& A, std::vector<storm::RationalNumber> const& x, std::vector<storm::RationalNumber> const& b) {
+            std::vector<storm::RationalNumber> lhs(A.rows(), storm::utility::zero<storm::RationalNumber>());
+            for (StormEigen::Index outer = 0; outer < A.outerSize(); ++outer) {
+                for (StormEigen::SparseMatrix<storm::RationalNumber>::InnerIterator it(A, outer); it; ++it) {
+                    lhs[it.row()] += it.value() * x[it.col()];
+                }
+            }
+            return lhs == b;
+        }
+        
+        /*!
+         * Solves the system with floating point numbers and tries to reconstruct the exact solution from the result by
+         * rounding it to rationals with increasingly many digits. Returns true iff an exact solution was found, which is
+         * then written to x.
+         */
+        static bool solveFloatingPointGuided(StormEigen::SparseMatrix<storm::RationalNumber> const& A, std::vector<storm::RationalNumber>& x, std::vector<storm::RationalNumber> const& b) {
+            std::vector<StormEigen::Triplet<double>> triplets;
+            triplets.reserve(A.nonZeros());
+            for (StormEigen::Index outer = 0; outer < A.outerSize(); ++outer) {
+                for (StormEigen::SparseMatrix<storm::RationalNumber>::InnerIterator it(A, outer); it; ++it) {
+                    triplets.emplace_back(it.row(), it.col(), storm::utility::convertNumber<double>(it.value()));
+                }
+            }
+            StormEigen::SparseMatrix<double> doubleA(A.rows(), A.cols());
+            doubleA.setFromTriplets(triplets.begin(), triplets.end());
+            
+            std::vector<double> doubleB = storm::utility::vector::convertNumericVector<double>(b);
+            std::vector<double> doubleX(x.size());
+            auto eigenX = StormEigen::Matrix<double, StormEigen::Dynamic, 1>::Map(doubleX.data(), doubleX.size());
+            auto eigenB = StormEigen::Matrix<double, StormEigen::Dynamic, 1>::Map(doubleB.data(), doubleB.size());
+            
+            StormEigen::SparseLU<StormEigen::SparseMatrix<double>, StormEigen::COLAMDOrdering<int>> solver;
+            solver.compute(doubleA);
+            if (solver.info() != StormEigen::ComputationInfo::Success) {
+                return false;
+            }
+            solver._solve_impl(eigenB, eigenX);
+            if (solver.info() != StormEigen::ComputationInfo::Success) {
+                return false;
+            }
+            
+            // Checking a candidate only takes one (exact) matrix-vector multiplication, which is much cheaper than an
+            // exact factorization.
+            std::vector<storm::RationalNumber> candidate(x.size());
+            for (uint64_t precision = 1; precision <= static_cast<uint64_t>(std::numeric_limits<double>::digits10); ++precision) {
+                storm::utility::kwek_mehlhorn::sharpen(precision, doubleX, candidate);
+                if (isExactSolution(A, candidate, b)) {
+                    STORM_LOG_INFO("Reconstructed exact solution from floating point solution with " << precision << " digit(s).");
+                    x = std::move(candidate);
+                    return true;
+                }
+            }
+            return false;
+        }
+        
         // Specialization for storm::RationalNumber
         template<>
         bool EigenLinearEquationSolver<storm::RationalNumber>::internalSolveEquations(Environment const& env, std::vector<storm::RationalNumber>& x, std::vector<storm::RationalNumber> const& b) const {
             auto solutionMethod = getMethod(env, true);
             STORM_LOG_WARN_COND(solutionMethod == EigenLinearEquationSolverMethod::SparseLU, "Switching method to SparseLU.");
+            
+            if (env.solver().eigen().isFloatingPointGuidedSet()) {
+                STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with floating point numbers using LU factorization (Eigen library) and reconstructing the exact solution.");
+                if (solveFloatingPointGuided(*eigenA, x, b)) {
+                    return true;
+                }
+                STORM_LOG_INFO("Could not reconstruct the exact solution from the floating point solution. Falling back to exact LU factorization.");
+            }
+            
             STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with with rational numbers using LU factorization (Eigen library).");
             
             // Map the input vectors to Eigen's format.
@@ -10,6 +10,7 @@
 #include "storm/exceptions/NotSupportedException.h"
 
 #include "storm/utility/macros.h"
+#include "storm/utility/Profiler.h"
 
 namespace storm {
     namespace solver {
@@ -43,6 +44,7 @@ namespace storm {
         
         template<typename ValueType>
         void GmmxxMultiplier<ValueType>::multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+            storm::utility::addToProfilerCounter("matrix-vector products", 1);
             initialize();
             std::vector<ValueType>* target = &result;
             if (&x == &result) {
@@ -65,6 +67,7 @@ namespace storm {
         
         template<typename ValueType>
         void GmmxxMultiplier<ValueType>::multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b) const {
+            storm::utility::addToProfilerCounter("matrix-vector products", 1);
             initialize();
             STORM_LOG_ASSERT(gmmMatrix.nr == gmmMatrix.nc, "Expecting square matrix.");
             if (b) {
@@ -76,6 +79,7 @@ namespace storm {
         
         template<typename ValueType>
         void GmmxxMultiplier<ValueType>::multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            storm::utility::addToProfilerCounter("matrix-vector products", 1);
             initialize();
             std::vector<ValueType>* target = &result;
             if (&x == &result) {
@@ -98,6 +102,7 @@ namespace storm {
         
         template<typename ValueType>
         void GmmxxMultiplier<ValueType>::multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices) const {
+            storm::utility::addToProfilerCounter("matrix-vector products", 1);
             initialize();
             multAddReduceHelper(dir, rowGroupIndices, x, b, x, choices);
         }
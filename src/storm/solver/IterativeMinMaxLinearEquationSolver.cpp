@@ -1,8 +1,11 @@
+#include <atomic>
 #include <functional>
 #include <limits>
 
 #include "storm/solver/IterativeMinMaxLinearEquationSolver.h"
 
+#include "storm-config.h"
+
 #include "storm/utility/ConstantsComparator.h"
 
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
@@ -10,7 +13,11 @@
 #include "storm/utility/KwekMehlhorn.h"
 #include "storm/utility/NumberTraits.h"
 
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+
 #include "storm/utility/Stopwatch.h"
+#include "storm/utility/Profiler.h"
 #include "storm/utility/vector.h"
 #include "storm/utility/macros.h"
 #include "storm/exceptions/InvalidEnvironmentException.h"
@@ -19,6 +26,10 @@
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/PrecisionExceededException.h"
 
+#ifdef STORM_HAVE_INTELTBB
+#include "tbb/tbb.h"
+#endif
+
 namespace storm {
     namespace solver {
         
@@ -116,6 +127,149 @@ namespace storm {
             return linearEquationSolver->solveEquations(env, x, subB);
         }
         
+        template<typename ValueType>
+        bool IterativeMinMaxLinearEquationSolver<ValueType>::solveInducedEquationSystem(Environment const& env, std::unique_ptr<LinearEquationSolver<ValueType>>& linearEquationSolver, std::unique_ptr<storm::storage::SparseMatrix<ValueType>>& inducedMatrix, std::vector<uint64_t>& inducedScheduler, std::vector<uint64_t> const& scheduler, std::vector<ValueType>& x, std::vector<ValueType>& subB, std::vector<ValueType> const& originalB) const {
+            assert(subB.size() == x.size());
+            
+            // Resolve the nondeterminism according to the given scheduler. If possible, only the changed choices are considered.
+            bool convertToEquationSystem = this->linearEquationSolverFactory->getEquationProblemFormat(env) == LinearEquationSolverProblemFormat::EquationSystem;
+            if (!inducedMatrix || !updateInducedEquationSystem(*inducedMatrix, inducedScheduler, scheduler, subB, originalB, convertToEquationSystem)) {
+                inducedMatrix = std::make_unique<storm::storage::SparseMatrix<ValueType>>(this->A->selectRowsFromRowGroups(scheduler, convertToEquationSystem));
+                if (convertToEquationSystem) {
+                    inducedMatrix->convertToEquationSystem();
+                }
+                storm::utility::vector::selectVectorValues<ValueType>(subB, scheduler, this->A->getRowGroupIndices(), originalB);
+                inducedScheduler = scheduler;
+            }
+            
+            // The equation solver might only refer to the induced matrix, so it has to be notified even if the matrix was updated in place.
+            if (!linearEquationSolver) {
+                // Initialize the equation solver
+                linearEquationSolver = this->linearEquationSolverFactory->create(env, *inducedMatrix);
+                linearEquationSolver->setBoundsFromOtherSolver(*this);
+                linearEquationSolver->setCachingEnabled(true);
+            } else {
+                linearEquationSolver->setMatrix(*inducedMatrix);
+            }
+            // Solve the equation system for the 'DTMC' starting from the current values and return true upon success
+            return linearEquationSolver->solveEquations(env, x, subB);
+        }
+        
+        template<typename ValueType>
+        bool IterativeMinMaxLinearEquationSolver<ValueType>::updateInducedEquationSystem(storm::storage::SparseMatrix<ValueType>& inducedMatrix, std::vector<uint64_t>& inducedScheduler, std::vector<uint64_t> const& scheduler, std::vector<ValueType>& subB, std::vector<ValueType> const& originalB, bool convertToEquationSystem) const {
+            ValueType zero = storm::utility::zero<ValueType>();
+            ValueType one = storm::utility::one<ValueType>();
+            std::vector<uint64_t> const& rowGroupIndices = this->A->getRowGroupIndices();
+            int64_t nonzeroEntryDifference = 0;
+            for (uint64_t group = 0; group < scheduler.size(); ++group) {
+                if (scheduler[group] == inducedScheduler[group]) {
+                    continue;
+                }
+                auto newRow = this->A->getRow(rowGroupIndices[group] + scheduler[group]);
+                auto inducedRow = inducedMatrix.getRow(group);
+                
+                // The equation system has an entry on the diagonal for every row.
+                bool insertDiagonalEntry = convertToEquationSystem;
+                if (convertToEquationSystem) {
+                    for (auto const& entry : newRow) {
+                        if (entry.getColumn() == group) {
+                            insertDiagonalEntry = false;
+                            break;
+                        }
+                    }
+                }
+                if (inducedRow.getNumberOfEntries() != newRow.getNumberOfEntries() + (insertDiagonalEntry ? 1 : 0)) {
+                    return false;
+                }
+                
+                // Overwrite the row with the entries of the new choice (transformed to the equation system if necessary).
+                auto inducedEntry = inducedRow.begin();
+                auto writeEntry = [&] (uint64_t column, ValueType value) {
+                    if (convertToEquationSystem) {
+                        value = column == group ? one - value : -value;
+                    }
+                    if (inducedEntry->getValue() != zero) {
+                        --nonzeroEntryDifference;
+                    }
+                    if (value != zero) {
+                        ++nonzeroEntryDifference;
+                    }
+                    inducedEntry->setColumn(column);
+                    inducedEntry->setValue(std::move(value));
+                    ++inducedEntry;
+                };
+                for (auto const& entry : newRow) {
+                    if (insertDiagonalEntry && entry.getColumn() > group) {
+                        writeEntry(group, zero);
+                        insertDiagonalEntry = false;
+                    }
+                    writeEntry(entry.getColumn(), entry.getValue());
+                }
+                if (insertDiagonalEntry) {
+                    writeEntry(group, zero);
+                }
+                
+                subB[group] = originalB[rowGroupIndices[group] + scheduler[group]];
+                inducedScheduler[group] = scheduler[group];
+            }
+            inducedMatrix.updateNonzeroEntryCount(nonzeroEntryDifference);
+            return true;
+        }
+        
+        template<typename ValueType>
+        bool IterativeMinMaxLinearEquationSolver<ValueType>::parallelizeImprovement() const {
+#ifdef STORM_HAVE_INTELTBB
+            // The improvement is only parallelized for floating point types
+            return !storm::NumberTraits<ValueType>::IsExact && storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
+#else
+            return false;
+#endif
+        }
+        
+        template<typename ValueType>
+        bool IterativeMinMaxLinearEquationSolver<ValueType>::improveSchedulerParallel(OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b, std::vector<uint64_t>& scheduler) const {
+#ifdef STORM_HAVE_INTELTBB
+            std::vector<uint64_t> const& rowGroupIndices = this->A->getRowGroupIndices();
+            // As the values of all row groups are read concurrently, the values of improved choices are stored separately.
+            std::vector<ValueType> improvedX(x.size());
+            std::atomic<bool> schedulerImproved(false);
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(0, this->A->getRowGroupCount(), 100), [&] (tbb::blocked_range<uint64_t> const& range) {
+                bool rangeImproved = false;
+                for (uint64_t group = range.begin(); group < range.end(); ++group) {
+                    improvedX[group] = x[group];
+                    uint64_t currentChoice = scheduler[group];
+                    for (uint64_t choice = rowGroupIndices[group]; choice < rowGroupIndices[group + 1]; ++choice) {
+                        // If the choice is the currently selected one, we can skip it.
+                        if (choice - rowGroupIndices[group] == currentChoice) {
+                            continue;
+                        }
+                        
+                        // Create the value of the choice.
+                        ValueType choiceValue = storm::utility::zero<ValueType>();
+                        for (auto const& entry : this->A->getRow(choice)) {
+                            choiceValue += entry.getValue() * x[entry.getColumn()];
+                        }
+                        choiceValue += b[choice];
+                        
+                        if (valueImproved(dir, improvedX[group], choiceValue)) {
+                            rangeImproved = true;
+                            scheduler[group] = choice - rowGroupIndices[group];
+                            improvedX[group] = std::move(choiceValue);
+                        }
+                    }
+                }
+                if (rangeImproved) {
+                    schedulerImproved = true;
+                }
+            });
+            x.swap(improvedX);
+            return schedulerImproved;
+#else
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Parallel policy improvement requires Intel TBB.");
+            return false;
+#endif
+        }
+        
         template<typename ValueType>
         bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsPolicyIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
             // Create the initial scheduler.
@@ -132,6 +286,11 @@ namespace storm {
             }
             std::vector<ValueType>& subB = *auxiliaryRowGroupVector;
 
+            // The matrix induced by the current scheduler and the scheduler that induced it. Keeping them allows to only
+            // rewrite the rows whose choice changed. Note that the solver might refer to the matrix, so it is declared first.
+            std::unique_ptr<storm::storage::SparseMatrix<ValueType>> inducedMatrix;
+            std::vector<storm::storage::sparse::state_type> inducedScheduler;
+            
             // The solver that we will use throughout the procedure.
             std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver;
             // The linear equation solver should be at least as precise as this solver
@@ -155,37 +314,42 @@ namespace storm {
             }
             storm::Environment const& environmentOfSolver = environmentOfSolverStorage ? *environmentOfSolverStorage : env;
 
+            bool parallelImprovement = parallelizeImprovement();
             SolverStatus status = SolverStatus::InProgress;
             uint64_t iterations = 0;
             this->startMeasureProgress();
             do {
-                // Solve the equation system for the 'DTMC'.
-                solveInducedEquationSystem(environmentOfSolver, solver, scheduler, x, subB, b);
+                // Solve the equation system for the 'DTMC'. The solution of the previous iteration serves as a starting point.
+                solveInducedEquationSystem(environmentOfSolver, solver, inducedMatrix, inducedScheduler, scheduler, x, subB, b);
                 
                 // Go through the multiplication result and see whether we can improve any of the choices.
                 bool schedulerImproved = false;
-                for (uint_fast64_t group = 0; group < this->A->getRowGroupCount(); ++group) {
-                    uint_fast64_t currentChoice = scheduler[group];
-                    for (uint_fast64_t choice = this->A->getRowGroupIndices()[group]; choice < this->A->getRowGroupIndices()[group + 1]; ++choice) {
-                        // If the choice is the currently selected one, we can skip it.
-                        if (choice - this->A->getRowGroupIndices()[group] == currentChoice) {
-                            continue;
-                        }
+                if (parallelImprovement) {
+                    schedulerImproved = improveSchedulerParallel(dir, x, b, scheduler);
+                } else {
+                    for (uint_fast64_t group = 0; group < this->A->getRowGroupCount(); ++group) {
+                        uint_fast64_t currentChoice = scheduler[group];
+                        for (uint_fast64_t choice = this->A->getRowGroupIndices()[group]; choice < this->A->getRowGroupIndices()[group + 1]; ++choice) {
+                            // If the choice is the currently selected one, we can skip it.
+                            if (choice - this->A->getRowGroupIndices()[group] == currentChoice) {
+                                continue;
+                            }
                         
-                        // Create the value of the choice.
-                        ValueType choiceValue = storm::utility::zero<ValueType>();
-                        for (auto const& entry : this->A->getRow(choice)) {
-                            choiceValue += entry.getValue() * x[entry.getColumn()];
-                        }
-                        choiceValue += b[choice];
+                            // Create the value of the choice.
+                            ValueType choiceValue = storm::utility::zero<ValueType>();
+                            for (auto const& entry : this->A->getRow(choice)) {
+                                choiceValue += entry.getValue() * x[entry.getColumn()];
+                            }
+                            choiceValue += b[choice];
                         
-                        // If the value is strictly better than the solution of the inner system, we need to improve the scheduler.
-                        // TODO: If the underlying solver is not precise, this might run forever (i.e. when a state has two choices where the (exact) values are equal).
-                        // only changing the scheduler if the values are not equal (modulo precision) would make this unsound.
-                        if (valueImproved(dir, x[group], choiceValue)) {
-                            schedulerImproved = true;
-                            scheduler[group] = choice - this->A->getRowGroupIndices()[group];
-                            x[group] = std::move(choiceValue);
+                            // If the value is strictly better than the solution of the inner system, we need to improve the scheduler.
+                            // TODO: If the underlying solver is not precise, this might run forever (i.e. when a state has two choices where the (exact) values are equal).
+                            // only changing the scheduler if the values are not equal (modulo precision) would make this unsound.
+                            if (valueImproved(dir, x[group], choiceValue)) {
+                                schedulerImproved = true;
+                                scheduler[group] = choice - this->A->getRowGroupIndices()[group];
+                                x[group] = std::move(choiceValue);
+                            }
                         }
                     }
                 }
@@ -302,22 +466,20 @@ namespace storm {
             
             SolverStatus status = SolverStatus::InProgress;
             while (status == SolverStatus::InProgress) {
-                // Compute x' = min/max(A*x + b).
+                // Compute x' = min/max(A*x + b) and determine whether the method converged in the same sweep.
+                bool converged;
                 if (useGaussSeidelMultiplication) {
-                    // Copy over the current vector so we can modify it in-place.
-                    *newX = *currentX;
-                    multiplier.multiplyAndReduceGaussSeidel(env, dir, *newX, &b);
+                    // The values are updated in-place and compared against their previous values on the fly.
+                    converged = multiplier.multiplyAndReduceGaussSeidelAndCheckConvergence(env, dir, *currentX, &b, precision, relative);
                 } else {
-                    multiplier.multiplyAndReduce(env, dir, *currentX, &b, *newX);
+                    converged = multiplier.multiplyAndReduceAndCheckConvergence(env, dir, *currentX, &b, *newX, precision, relative);
+                    std::swap(currentX, newX);
                 }
-                
-                // Determine whether the method converged.
-                if (storm::utility::vector::equalModuloPrecision<ValueType>(*currentX, *newX, precision, relative)) {
+                if (converged) {
                     status = SolverStatus::Converged;
                 }
                 
                 // Update environment variables.
-                std::swap(currentX, newX);
                 ++iterations;
                 status = updateStatusIfNotConverged(status, *currentX, iterations, maximalNumberOfIterations, guarantee);
 
@@ -1026,6 +1188,7 @@ namespace storm {
         
         template<typename ValueType>
         void IterativeMinMaxLinearEquationSolver<ValueType>::reportStatus(SolverStatus status, uint64_t iterations) {
+            storm::utility::addToProfilerCounter("solver iterations", iterations);
             switch (status) {
                 case SolverStatus::Converged: STORM_LOG_TRACE("Iterative solver converged after " << iterations << " iterations."); break;
                 case SolverStatus::TerminatedEarly: STORM_LOG_TRACE("Iterative solver terminated early after " << iterations << " iterations."); break;
@@ -35,6 +35,38 @@ namespace storm {
             MinMaxMethod getMethod(Environment const& env, bool isExactMode) const;
             
             bool solveInducedEquationSystem(Environment const& env, std::unique_ptr<LinearEquationSolver<ValueType>>& linearEquationSolver, std::vector<uint64_t> const& scheduler, std::vector<ValueType>& x, std::vector<ValueType>& subB, std::vector<ValueType> const& originalB) const;
+            
+            /*!
+             * Solves the equation system induced by the given scheduler. The induced matrix is kept alive across calls:
+             * if it was already built for a previous scheduler, only the rows of row groups whose choice changed are
+             * rewritten. The linear equation solver starts from the given values of x.
+             *
+             * @param inducedMatrix The matrix induced by inducedScheduler (if it was already built).
+             * @param inducedScheduler The scheduler that induced the given matrix and right-hand side. Is updated to the given scheduler.
+             */
+            bool solveInducedEquationSystem(Environment const& env, std::unique_ptr<LinearEquationSolver<ValueType>>& linearEquationSolver, std::unique_ptr<storm::storage::SparseMatrix<ValueType>>& inducedMatrix, std::vector<uint64_t>& inducedScheduler, std::vector<uint64_t> const& scheduler, std::vector<ValueType>& x, std::vector<ValueType>& subB, std::vector<ValueType> const& originalB) const;
+            
+            /*!
+             * Rewrites the rows of the induced matrix and the entries of the right-hand side whose choice differs in
+             * the given scheduler and the scheduler that induced them.
+             *
+             * @return False if the matrix could not be updated in place because the number of entries of a row changes.
+             * In this case, the matrix needs to be rebuilt.
+             */
+            bool updateInducedEquationSystem(storm::storage::SparseMatrix<ValueType>& inducedMatrix, std::vector<uint64_t>& inducedScheduler, std::vector<uint64_t> const& scheduler, std::vector<ValueType>& subB, std::vector<ValueType> const& originalB, bool convertToEquationSystem) const;
+            
+            /*!
+             * Performs the improvement step of policy iteration for all row groups in parallel. As opposed to the
+             * sequential improvement, choice values are always computed w.r.t. the values of the previous evaluation.
+             *
+             * @return True iff the scheduler was improved.
+             */
+            bool improveSchedulerParallel(OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b, std::vector<uint64_t>& scheduler) const;
+            
+            /*!
+             * Retrieves whether the improvement step of policy iteration is performed in parallel.
+             */
+            bool parallelizeImprovement() const;
             bool solveEquationsPolicyIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             bool performPolicyIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b, std::vector<storm::storage::sparse::state_type>&& initialPolicy) const;
             bool valueImproved(OptimizationDirection dir, ValueType const& value1, ValueType const& value2) const;
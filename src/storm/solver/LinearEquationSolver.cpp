@@ -14,6 +14,7 @@
 #include "storm/environment/solver/SolverEnvironment.h"
 
 #include "storm/utility/macros.h"
+#include "storm/utility/Profiler.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/UnmetRequirementException.h"
 
@@ -27,6 +28,7 @@ namespace storm {
         
         template<typename ValueType>
         bool LinearEquationSolver<ValueType>::solveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            storm::utility::ProfilerPhase phase("linear equation solving");
             return this->internalSolveEquations(env, x, b);
         }
         
@@ -8,11 +8,14 @@
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/utility/macros.h"
+#include "storm/utility/vector.h"
 #include "storm/solver/SolverSelectionOptions.h"
 #include "storm/solver/NativeMultiplier.h"
 #include "storm/solver/GmmxxMultiplier.h"
 #include "storm/environment/solver/MultiplierEnvironment.h"
 
+#include "storm/exceptions/NotSupportedException.h"
+
 namespace storm {
     namespace solver {
         
@@ -36,6 +39,50 @@ namespace storm {
             multiplyAndReduceGaussSeidel(env, dir, this->matrix.getRowGroupIndices(), x, b, choices);
         }
     
+        template<typename ValueType>
+        bool Multiplier<ValueType>::multiplyAndReduceAndCheckConvergence(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, ValueType const& precision, bool relative, std::vector<uint_fast64_t>* choices) const {
+            return multiplyAndReduceAndCheckConvergence(env, dir, this->matrix.getRowGroupIndices(), x, b, result, precision, relative, choices);
+        }
+        
+        template<typename ValueType>
+        bool Multiplier<ValueType>::multiplyAndReduceAndCheckConvergence(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, ValueType const& precision, bool relative, std::vector<uint_fast64_t>* choices) const {
+            if (&x == &result) {
+                std::vector<ValueType> oldX = x;
+                multiplyAndReduce(env, dir, rowGroupIndices, oldX, b, result, choices);
+                return storm::utility::vector::equalModuloPrecision<ValueType>(oldX, result, precision, relative);
+            }
+            multiplyAndReduce(env, dir, rowGroupIndices, x, b, result, choices);
+            return storm::utility::vector::equalModuloPrecision<ValueType>(x, result, precision, relative);
+        }
+        
+        template<typename ValueType>
+        bool Multiplier<ValueType>::multiplyAndReduceGaussSeidelAndCheckConvergence(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType>& x, std::vector<ValueType> const* b, ValueType const& precision, bool relative, std::vector<uint_fast64_t>* choices) const {
+            return multiplyAndReduceGaussSeidelAndCheckConvergence(env, dir, this->matrix.getRowGroupIndices(), x, b, precision, relative, choices);
+        }
+        
+        template<typename ValueType>
+        bool Multiplier<ValueType>::multiplyAndReduceGaussSeidelAndCheckConvergence(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, ValueType const& precision, bool relative, std::vector<uint_fast64_t>* choices) const {
+            if (this->cachedVector) {
+                *this->cachedVector = x;
+            } else {
+                this->cachedVector = std::make_unique<std::vector<ValueType>>(x);
+            }
+            multiplyAndReduceGaussSeidel(env, dir, rowGroupIndices, x, b, choices);
+            return storm::utility::vector::equalModuloPrecision<ValueType>(*this->cachedVector, x, precision, relative);
+        }
+        
+#ifdef STORM_HAVE_CARL
+        template<>
+        bool Multiplier<storm::RationalFunction>::multiplyAndReduceAndCheckConvergence(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<storm::RationalFunction> const& x, std::vector<storm::RationalFunction> const* b, std::vector<storm::RationalFunction>& result, storm::RationalFunction const& precision, bool relative, std::vector<uint_fast64_t>* choices) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+        }
+        
+        template<>
+        bool Multiplier<storm::RationalFunction>::multiplyAndReduceGaussSeidelAndCheckConvergence(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<storm::RationalFunction>& x, std::vector<storm::RationalFunction> const* b, storm::RationalFunction const& precision, bool relative, std::vector<uint_fast64_t>* choices) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+        }
+#endif
+        
         template<typename ValueType>
         void Multiplier<ValueType>::repeatedMultiply(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, uint64_t n) const {
             for (uint64_t i = 0; i < n; ++i) {
@@ -86,6 +86,47 @@ namespace storm {
             void multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices = nullptr) const;
             virtual void multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices = nullptr) const = 0;
             
+            /*!
+             * Performs a matrix-vector multiplication x' = A*x + b, minimizes/maximizes over the row groups and checks
+             * whether x' and x are equal modulo the given precision (as in storm::utility::vector::equalModuloPrecision).
+             * Implementations may do all of this in a single sweep over the matrix.
+             *
+             * @param dir The direction for the reduction step.
+             * @param rowGroupIndices A vector storing the row groups over which to reduce.
+             * @param x The input vector with which to multiply the matrix. Its length must be equal
+             * to the number of columns of A.
+             * @param b If non-null, this vector is added after the multiplication. If given, its length must be equal
+             * to the number of rows of A.
+             * @param result The target vector into which to write the multiplication result. Its length must be equal
+             * to the number of rows of A. Can be the same as the x vector.
+             * @param precision The precision up to which the old and new values are to be checked for equality.
+             * @param relative If set, the difference between the values is computed relative to the value or in absolute terms.
+             * @param choices If given, the choices made in the reduction process are written to this vector.
+             * @return True iff the old and new values are equal modulo the given precision.
+             */
+            bool multiplyAndReduceAndCheckConvergence(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, ValueType const& precision, bool relative, std::vector<uint_fast64_t>* choices = nullptr) const;
+            virtual bool multiplyAndReduceAndCheckConvergence(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, ValueType const& precision, bool relative, std::vector<uint_fast64_t>* choices = nullptr) const;
+            
+            /*!
+             * Performs a matrix-vector multiplication in gauss-seidel style, minimizes/maximizes over the row groups and
+             * checks whether each updated value is equal to its previous value modulo the given precision (as in
+             * storm::utility::vector::equalModuloPrecision). Implementations may do all of this in a single sweep over
+             * the matrix.
+             *
+             * @param dir The direction for the reduction step.
+             * @param rowGroupIndices A vector storing the row groups over which to reduce.
+             * @param x The input/output vector with which to multiply the matrix. Its length must be equal
+             * to the number of columns of A.
+             * @param b If non-null, this vector is added after the multiplication. If given, its length must be equal
+             * to the number of rows of A.
+             * @param precision The precision up to which the old and new values are to be checked for equality.
+             * @param relative If set, the difference between the values is computed relative to the value or in absolute terms.
+             * @param choices If given, the choices made in the reduction process are written to this vector.
+             * @return True iff the old and new values are equal modulo the given precision.
+             */
+            bool multiplyAndReduceGaussSeidelAndCheckConvergence(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType>& x, std::vector<ValueType> const* b, ValueType const& precision, bool relative, std::vector<uint_fast64_t>* choices = nullptr) const;
+            virtual bool multiplyAndReduceGaussSeidelAndCheckConvergence(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, ValueType const& precision, bool relative, std::vector<uint_fast64_t>* choices = nullptr) const;
+            
             /*!
              * Performs repeated matrix-vector multiplication, using x[0] = x and x[i + 1] = A*x[i] + b. After
              * performing the necessary multiplications, the result is written to the input vector x. Note that the
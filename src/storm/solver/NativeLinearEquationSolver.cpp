@@ -9,6 +9,7 @@
 #include "storm/utility/NumberTraits.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/vector.h"
+#include "storm/utility/Profiler.h"
 #include "storm/solver/helper/SoundValueIterationHelper.h"
 #include "storm/solver/Multiplier.h"
 #include "storm/exceptions/InvalidStateException.h"
@@ -94,6 +95,72 @@ namespace storm {
             
             return converged;
         }
+        
+        template<typename ValueType>
+        bool NativeLinearEquationSolver<ValueType>::solveEquationsSoundSOR(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b, ValueType const& omega) const {
+            STORM_LOG_THROW(this->hasLowerBound(), storm::exceptions::UnmetRequirementException, "Solver requires lower bound, but none was given.");
+            STORM_LOG_THROW(this->hasUpperBound(), storm::exceptions::UnmetRequirementException, "Solver requires upper bound, but none was given.");
+            
+            // For the equation system format (non-positive off-diagonal entries), a Gauss-Seidel sweep is monotone and
+            // maps lower (upper) bounds of the solution to lower (upper) bounds. Over-relaxation (omega > 1) breaks this,
+            // so we fall back to omega = 1 in this case.
+            ValueType soundOmega = omega;
+            if (soundOmega > storm::utility::one<ValueType>()) {
+                STORM_LOG_WARN("Over-relaxation (SOR omega = " << omega << ") does not preserve sound bounds. Falling back to omega = 1.");
+                soundOmega = storm::utility::one<ValueType>();
+            }
+            STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with NativeLinearEquationSolver (sound Gauss-Seidel, SOR omega = " << soundOmega << ")");
+            
+            // The lower bounds are improved in place in x and the upper bounds in the cached row vector.
+            std::vector<ValueType>* lowerX = &x;
+            this->createLowerBoundsVector(*lowerX);
+            this->createUpperBoundsVector(this->cachedRowVector, this->getMatrixRowCount());
+            std::vector<ValueType>* upperX = this->cachedRowVector.get();
+            
+            ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
+            bool relative = env.solver().native().getRelativeTerminationCriterion();
+            if (!relative) {
+                precision *= storm::utility::convertNumber<ValueType>(2.0);
+            }
+            uint64_t maxIter = env.solver().native().getMaximalNumberOfIterations();
+            
+            uint64_t iterations = 0;
+            bool converged = false;
+            bool terminate = false;
+            
+            this->startMeasureProgress();
+            while (!converged && !terminate && iterations < maxIter) {
+                A->performSuccessiveOverRelaxationStep(soundOmega, *lowerX, b);
+                A->performSuccessiveOverRelaxationStep(soundOmega, *upperX, b);
+                
+                // Now check if the process already converged within our precision. As for interval iteration, the
+                // target precision is doubled and the means of the lower and upper values are taken later.
+                if (this->hasRelevantValues()) {
+                    converged = storm::utility::vector::equalModuloPrecision<ValueType>(*lowerX, *upperX, this->getRelevantValues(), precision, relative);
+                } else {
+                    converged = storm::utility::vector::equalModuloPrecision<ValueType>(*lowerX, *upperX, precision, relative);
+                }
+                terminate = this->terminateNow(*lowerX, SolverGuarantee::LessOrEqual);
+                terminate |= this->terminateNow(*upperX, SolverGuarantee::GreaterOrEqual);
+                
+                // Potentially show progress.
+                this->showProgressIterative(iterations);
+                
+                // Increase iteration count so we can abort if convergence is too slow.
+                ++iterations;
+            }
+            
+            // We take the means of the lower and upper bound so we guarantee the desired precision.
+            storm::utility::vector::applyPointwise(*lowerX, *upperX, *lowerX, [] (ValueType const& a, ValueType const& b) -> ValueType { return (a + b) / storm::utility::convertNumber<ValueType>(2.0); });
+            
+            if (!this->isCachingEnabled()) {
+                clearCache();
+            }
+            
+            this->logIterations(converged, terminate, iterations);
+            
+            return converged;
+        }
     
         template<typename ValueType>
         NativeLinearEquationSolver<ValueType>::JacobiDecomposition::JacobiDecomposition(Environment const& env, storm::storage::SparseMatrix<ValueType> const& A) {
@@ -887,6 +954,7 @@ namespace storm {
         
         template<typename ValueType>
         void NativeLinearEquationSolver<ValueType>::logIterations(bool converged, bool terminate, uint64_t iterations) const {
+            storm::utility::addToProfilerCounter("solver iterations", iterations);
             if (converged) {
                 STORM_LOG_INFO("Iterative solver converged in " << iterations << " iterations.");
             } else if (terminate) {
@@ -908,7 +976,7 @@ namespace storm {
                 } else {
                     STORM_LOG_WARN("The selected solution method does not guarantee exact results.");
                 }
-            } else if (env.solver().isForceSoundness() && method != NativeLinearEquationSolverMethod::SoundValueIteration && method != NativeLinearEquationSolverMethod::IntervalIteration && method != NativeLinearEquationSolverMethod::RationalSearch) {
+            } else if (env.solver().isForceSoundness() && method != NativeLinearEquationSolverMethod::SoundValueIteration && method != NativeLinearEquationSolverMethod::IntervalIteration && method != NativeLinearEquationSolverMethod::RationalSearch && method != NativeLinearEquationSolverMethod::GaussSeidel && method != NativeLinearEquationSolverMethod::SOR) {
                 if (env.solver().native().isMethodSetFromDefault()) {
                     method = NativeLinearEquationSolverMethod::SoundValueIteration;
                     STORM_LOG_INFO("Selecting '" + toString(method) + "' as the solution technique to guarantee sound results. If you want to override this, please explicitly specify a different method.");
@@ -924,8 +992,14 @@ namespace storm {
         bool NativeLinearEquationSolver<ValueType>::internalSolveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
             switch(getMethod(env, storm::NumberTraits<ValueType>::IsExact)) {
                 case NativeLinearEquationSolverMethod::SOR:
+                    if (env.solver().isForceSoundness()) {
+                        return this->solveEquationsSoundSOR(env, x, b, storm::utility::convertNumber<ValueType>(env.solver().native().getSorOmega()));
+                    }
                     return this->solveEquationsSOR(env, x, b, storm::utility::convertNumber<ValueType>(env.solver().native().getSorOmega()));
                 case NativeLinearEquationSolverMethod::GaussSeidel:
+                    if (env.solver().isForceSoundness()) {
+                        return this->solveEquationsSoundSOR(env, x, b, storm::utility::one<ValueType>());
+                    }
                     return this->solveEquationsSOR(env, x, b, storm::utility::one<ValueType>());
                 case NativeLinearEquationSolverMethod::Jacobi:
                     return this->solveEquationsJacobi(env, x, b);
@@ -964,6 +1038,8 @@ namespace storm {
                 requirements.requireLowerBounds();
             } else if (method == NativeLinearEquationSolverMethod::SoundValueIteration) {
                 requirements.requireBounds(false);
+            } else if ((method == NativeLinearEquationSolverMethod::GaussSeidel || method == NativeLinearEquationSolverMethod::SOR) && env.solver().isForceSoundness()) {
+                requirements.requireBounds();
             }
             return requirements;
         }
@@ -11,7 +11,12 @@
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 
+#include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/vector.h"
+#include "storm/utility/Profiler.h"
+
+#include "storm/exceptions/NotSupportedException.h"
 
 namespace storm {
     namespace solver {
@@ -32,6 +37,7 @@ namespace storm {
         
         template<typename ValueType>
         void NativeMultiplier<ValueType>::multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+            storm::utility::addToProfilerCounter("matrix-vector products", 1);
             std::vector<ValueType>* target = &result;
             if (&x == &result) {
                 if (this->cachedVector) {
@@ -53,11 +59,13 @@ namespace storm {
         
         template<typename ValueType>
         void NativeMultiplier<ValueType>::multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b) const {
+            storm::utility::addToProfilerCounter("matrix-vector products", 1);
             this->matrix.multiplyWithVectorBackward(x, x, b);
         }
         
         template<typename ValueType>
         void NativeMultiplier<ValueType>::multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            storm::utility::addToProfilerCounter("matrix-vector products", 1);
             std::vector<ValueType>* target = &result;
             if (&x == &result) {
                 if (this->cachedVector) {
@@ -79,9 +87,39 @@ namespace storm {
         
         template<typename ValueType>
         void NativeMultiplier<ValueType>::multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices) const {
+            storm::utility::addToProfilerCounter("matrix-vector products", 1);
             this->matrix.multiplyAndReduceBackward(dir, rowGroupIndices, x, b, x, choices);
         }
         
+        template<typename ValueType>
+        bool NativeMultiplier<ValueType>::multiplyAndReduceAndCheckConvergence(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, ValueType const& precision, bool relative, std::vector<uint_fast64_t>* choices) const {
+            if (parallelize(env)) {
+                // The parallel multiplication does not support the fused convergence check.
+                return Multiplier<ValueType>::multiplyAndReduceAndCheckConvergence(env, dir, rowGroupIndices, x, b, result, precision, relative, choices);
+            }
+            storm::utility::addToProfilerCounter("matrix-vector products", 1);
+            std::vector<ValueType>* target = &result;
+            if (&x == &result) {
+                if (this->cachedVector) {
+                    this->cachedVector->resize(x.size());
+                } else {
+                    this->cachedVector = std::make_unique<std::vector<ValueType>>(x.size());
+                }
+                target = this->cachedVector.get();
+            }
+            bool converged = multAddReduceAndCheckConvergence(dir, rowGroupIndices, x, b, *target, precision, relative, choices);
+            if (&x == &result) {
+                std::swap(result, *this->cachedVector);
+            }
+            return converged;
+        }
+        
+        template<typename ValueType>
+        bool NativeMultiplier<ValueType>::multiplyAndReduceGaussSeidelAndCheckConvergence(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, ValueType const& precision, bool relative, std::vector<uint_fast64_t>* choices) const {
+            storm::utility::addToProfilerCounter("matrix-vector products", 1);
+            return multAddReduceAndCheckConvergence(dir, rowGroupIndices, x, b, x, precision, relative, choices);
+        }
+        
         template<typename ValueType>
         void NativeMultiplier<ValueType>::multiplyRow(uint64_t const& rowIndex, std::vector<ValueType> const& x, ValueType& value) const {
             for (auto const& entry : this->matrix.getRow(rowIndex)) {
@@ -127,6 +165,69 @@ namespace storm {
 #endif
         }
 
+        template<typename ValueType>
+        bool NativeMultiplier<ValueType>::multAddReduceAndCheckConvergence(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, ValueType const& precision, bool relative, std::vector<uint64_t>* choices) const {
+            if (dir == storm::OptimizationDirection::Minimize) {
+                return multAddReduceAndCheckConvergence<storm::utility::ElementLess<ValueType>>(rowGroupIndices, x, b, result, precision, relative, choices);
+            } else {
+                return multAddReduceAndCheckConvergence<storm::utility::ElementGreater<ValueType>>(rowGroupIndices, x, b, result, precision, relative, choices);
+            }
+        }
+        
+        template<typename ValueType>
+        template<typename Compare>
+        bool NativeMultiplier<ValueType>::multAddReduceAndCheckConvergence(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, ValueType const& precision, bool relative, std::vector<uint64_t>* choices) const {
+            Compare compare;
+            bool backwards = &x == &result;
+            bool converged = true;
+            uint64_t const numberOfRowGroups = rowGroupIndices.size() - 1;
+            for (uint64_t i = 0; i < numberOfRowGroups; ++i) {
+                uint64_t const group = backwards ? numberOfRowGroups - 1 - i : i;
+                uint64_t const firstRow = rowGroupIndices[group];
+                uint64_t const endRow = rowGroupIndices[group + 1];
+                
+                // Only multiply and reduce if there is at least one row in the group.
+                if (firstRow == endRow) {
+                    continue;
+                }
+                
+                // Variables for correctly tracking choices (only update if new choice is strictly better).
+                ValueType currentValue;
+                ValueType oldSelectedChoiceValue;
+                uint64_t selectedChoice = 0;
+                for (uint64_t row = firstRow; row < endRow; ++row) {
+                    ValueType rowValue = b ? (*b)[row] : storm::utility::zero<ValueType>();
+                    for (auto const& entry : this->matrix.getRow(row)) {
+                        rowValue += entry.getValue() * x[entry.getColumn()];
+                    }
+                    if (choices && row - firstRow == (*choices)[group]) {
+                        oldSelectedChoiceValue = rowValue;
+                    }
+                    if (row == firstRow || compare(rowValue, currentValue)) {
+                        currentValue = std::move(rowValue);
+                        selectedChoice = row - firstRow;
+                    }
+                }
+                if (choices && compare(currentValue, oldSelectedChoiceValue)) {
+                    (*choices)[group] = selectedChoice;
+                }
+                
+                // Compare with the old value before (potentially) overwriting it.
+                if (converged && !storm::utility::vector::equalModuloPrecision<ValueType>(x[group], currentValue, precision, relative)) {
+                    converged = false;
+                }
+                result[group] = std::move(currentValue);
+            }
+            return converged;
+        }
+        
+#ifdef STORM_HAVE_CARL
+        template<>
+        bool NativeMultiplier<storm::RationalFunction>::multAddReduceAndCheckConvergence(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<storm::RationalFunction> const& x, std::vector<storm::RationalFunction> const* b, std::vector<storm::RationalFunction>& result, storm::RationalFunction const& precision, bool relative, std::vector<uint64_t>* choices) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+        }
+#endif
+        
         template class NativeMultiplier<double>;
 #ifdef STORM_HAVE_CARL
         template class NativeMultiplier<storm::RationalNumber>;
@@ -22,6 +22,8 @@ namespace storm {
             virtual void multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b) const override;
             virtual void multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices = nullptr) const override;
             virtual void multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices = nullptr) const override;
+            virtual bool multiplyAndReduceAndCheckConvergence(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, ValueType const& precision, bool relative, std::vector<uint_fast64_t>* choices = nullptr) const override;
+            virtual bool multiplyAndReduceGaussSeidelAndCheckConvergence(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, ValueType const& precision, bool relative, std::vector<uint_fast64_t>* choices = nullptr) const override;
             virtual void multiplyRow(uint64_t const& rowIndex, std::vector<ValueType> const& x, ValueType& value) const override;
             virtual void multiplyRow2(uint64_t const& rowIndex, std::vector<ValueType> const& x1, ValueType& val1, std::vector<ValueType> const& x2, ValueType& val2) const override;
 
@@ -35,6 +37,17 @@ namespace storm {
             void multAddParallel(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
             void multAddReduceParallel(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices = nullptr) const;
             
+            /*!
+             * Computes the reduced values of all row groups, writes them to the result and compares them with the
+             * values in x in a single sweep. If x and result are the same vector, the sweep is performed in
+             * gauss-seidel style (backwards), otherwise in jacobi style (forwards).
+             *
+             * @return True iff all old and new values are equal modulo the given precision.
+             */
+            bool multAddReduceAndCheckConvergence(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, ValueType const& precision, bool relative, std::vector<uint64_t>* choices) const;
+            template<typename Compare>
+            bool multAddReduceAndCheckConvergence(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, ValueType const& precision, bool relative, std::vector<uint64_t>* choices) const;
+            
         };
         
     }
@@ -14,6 +14,7 @@
 #include "storm/utility/graph.h"
 #include "storm/utility/vector.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/Profiler.h"
 #include "storm/exceptions/InvalidEnvironmentException.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/NotImplementedException.h"
@@ -575,6 +576,7 @@ namespace storm {
         
         template<typename ValueType>
         void StandardGameSolver<ValueType>::reportStatus(Status status, uint64_t iterations) const {
+            storm::utility::addToProfilerCounter("solver iterations", iterations);
             switch (status) {
                 case Status::Converged: STORM_LOG_INFO("Iterative solver converged after " << iterations << " iterations."); break;
                 case Status::TerminatedEarly: STORM_LOG_INFO("Iterative solver terminated early after " << iterations << " iterations."); break;
@@ -69,12 +69,19 @@ namespace storm {
         }
         
         template<storm::dd::DdType DdType, typename ValueType>
-        typename SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::ValueIterationResult SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::performValueIteration(storm::solver::OptimizationDirection const& dir, storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b, ValueType const& precision, bool relativeTerminationCriterion, uint64_t maximalIterations) const {
+        typename SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::ValueIterationResult SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::performValueIteration(storm::solver::OptimizationDirection const& dir, storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b, ValueType const& precision, bool relativeTerminationCriterion, uint64_t maximalIterations, storm::solver::helper::SymbolicValueRounding<DdType, ValueType>* rounding) const {
 
             // Set up local variables.
             storm::dd::Add<DdType, ValueType> localX = x;
             uint64_t iterations = 0;
             
+            // The iterates are rounded until the iteration converges. As the result needs to be independent of the
+            // errors of the roundings, the iteration then continues from the last iterate without rounding. Each
+            // rounding may change the values by at most half of the precision, such that the rounded iterates can
+            // still get closer to each other than the precision.
+            bool roundIterates = rounding && rounding->isActive();
+            ValueType roundingPrecision = precision / storm::utility::convertNumber<ValueType>(2.0);
+            
             // Value iteration loop.
             SolverStatus status = SolverStatus::InProgress;
             while (status == SolverStatus::InProgress && iterations < maximalIterations) {
@@ -92,11 +99,17 @@ namespace storm {
                 
                 // Now check if the process already converged within our precision.
                 if (localX.equalModuloPrecision(tmp, precision, relativeTerminationCriterion)) {
-                    status = SolverStatus::Converged;
+                    if (roundIterates) {
+                        STORM_LOG_TRACE("Value iteration with rounded iterates converged after " << iterations << " iterations, continuing without rounding.");
+                        roundIterates = false;
+                    } else {
+                        status = SolverStatus::Converged;
+                    }
                 }
 
                 // Set up next iteration.
-                localX = tmp;
+                localX = roundIterates ? rounding->round(tmp, roundingPrecision, relativeTerminationCriterion) : tmp;
+                roundIterates = roundIterates && rounding->isActive();
                 ++iterations;
             }
             
@@ -273,13 +286,15 @@ namespace storm {
             }
             
             ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
-            ValueIterationResult viResult = performValueIteration(dir, localX, b, precision, env.solver().minMax().getRelativeTerminationCriterion(), env.solver().minMax().getMaximalNumberOfIterations());
+            storm::solver::helper::SymbolicValueRounding<DdType, ValueType> rounding(env.solver().minMax().getDdRoundingBits(), env.solver().minMax().getDdRoundingGrid());
+            ValueIterationResult viResult = performValueIteration(dir, localX, b, precision, env.solver().minMax().getRelativeTerminationCriterion(), env.solver().minMax().getMaximalNumberOfIterations(), &rounding);
             
             if (viResult.status == SolverStatus::Converged) {
                 STORM_LOG_INFO("Iterative solver (value iteration) converged in " << viResult.iterations << " iterations.");
             } else {
                 STORM_LOG_WARN("Iterative solver (value iteration) did not converge in " << viResult.iterations << " iterations.");
             }
+            STORM_LOG_INFO_COND(rounding.getNumberOfRoundings() == 0, "Rounded " << rounding.getNumberOfRoundings() << " iterates with an error of at most " << rounding.getMaximalError() << " each (the grid was refined " << rounding.getNumberOfRefinements() << " times).");
             
             return viResult.values;
         }
@@ -11,6 +11,7 @@
 #include "storm/solver/SymbolicLinearEquationSolver.h"
 #include "storm/solver/MinMaxLinearEquationSolverRequirements.h"
 #include "storm/solver/SolverStatus.h"
+#include "storm/solver/helper/SymbolicValueRounding.h"
 
 #include "storm/utility/NumberTraits.h"
 
@@ -167,7 +168,12 @@ namespace storm {
                 storm::dd::Add<DdType, ValueType> values;
             };
             
-            ValueIterationResult performValueIteration(storm::solver::OptimizationDirection const& dir, storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b, ValueType const& precision, bool relativeTerminationCriterion, uint64_t maximalIterations) const;
+            /*!
+             * Performs value iteration. If a rounding is given (and active), the iterates are rounded until the iteration
+             * converges. From then on, the iteration continues without rounding until it converges again, so the
+             * result is as precise as without rounding.
+             */
+            ValueIterationResult performValueIteration(storm::solver::OptimizationDirection const& dir, storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b, ValueType const& precision, bool relativeTerminationCriterion, uint64_t maximalIterations, storm::solver::helper::SymbolicValueRounding<DdType, ValueType>* rounding = nullptr) const;
             
         protected:
             // The matrix defining the coefficients of the linear equation system.
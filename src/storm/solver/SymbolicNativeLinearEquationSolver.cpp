@@ -120,25 +120,38 @@ namespace storm {
         }
         
         template<storm::dd::DdType DdType, typename ValueType>
-        typename SymbolicNativeLinearEquationSolver<DdType, ValueType>::PowerIterationResult SymbolicNativeLinearEquationSolver<DdType, ValueType>::performPowerIteration(storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b, ValueType const& precision, bool relativeTerminationCriterion, uint64_t maximalIterations) const {
+        typename SymbolicNativeLinearEquationSolver<DdType, ValueType>::PowerIterationResult SymbolicNativeLinearEquationSolver<DdType, ValueType>::performPowerIteration(storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b, ValueType const& precision, bool relativeTerminationCriterion, uint64_t maximalIterations, storm::solver::helper::SymbolicValueRounding<DdType, ValueType>* rounding) const {
             
             // Set up additional environment variables.
             storm::dd::Add<DdType, ValueType> currentX = x;
             uint_fast64_t iterations = 0;
             SolverStatus status = SolverStatus::InProgress;
             
+            // The iterates are rounded until the iteration converges. As the result needs to be independent of the
+            // errors of the roundings, the iteration then continues from the last iterate without rounding. Each
+            // rounding may change the values by at most half of the precision, such that the rounded iterates can
+            // still get closer to each other than the precision.
+            bool roundIterates = rounding && rounding->isActive();
+            ValueType roundingPrecision = precision / storm::utility::convertNumber<ValueType>(2.0);
+            
             while (status == SolverStatus::InProgress && iterations < maximalIterations) {
                 storm::dd::Add<DdType, ValueType> currentXAsColumn = currentX.swapVariables(this->rowColumnMetaVariablePairs);
                 storm::dd::Add<DdType, ValueType> tmp = this->A.multiplyMatrix(currentXAsColumn, this->columnMetaVariables) + b;
                 
                 // Now check if the process already converged within our precision.
                 if (tmp.equalModuloPrecision(currentX, precision, relativeTerminationCriterion)) {
-                    status = SolverStatus::Converged;
+                    if (roundIterates) {
+                        STORM_LOG_TRACE("Power iteration with rounded iterates converged after " << iterations << " iterations, continuing without rounding.");
+                        roundIterates = false;
+                    } else {
+                        status = SolverStatus::Converged;
+                    }
                 }
                 
                 // Set up next iteration.
                 ++iterations;
-                currentX = tmp;
+                currentX = roundIterates ? rounding->round(tmp, roundingPrecision, relativeTerminationCriterion) : tmp;
+                roundIterates = roundIterates && rounding->isActive();
             }
 
             return PowerIterationResult(status, iterations, currentX);
@@ -148,13 +161,15 @@ namespace storm {
         storm::dd::Add<DdType, ValueType> SymbolicNativeLinearEquationSolver<DdType, ValueType>::solveEquationsPower(Environment const& env, storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b) const {
             STORM_LOG_INFO("Solving symbolic linear equation system with NativeLinearEquationSolver (power)");
             ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
-            PowerIterationResult result = performPowerIteration(x, b, precision, env.solver().native().getRelativeTerminationCriterion(), env.solver().native().getMaximalNumberOfIterations());
+            storm::solver::helper::SymbolicValueRounding<DdType, ValueType> rounding(env.solver().native().getDdRoundingBits(), env.solver().native().getDdRoundingGrid());
+            PowerIterationResult result = performPowerIteration(x, b, precision, env.solver().native().getRelativeTerminationCriterion(), env.solver().native().getMaximalNumberOfIterations(), &rounding);
             
             if (result.status == SolverStatus::Converged) {
                 STORM_LOG_INFO("Iterative solver (power iteration) converged in " << result.iterations << " iterations.");
             } else {
                 STORM_LOG_WARN("Iterative solver (power iteration) did not converge in " << result.iterations << " iterations.");
             }
+            STORM_LOG_INFO_COND(rounding.getNumberOfRoundings() == 0, "Rounded " << rounding.getNumberOfRoundings() << " iterates with an error of at most " << rounding.getMaximalError() << " each (the grid was refined " << rounding.getNumberOfRefinements() << " times).");
             
             return result.values;
         }
@@ -3,6 +3,7 @@
 #include "storm/solver/SymbolicLinearEquationSolver.h"
 #include "storm/solver/SolverStatus.h"
 #include "storm/solver/SolverSelectionOptions.h"
+#include "storm/solver/helper/SymbolicValueRounding.h"
 
 #include "storm/utility/NumberTraits.h"
 
@@ -101,7 +102,12 @@ namespace storm {
                 storm::dd::Add<DdType, ValueType> values;
             };
             
-            PowerIterationResult performPowerIteration(storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b, ValueType const& precision, bool relativeTerminationCriterion, uint64_t maximalIterations) const;
+            /*!
+             * Performs power iteration. If a rounding is given (and active), the iterates are rounded until the iteration
+             * converges. From then on, the iteration continues without rounding until it converges again, so the
+             * result is as precise as without rounding.
+             */
+            PowerIterationResult performPowerIteration(storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b, ValueType const& precision, bool relativeTerminationCriterion, uint64_t maximalIterations, storm::solver::helper::SymbolicValueRounding<DdType, ValueType>* rounding = nullptr) const;
 
         };
         
@@ -45,8 +45,11 @@ namespace storm {
             STORM_LOG_ASSERT(x.size() == this->A->getRowGroupCount(), "Provided x-vector has invalid size.");
             STORM_LOG_ASSERT(b.size() == this->A->getRowCount(), "Provided b-vector has invalid size.");
             
+            // With adaptive precision, the precision of each SCC is derived from the SCC graph (see below).
+            bool adaptivePrecision = env.solver().topological().isAdaptivePrecisionSet();
+            
             // For sound computations we need to increase the precision in each SCC
-            bool needAdaptPrecision = env.solver().isForceSoundness();
+            bool needAdaptPrecision = env.solver().isForceSoundness() && !adaptivePrecision;
             
             if (!this->sortedSccDecomposition || (needAdaptPrecision && !this->longestSccChainSize)) {
                 STORM_LOG_TRACE("Creating SCC decomposition.");
@@ -75,9 +78,22 @@ namespace storm {
                         this->schedulerChoices = std::vector<uint64_t>(x.size());
                     }
                 }
+                
+                storm::storage::BitVector relevantSccs;
+                std::vector<uint64_t> sccChainLengths;
+                storm::RationalNumber globalPrecision = sccSolverEnvironment.solver().minMax().getPrecision();
+                if (adaptivePrecision) {
+                    relevantSccs = computeRelevantSccsAndChainLengths(sccChainLengths);
+                    STORM_LOG_INFO("Skipping " << (relevantSccs.size() - relevantSccs.getNumberOfSetBits()) << " SCC(s) that do not influence the relevant values.");
+                }
+                
                 storm::storage::BitVector sccRowGroupsAsBitVector(x.size(), false);
                 storm::storage::BitVector sccRowsAsBitVector(b.size(), false);
-                for (auto const& scc : *this->sortedSccDecomposition) {
+                for (uint64_t sccIndex = 0; sccIndex < this->sortedSccDecomposition->size(); ++sccIndex) {
+                    if (adaptivePrecision && !relevantSccs.get(sccIndex)) {
+                        continue;
+                    }
+                    auto const& scc = (*this->sortedSccDecomposition)[sccIndex];
                     if (scc.size() == 1) {
                         returnValue = solveTrivialScc(*scc.begin(), dir, x, b) && returnValue;
                     } else {
@@ -89,6 +105,9 @@ namespace storm {
                                 sccRowsAsBitVector.set(row, true);
                             }
                         }
+                        if (adaptivePrecision) {
+                            sccSolverEnvironment.solver().minMax().setPrecision(globalPrecision / storm::utility::convertNumber<storm::RationalNumber>(sccChainLengths[sccIndex]));
+                        }
                         returnValue = solveScc(sccSolverEnvironment, dir, sccRowGroupsAsBitVector, sccRowsAsBitVector, x, b) && returnValue;
                     }
                 }
@@ -119,6 +138,75 @@ namespace storm {
             }
         }
         
+        template<typename ValueType>
+        storm::storage::BitVector TopologicalMinMaxLinearEquationSolver<ValueType>::computeRelevantSccsAndChainLengths(std::vector<uint64_t>& sccChainLengths) const {
+            auto const& sccs = *this->sortedSccDecomposition;
+            uint64_t numberOfSccs = sccs.size();
+            
+            // If no relevant values are given or the scheduler is requested, all SCCs need to be solved.
+            storm::storage::BitVector relevantSccs(numberOfSccs, !this->hasRelevantValues() || this->isTrackSchedulerSet());
+            std::vector<uint64_t> stateToScc(this->A->getRowGroupCount());
+            for (uint64_t sccIndex = 0; sccIndex < numberOfSccs; ++sccIndex) {
+                for (auto const& state : sccs[sccIndex]) {
+                    stateToScc[state] = sccIndex;
+                }
+            }
+            if (this->hasRelevantValues()) {
+                for (auto const& state : this->getRelevantValues()) {
+                    relevantSccs.set(stateToScc[state], true);
+                }
+            }
+            
+            // Only non-trivial SCCs are solved approximately, trivial ones do not contribute to the error.
+            auto errorSccCount = [&sccs] (uint64_t sccIndex) -> uint64_t { return sccs[sccIndex].size() > 1 ? 1 : 0; };
+            
+            // Since the SCCs are sorted topologically, successors of an SCC always have a smaller index. Hence, going
+            // through the SCCs backwards, we can propagate relevance and compute the longest chain of relevant SCCs
+            // leading to each SCC.
+            std::vector<uint64_t> chainAbove(numberOfSccs);
+            for (uint64_t sccIndex = 0; sccIndex < numberOfSccs; ++sccIndex) {
+                chainAbove[sccIndex] = errorSccCount(sccIndex);
+            }
+            for (uint64_t sccIndex = numberOfSccs; sccIndex > 0;) {
+                --sccIndex;
+                if (!relevantSccs.get(sccIndex)) {
+                    continue;
+                }
+                for (auto const& state : sccs[sccIndex]) {
+                    for (auto const& entry : this->A->getRowGroup(state)) {
+                        uint64_t successorScc = stateToScc[entry.getColumn()];
+                        if (successorScc != sccIndex) {
+                            STORM_LOG_ASSERT(successorScc < sccIndex, "SCCs are not sorted topologically.");
+                            relevantSccs.set(successorScc, true);
+                            chainAbove[successorScc] = std::max(chainAbove[successorScc], chainAbove[sccIndex] + errorSccCount(successorScc));
+                        }
+                    }
+                }
+            }
+            
+            // Going forward, we compute the longest chain of SCCs starting in each relevant SCC. The error of a
+            // relevant value is at most the sum of the errors of the SCCs on a chain below it. As every SCC on a chain
+            // is assigned a fraction of the precision that is at most one over the length of that chain, the errors
+            // sum up to at most the global precision.
+            std::vector<uint64_t> chainBelow(numberOfSccs, 0);
+            sccChainLengths.assign(numberOfSccs, 1);
+            for (auto const& sccIndex : relevantSccs) {
+                uint64_t longestSuccessorChain = 0;
+                for (auto const& state : sccs[sccIndex]) {
+                    for (auto const& entry : this->A->getRowGroup(state)) {
+                        uint64_t successorScc = stateToScc[entry.getColumn()];
+                        if (successorScc != sccIndex) {
+                            longestSuccessorChain = std::max(longestSuccessorChain, chainBelow[successorScc]);
+                        }
+                    }
+                }
+                chainBelow[sccIndex] = longestSuccessorChain + errorSccCount(sccIndex);
+                sccChainLengths[sccIndex] = std::max<uint64_t>(1, chainAbove[sccIndex] + longestSuccessorChain);
+            }
+            
+            return relevantSccs;
+        }
+        
         template<typename ValueType>
         bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveTrivialScc(uint64_t const& sccState, OptimizationDirection dir, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const {
             ValueType& xi = globalX[sccState];
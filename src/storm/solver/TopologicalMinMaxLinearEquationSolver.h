@@ -35,6 +35,10 @@ namespace storm {
             // Creates an SCC decomposition and sorts the SCCs according to a topological sort.
             void createSortedSccDecomposition(bool needLongestChainSize) const;
 
+            // Computes the SCCs that influence the relevant values. For each of them, the length of the longest chain
+            // of relevant non-trivial SCCs through it is stored in the given vector.
+            storm::storage::BitVector computeRelevantSccsAndChainLengths(std::vector<uint64_t>& sccChainLengths) const;
+
             // Solves the SCC with the given index
             // ... for the case that the SCC is trivial
             bool solveTrivialScc(uint64_t const& sccState, OptimizationDirection d, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const;
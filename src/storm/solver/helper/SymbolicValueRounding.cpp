@@ -0,0 +1,124 @@
+#include "storm/solver/helper/SymbolicValueRounding.h"
+
+#include <cmath>
+#include <limits>
+
+#include "storm/storage/dd/DdManager.h"
+#include "storm/storage/dd/Add.h"
+#include "storm/storage/dd/Bdd.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/NumberTraits.h"
+
+namespace storm {
+    namespace solver {
+        namespace helper {
+
+            template<storm::dd::DdType DdType, typename ValueType>
+            SymbolicValueRounding<DdType, ValueType>::SymbolicValueRounding(boost::optional<uint64_t> const& significantBits, boost::optional<storm::RationalNumber> const& gridWidth) : active(false), significantBits(significantBits), maximalError(storm::utility::zero<ValueType>()), roundings(0), refinements(0) {
+                if (gridWidth) {
+                    STORM_LOG_WARN_COND(!significantBits, "Rounding symbolic values to both a number of significant bits and a grid was requested, using the grid.");
+                    this->gridWidth = storm::utility::convertNumber<ValueType>(gridWidth.get());
+                }
+                if (significantBits || gridWidth) {
+                    STORM_LOG_WARN_COND(!storm::NumberTraits<ValueType>::IsExact, "Rounding symbolic values is only supported for floating point values, ignoring.");
+                    active = !storm::NumberTraits<ValueType>::IsExact;
+                }
+            }
+
+            template<storm::dd::DdType DdType, typename ValueType>
+            bool SymbolicValueRounding<DdType, ValueType>::isActive() const {
+                return active;
+            }
+
+            template<storm::dd::DdType DdType, typename ValueType>
+            storm::dd::Add<DdType, ValueType> SymbolicValueRounding<DdType, ValueType>::round(storm::dd::Add<DdType, ValueType> const& values, ValueType const& precision, bool relative) {
+                if (!active) {
+                    return values;
+                }
+
+                ValueType maximalMagnitude = storm::utility::max<ValueType>(values.getMax(), -values.getMin());
+                if (storm::utility::isZero(maximalMagnitude) || storm::utility::isInfinity(maximalMagnitude)) {
+                    return values;
+                }
+
+                storm::dd::DdManager<DdType> const& manager = values.getDdManager();
+                storm::dd::Add<DdType, ValueType> half = manager.getConstant(storm::utility::convertNumber<ValueType>(0.5));
+                while (true) {
+                    ValueType width = getGridWidth(maximalMagnitude);
+
+                    // Grids that are finer than the precision of the values do not change the values anymore.
+                    if (storm::utility::convertNumber<double>(maximalMagnitude / width) > std::ldexp(1.0, std::numeric_limits<double>::digits)) {
+                        STORM_LOG_WARN("No grid is fine enough to round the symbolic values with precision " << precision << ", disabling rounding.");
+                        active = false;
+                        return values;
+                    }
+
+                    storm::dd::Add<DdType, ValueType> rounded = ((values * manager.getConstant(storm::utility::one<ValueType>() / width)) + half).floor() * manager.getConstant(width);
+                    if (rounded.equalModuloPrecision(values, precision, relative)) {
+                        maximalError = storm::utility::max<ValueType>(maximalError, getError(rounded, values, relative));
+                        ++roundings;
+                        return rounded;
+                    }
+
+                    refine();
+                    STORM_LOG_TRACE("Refined the grid for rounding symbolic values to width " << getGridWidth(maximalMagnitude) << ".");
+                }
+            }
+
+            template<storm::dd::DdType DdType, typename ValueType>
+            ValueType const& SymbolicValueRounding<DdType, ValueType>::getMaximalError() const {
+                return maximalError;
+            }
+
+            template<storm::dd::DdType DdType, typename ValueType>
+            uint64_t SymbolicValueRounding<DdType, ValueType>::getNumberOfRoundings() const {
+                return roundings;
+            }
+
+            template<storm::dd::DdType DdType, typename ValueType>
+            uint64_t SymbolicValueRounding<DdType, ValueType>::getNumberOfRefinements() const {
+                return refinements;
+            }
+
+            template<storm::dd::DdType DdType, typename ValueType>
+            ValueType SymbolicValueRounding<DdType, ValueType>::getGridWidth(ValueType const& maximalMagnitude) const {
+                if (gridWidth) {
+                    return gridWidth.get();
+                }
+
+                // The width is the power of two that leaves the given number of significant bits for the value of
+                // largest magnitude. Powers of two keep the scaling during the rounding exact.
+                int exponent;
+                std::frexp(storm::utility::convertNumber<double>(maximalMagnitude), &exponent);
+                return storm::utility::convertNumber<ValueType>(std::ldexp(1.0, exponent - static_cast<int>(significantBits.get())));
+            }
+
+            template<storm::dd::DdType DdType, typename ValueType>
+            ValueType SymbolicValueRounding<DdType, ValueType>::getError(storm::dd::Add<DdType, ValueType> const& rounded, storm::dd::Add<DdType, ValueType> const& values, bool relative) const {
+                storm::dd::Add<DdType, ValueType> difference = rounded - values;
+                if (relative) {
+                    // Zero values are rounded to zero, so they do not contribute to the error.
+                    difference = values.notZero().ite(difference / values, values.getDdManager().template getAddZero<ValueType>());
+                }
+                return storm::utility::max<ValueType>(difference.getMax(), -difference.getMin());
+            }
+
+            template<storm::dd::DdType DdType, typename ValueType>
+            void SymbolicValueRounding<DdType, ValueType>::refine() {
+                if (gridWidth) {
+                    gridWidth.get() /= storm::utility::convertNumber<ValueType>(2.0);
+                } else {
+                    ++significantBits.get();
+                }
+                ++refinements;
+            }
+
+            template class SymbolicValueRounding<storm::dd::DdType::CUDD, double>;
+            template class SymbolicValueRounding<storm::dd::DdType::CUDD, storm::RationalNumber>;
+            template class SymbolicValueRounding<storm::dd::DdType::Sylvan, double>;
+            template class SymbolicValueRounding<storm::dd::DdType::Sylvan, storm::RationalNumber>;
+        }
+    }
+}
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <boost/optional.hpp>
+
+#include "storm/storage/dd/DdType.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+
+namespace storm {
+
+    namespace dd {
+        template<storm::dd::DdType LibraryType, typename ValueType>
+        class Add;
+    }
+
+    namespace solver {
+        namespace helper {
+
+            /*!
+             * Rounds the intermediate value ADDs of symbolic value iteration to a grid. This bounds the number of
+             * distinct values and thereby the number of leaves of the ADD. The grid is refined whenever a single
+             * rounding would introduce an error beyond the given bound. The errors of the roundings are not accounted
+             * for in the result, so the iteration needs to continue without rounding once it converged.
+             */
+            template<storm::dd::DdType DdType, typename ValueType>
+            class SymbolicValueRounding {
+            public:
+                /*!
+                 * Creates a rounding to the given grid. If a width is given, values are rounded to multiples of it.
+                 * Otherwise, if a number of bits is given, values are rounded to this many significant bits relative
+                 * to the value of largest magnitude. If neither is given, the rounding is inactive. Since the rounding
+                 * is meant to reduce the size of ADDs over floating point values, it is also inactive for exact value
+                 * types.
+                 *
+                 * @param significantBits If given, the number of significant bits to which values are rounded.
+                 * @param gridWidth If given, the width of the grid to which values are rounded.
+                 */
+                SymbolicValueRounding(boost::optional<uint64_t> const& significantBits, boost::optional<storm::RationalNumber> const& gridWidth);
+
+                /*!
+                 * Retrieves whether the values are actually rounded.
+                 */
+                bool isActive() const;
+
+                /*!
+                 * Rounds the given values to the grid. If this would change the values by more than the given
+                 * precision, the grid is refined first. If no grid is fine enough, the rounding is deactivated and the
+                 * values are returned as is.
+                 *
+                 * @param values The values to round.
+                 * @param precision The precision up to which the rounded values need to be equal to the given ones.
+                 * @param relative Whether the precision is relative.
+                 * @return The rounded values.
+                 */
+                storm::dd::Add<DdType, ValueType> round(storm::dd::Add<DdType, ValueType> const& values, ValueType const& precision, bool relative);
+
+                /*!
+                 * Retrieves the largest error introduced by a single rounding so far.
+                 */
+                ValueType const& getMaximalError() const;
+
+                /*!
+                 * Retrieves how many values were rounded so far.
+                 */
+                uint64_t getNumberOfRoundings() const;
+
+                /*!
+                 * Retrieves how often the grid was refined so far.
+                 */
+                uint64_t getNumberOfRefinements() const;
+
+            private:
+                /*!
+                 * Retrieves the width of the current grid for values whose largest magnitude is the given one.
+                 */
+                ValueType getGridWidth(ValueType const& maximalMagnitude) const;
+
+                /*!
+                 * Retrieves the largest (absolute or relative) difference between the rounded and the given values.
+                 */
+                ValueType getError(storm::dd::Add<DdType, ValueType> const& rounded, storm::dd::Add<DdType, ValueType> const& values, bool relative) const;
+
+                /*!
+                 * Refines the current grid by halving its width.
+                 */
+                void refine();
+
+                // Whether the values are actually rounded.
+                bool active;
+
+                // If set, the number of significant bits to which values are rounded.
+                boost::optional<uint64_t> significantBits;
+
+                // If set, the width of the grid to which values are rounded.
+                boost::optional<ValueType> gridWidth;
+
+                // The largest error introduced by a single rounding.
+                ValueType maximalError;
+
+                // The number of times values were rounded.
+                uint64_t roundings;
+
+                // The number of times the grid was refined.
+                uint64_t refinements;
+            };
+
+        }
+    }
+}
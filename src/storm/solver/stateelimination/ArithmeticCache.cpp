@@ -0,0 +1,141 @@
+#include "storm/solver/stateelimination/ArithmeticCache.h"
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm/utility/constants.h"
+
+namespace storm {
+    namespace solver {
+        namespace stateelimination {
+            
+            template<typename ValueType>
+            ArithmeticCache<ValueType>::ArithmeticCache(uint64_t maximalSize) : maximalSize(maximalSize), hits(0), misses(0) {
+                // Intentionally left empty.
+            }
+            
+            template<typename ValueType>
+            ValueType ArithmeticCache<ValueType>::multiply(ValueType const& first, ValueType const& second) {
+                return storm::utility::simplify((ValueType) (first * second));
+            }
+            
+            template<typename ValueType>
+            ValueType ArithmeticCache<ValueType>::add(ValueType const& first, ValueType const& second) {
+                return storm::utility::simplify((ValueType) (first + second));
+            }
+            
+            template<typename ValueType>
+            ValueType ArithmeticCache<ValueType>::simplify(ValueType const& value) {
+                return storm::utility::simplify(value);
+            }
+            
+            template<typename ValueType>
+            void ArithmeticCache<ValueType>::clear() {
+                std::lock_guard<std::mutex> lock(mutex);
+                products.clear();
+                sums.clear();
+                simplifications.clear();
+            }
+            
+            template<typename ValueType>
+            uint64_t ArithmeticCache<ValueType>::getNumberOfEntries() const {
+                std::lock_guard<std::mutex> lock(mutex);
+                return products.size() + sums.size() + simplifications.size();
+            }
+            
+            template<typename ValueType>
+            uint64_t ArithmeticCache<ValueType>::getNumberOfHits() const {
+                std::lock_guard<std::mutex> lock(mutex);
+                return hits;
+            }
+            
+            template<typename ValueType>
+            uint64_t ArithmeticCache<ValueType>::getNumberOfMisses() const {
+                std::lock_guard<std::mutex> lock(mutex);
+                return misses;
+            }
+            
+            template<typename ValueType>
+            template<typename OperationType>
+            ValueType ArithmeticCache<ValueType>::lookupOrCompute(BinaryOperationTable& table, ValueType const& first, ValueType const& second, OperationType const& operation) {
+                if (maximalSize == 0) {
+                    return operation(first, second);
+                }
+                
+                // As both operations are commutative, we order the operands to increase the number of hits.
+                std::size_t firstHash = std::hash<ValueType>()(first);
+                std::size_t secondHash = std::hash<ValueType>()(second);
+                std::pair<ValueType, ValueType> key = firstHash <= secondHash ? std::make_pair(first, second) : std::make_pair(second, first);
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    auto findIt = table.find(key);
+                    if (findIt != table.end()) {
+                        ++hits;
+                        return findIt->second;
+                    }
+                }
+                
+                // Compute the result without holding the lock, so other threads can use the cache in the meantime.
+                ValueType result = operation(first, second);
+                
+                std::lock_guard<std::mutex> lock(mutex);
+                ++misses;
+                if (table.size() >= maximalSize) {
+                    table.clear();
+                }
+                table.emplace(std::move(key), result);
+                return result;
+            }
+            
+#ifdef STORM_HAVE_CARL
+            template<>
+            storm::RationalFunction ArithmeticCache<storm::RationalFunction>::multiply(storm::RationalFunction const& first, storm::RationalFunction const& second) {
+                if (storm::utility::isConstant(first) || storm::utility::isConstant(second)) {
+                    // Operations with constants do not involve gcd computations and are not worth caching.
+                    return storm::utility::simplify((storm::RationalFunction) (first * second));
+                }
+                return lookupOrCompute(products, first, second, [] (storm::RationalFunction const& a, storm::RationalFunction const& b) { return storm::utility::simplify((storm::RationalFunction) (a * b)); });
+            }
+            
+            template<>
+            storm::RationalFunction ArithmeticCache<storm::RationalFunction>::add(storm::RationalFunction const& first, storm::RationalFunction const& second) {
+                if (storm::utility::isConstant(first) && storm::utility::isConstant(second)) {
+                    return storm::utility::simplify((storm::RationalFunction) (first + second));
+                }
+                return lookupOrCompute(sums, first, second, [] (storm::RationalFunction const& a, storm::RationalFunction const& b) { return storm::utility::simplify((storm::RationalFunction) (a + b)); });
+            }
+            
+            template<>
+            storm::RationalFunction ArithmeticCache<storm::RationalFunction>::simplify(storm::RationalFunction const& value) {
+                if (maximalSize == 0 || storm::utility::isConstant(value)) {
+                    return storm::utility::simplify(value);
+                }
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    auto findIt = simplifications.find(value);
+                    if (findIt != simplifications.end()) {
+                        ++hits;
+                        return findIt->second;
+                    }
+                }
+                
+                storm::RationalFunction result = storm::utility::simplify(value);
+                
+                std::lock_guard<std::mutex> lock(mutex);
+                ++misses;
+                if (simplifications.size() >= maximalSize) {
+                    simplifications.clear();
+                }
+                simplifications.emplace(value, result);
+                return result;
+            }
+#endif
+            
+            template class ArithmeticCache<double>;
+            
+#ifdef STORM_HAVE_CARL
+            template class ArithmeticCache<storm::RationalNumber>;
+            template class ArithmeticCache<storm::RationalFunction>;
+#endif
+        } // namespace stateelimination
+    } // namespace storage
+} // namespace storm
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+namespace storm {
+    namespace solver {
+        namespace stateelimination {
+            
+            /*!
+             * Memoizes the (simplified) results of the products and sums computed during state elimination. For rational
+             * functions, every such operation involves a costly gcd computation and the same operations recur frequently,
+             * in particular on models with symmetric structure. Since the polynomials of rational functions are already
+             * hash-consed by carl, looking up a function is cheap. For all other value types, the results are computed
+             * directly.
+             *
+             * Every table is cleared as soon as it exceeds the maximal size. All operations may be invoked concurrently.
+             */
+            template<typename ValueType>
+            class ArithmeticCache {
+            public:
+                /*!
+                 * Creates a cache whose tables hold at most the given number of entries. A maximal size of zero disables
+                 * the cache.
+                 */
+                ArithmeticCache(uint64_t maximalSize);
+                
+                /*!
+                 * Retrieves the simplified product of the two values.
+                 */
+                ValueType multiply(ValueType const& first, ValueType const& second);
+                
+                /*!
+                 * Retrieves the simplified sum of the two values.
+                 */
+                ValueType add(ValueType const& first, ValueType const& second);
+                
+                /*!
+                 * Retrieves the simplified version of the given value.
+                 */
+                ValueType simplify(ValueType const& value);
+                
+                /*!
+                 * Removes all entries from the cache.
+                 */
+                void clear();
+                
+                /*!
+                 * Retrieves the number of entries currently stored in all tables of the cache.
+                 */
+                uint64_t getNumberOfEntries() const;
+                
+                /*!
+                 * Retrieves the number of operations whose result was found in the cache.
+                 */
+                uint64_t getNumberOfHits() const;
+                
+                /*!
+                 * Retrieves the number of operations whose result was computed and stored in the cache.
+                 */
+                uint64_t getNumberOfMisses() const;
+                
+            private:
+                struct PairHash {
+                    std::size_t operator()(std::pair<ValueType, ValueType> const& pair) const {
+                        std::size_t seed = std::hash<ValueType>()(pair.first);
+                        return seed ^ (std::hash<ValueType>()(pair.second) + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+                    }
+                };
+                typedef std::unordered_map<std::pair<ValueType, ValueType>, ValueType, PairHash> BinaryOperationTable;
+                typedef std::unordered_map<ValueType, ValueType> UnaryOperationTable;
+                
+                /*!
+                 * Looks up the result of the given operation on the (unordered) operands and computes and stores it if
+                 * it is not yet known.
+                 */
+                template<typename OperationType>
+                ValueType lookupOrCompute(BinaryOperationTable& table, ValueType const& first, ValueType const& second, OperationType const& operation);
+                
+                // The maximal number of entries of each table.
+                uint64_t maximalSize;
+                
+                // The tables storing the results of the operations.
+                BinaryOperationTable products;
+                BinaryOperationTable sums;
+                UnaryOperationTable simplifications;
+                
+                // The number of lookups that found and did not find the result, respectively.
+                uint64_t hits;
+                uint64_t misses;
+                
+                // A mutex guarding the tables and the statistics.
+                mutable std::mutex mutex;
+            };
+            
+        } // namespace stateelimination
+    } // namespace storage
+} // namespace storm
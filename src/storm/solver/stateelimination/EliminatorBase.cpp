@@ -4,6 +4,9 @@
 #include "storm/utility/macros.h"
 #include "storm/utility/constants.h"
 
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/EliminationSettings.h"
+
 #include "storm/exceptions/InvalidStateException.h"
 
 namespace storm {
@@ -13,7 +16,7 @@ namespace storm {
             using namespace storm::utility::stateelimination;
 
             template<typename ValueType, ScalingMode Mode>
-            EliminatorBase<ValueType, Mode>::EliminatorBase(storm::storage::FlexibleSparseMatrix<ValueType>& matrix, storm::storage::FlexibleSparseMatrix<ValueType>& transposedMatrix) : matrix(matrix), transposedMatrix(transposedMatrix) {
+            EliminatorBase<ValueType, Mode>::EliminatorBase(storm::storage::FlexibleSparseMatrix<ValueType>& matrix, storm::storage::FlexibleSparseMatrix<ValueType>& transposedMatrix) : matrix(matrix), transposedMatrix(transposedMatrix), arithmeticCache(storm::settings::getModule<storm::settings::modules::EliminationSettings>().getArithmeticCacheSize()) {
                 // Intentionally left empty.
             }
             
@@ -50,7 +53,7 @@ namespace storm {
                     if (hasEntryInColumn) {
                         STORM_LOG_ASSERT(columnValue != storm::utility::one<ValueType>(), "The scaling mode 'divide-one-minus' requires a non-one value in the given column.");
                         columnValue = storm::utility::one<ValueType>() / (storm::utility::one<ValueType>() - columnValue);
-                        columnValue = storm::utility::simplify(columnValue);
+                        columnValue = arithmeticCache.simplify(columnValue);
                     }
                 }
                 
@@ -58,7 +61,7 @@ namespace storm {
                     for (auto entryIt = entriesInRow.begin(), entryIte = entriesInRow.end(); entryIt != entryIte; ++entryIt) {
                         // Only scale the entries in a different column.
                         if (entryIt->getColumn() != column) {
-                            entryIt->setValue(storm::utility::simplify((ValueType) (entryIt->getValue() * columnValue)));
+                            entryIt->setValue(arithmeticCache.multiply(entryIt->getValue(), columnValue));
                         }
                     }
                     updateValue(row, columnValue);
@@ -137,7 +140,7 @@ namespace storm {
                             break;
                         }
                         if (first2->getColumn() < first1->getColumn()) {
-                            auto successorEntry = storm::utility::simplify(std::move(*first2 * multiplyFactor));
+                            storm::storage::MatrixEntry<typename storm::storage::FlexibleSparseMatrix<ValueType>::index_type, typename storm::storage::FlexibleSparseMatrix<ValueType>::value_type> successorEntry(first2->getColumn(), arithmeticCache.multiply(first2->getValue(), multiplyFactor));
                             *result = successorEntry;
                             newBackwardEntries[successorOffsetInNewBackwardTransitions].emplace_back(predecessor, successorEntry.getValue());
                             ++first2;
@@ -146,9 +149,7 @@ namespace storm {
                             *result = *first1;
                             ++first1;
                         } else {
-                            ValueType sprod = multiplyFactor * first2->getValue();
-                            ValueType sum = first1->getValue() + storm::utility::simplify(sprod);
-                            auto probability = storm::utility::simplify(sum);
+                            ValueType probability = arithmeticCache.add(first1->getValue(), arithmeticCache.multiply(multiplyFactor, first2->getValue()));
                             *result = storm::storage::MatrixEntry<typename storm::storage::FlexibleSparseMatrix<ValueType>::index_type, typename storm::storage::FlexibleSparseMatrix<ValueType>::value_type>(first1->getColumn(), probability);
                             newBackwardEntries[successorOffsetInNewBackwardTransitions].emplace_back(predecessor, probability);
                             ++first1;
@@ -158,7 +159,7 @@ namespace storm {
                     }
                     for (; first2 != last2; ++first2) {
                         if (first2->getColumn() != column) {
-                            auto stateProbability = storm::utility::simplify(std::move(*first2 * multiplyFactor));
+                            storm::storage::MatrixEntry<typename storm::storage::FlexibleSparseMatrix<ValueType>::index_type, typename storm::storage::FlexibleSparseMatrix<ValueType>::value_type> stateProbability(first2->getColumn(), arithmeticCache.multiply(first2->getValue(), multiplyFactor));
                             *result = stateProbability;
                             newBackwardEntries[successorOffsetInNewBackwardTransitions].emplace_back(predecessor, stateProbability.getValue());
                             ++successorOffsetInNewBackwardTransitions;
@@ -4,6 +4,8 @@
 
 #include "storm/storage/FlexibleSparseMatrix.h"
 
+#include "storm/solver/stateelimination/ArithmeticCache.h"
+
 namespace storm {
     namespace solver {
         namespace stateelimination {
@@ -33,6 +35,9 @@ namespace storm {
             protected:
                 storm::storage::FlexibleSparseMatrix<ValueType>& matrix;
                 storm::storage::FlexibleSparseMatrix<ValueType>& transposedMatrix;
+                
+                // A cache for the products and sums computed during the elimination.
+                ArithmeticCache<ValueType> arithmeticCache;
             };
             
         } // namespace stateelimination
@@ -1,10 +1,19 @@
 #include "storm/solver/stateelimination/PrioritizedStateEliminator.h"
 
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <type_traits>
+
 #include "storm/solver/stateelimination/StatePriorityQueue.h"
 
 #include "storm/utility/macros.h"
 #include "storm/utility/constants.h"
 
+#include "storm/storage/BitVector.h"
+
+#include "storm/exceptions/NotSupportedException.h"
+
 #include "StaticStatePriorityQueue.h"
 
 namespace storm {
@@ -22,17 +31,22 @@ namespace storm {
             
             template<typename ValueType>
             void PrioritizedStateEliminator<ValueType>::updateValue(storm::storage::sparse::state_type const& state, ValueType const& loopProbability) {
-                stateValues[state] = storm::utility::simplify((ValueType) (loopProbability * stateValues[state]));
+                stateValues[state] = this->arithmeticCache.multiply(loopProbability, stateValues[state]);
             }
        
             template<typename ValueType>
             void PrioritizedStateEliminator<ValueType>::updatePredecessor(storm::storage::sparse::state_type const& predecessor, ValueType const& probability, storm::storage::sparse::state_type const& state) {
-                stateValues[predecessor] = storm::utility::simplify((ValueType) (stateValues[predecessor] + storm::utility::simplify((ValueType) (probability * stateValues[state]))));
+                stateValues[predecessor] = this->arithmeticCache.add(stateValues[predecessor], this->arithmeticCache.multiply(probability, stateValues[state]));
             }
             
             template<typename ValueType>
             void PrioritizedStateEliminator<ValueType>::updatePriority(storm::storage::sparse::state_type const& state) {
-                priorityQueue->update(state);
+                if (deferPriorityUpdates) {
+                    std::lock_guard<std::mutex> lock(deferredPriorityUpdatesMutex);
+                    deferredPriorityUpdates.push_back(state);
+                } else {
+                    priorityQueue->update(state);
+                }
             }
 
             template<typename ValueType>
@@ -46,11 +60,137 @@ namespace storm {
                 }
             }
 
+            template<typename ValueType>
+            void PrioritizedStateEliminator<ValueType>::eliminateAllInParallel(uint64_t numberOfThreads, std::function<bool(storm::storage::sparse::state_type const&)> const& removeForwardTransitions) {
+                STORM_LOG_THROW(this->matrix.hasTrivialRowGrouping(), storm::exceptions::NotSupportedException, "Parallel state elimination requires a matrix with trivial row grouping.");
+                numberOfThreads = getNumberOfEliminationThreads(numberOfThreads);
+                if (numberOfThreads <= 1) {
+                    while (priorityQueue->hasNext()) {
+                        storm::storage::sparse::state_type state = priorityQueue->pop();
+                        bool removeForward = removeForwardTransitions(state);
+                        this->eliminateState(state, removeForward);
+                        if (removeForward) {
+                            clearStateValues(state);
+                        }
+                    }
+                    return;
+                }
+                
+                // The number of states that are considered for a batch. Looking further ahead than the number of threads
+                // gives a better chance to find enough states with disjoint neighbourhoods, but deviates more from the
+                // order given by the priorities.
+                uint64_t const candidateWindowSize = 8 * numberOfThreads;
+                
+                std::vector<storm::storage::sparse::state_type> candidates;
+                std::vector<storm::storage::sparse::state_type> postponedCandidates;
+                std::vector<storm::storage::sparse::state_type> batch;
+                storm::storage::BitVector markedStates(this->transposedMatrix.getRowCount());
+                
+                while (!candidates.empty() || priorityQueue->hasNext()) {
+                    while (candidates.size() < candidateWindowSize && priorityQueue->hasNext()) {
+                        candidates.push_back(priorityQueue->pop());
+                    }
+                    
+                    // Greedily select the candidates whose neighbourhoods do not overlap. Since the first candidate is
+                    // always selected, every round makes progress.
+                    batch.clear();
+                    postponedCandidates.clear();
+                    for (auto const& state : candidates) {
+                        if (batch.size() < numberOfThreads && isNeighbourhoodUnmarked(state, markedStates)) {
+                            markNeighbourhood(state, markedStates);
+                            batch.push_back(state);
+                        } else {
+                            postponedCandidates.push_back(state);
+                        }
+                    }
+                    std::swap(candidates, postponedCandidates);
+                    markedStates.clear();
+                    STORM_LOG_TRACE("Eliminating batch of " << batch.size() << " states.");
+                    
+                    // Eliminate the states of the batch concurrently.
+                    deferPriorityUpdates = true;
+                    std::atomic<uint64_t> nextIndex(0);
+                    std::vector<std::exception_ptr> exceptions(batch.size());
+                    auto worker = [&] (uint64_t workerIndex) {
+                        try {
+                            for (uint64_t index = nextIndex++; index < batch.size(); index = nextIndex++) {
+                                storm::storage::sparse::state_type state = batch[index];
+                                bool removeForward = removeForwardTransitions(state);
+                                this->eliminateState(state, removeForward);
+                                if (removeForward) {
+                                    clearStateValues(state);
+                                }
+                            }
+                        } catch (...) {
+                            exceptions[workerIndex] = std::current_exception();
+                        }
+                    };
+                    std::vector<std::thread> threads;
+                    for (uint64_t workerIndex = 1; workerIndex < batch.size(); ++workerIndex) {
+                        threads.emplace_back(worker, workerIndex);
+                    }
+                    worker(0);
+                    for (auto& thread : threads) {
+                        thread.join();
+                    }
+                    deferPriorityUpdates = false;
+                    for (auto const& exception : exceptions) {
+                        if (exception) {
+                            std::rethrow_exception(exception);
+                        }
+                    }
+                    
+                    // Now that the batch is complete, apply the priority updates.
+                    for (auto const& state : deferredPriorityUpdates) {
+                        priorityQueue->update(state);
+                    }
+                    deferredPriorityUpdates.clear();
+                }
+            }
+            
+            template<typename ValueType>
+            bool PrioritizedStateEliminator<ValueType>::isNeighbourhoodUnmarked(storm::storage::sparse::state_type const& state, storm::storage::BitVector const& markedStates) const {
+                if (markedStates.get(state)) {
+                    return false;
+                }
+                for (auto const& entry : this->matrix.getRow(state)) {
+                    if (markedStates.get(entry.getColumn())) {
+                        return false;
+                    }
+                }
+                for (auto const& entry : this->transposedMatrix.getRow(state)) {
+                    if (markedStates.get(entry.getColumn())) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+            
+            template<typename ValueType>
+            void PrioritizedStateEliminator<ValueType>::markNeighbourhood(storm::storage::sparse::state_type const& state, storm::storage::BitVector& markedStates) const {
+                markedStates.set(state);
+                for (auto const& entry : this->matrix.getRow(state)) {
+                    markedStates.set(entry.getColumn());
+                }
+                for (auto const& entry : this->transposedMatrix.getRow(state)) {
+                    markedStates.set(entry.getColumn());
+                }
+            }
+
             template<typename ValueType>
             void PrioritizedStateEliminator<ValueType>::clearStateValues(storm::storage::sparse::state_type const &state) {
                 stateValues[state] = storm::utility::zero<ValueType>();
             }
             
+            template<typename ValueType>
+            uint64_t PrioritizedStateEliminator<ValueType>::getNumberOfEliminationThreads(uint64_t numberOfThreads) {
+                if (!std::is_same<ValueType, double>::value) {
+                    STORM_LOG_WARN_COND(numberOfThreads <= 1, "Parallel state elimination is only supported for double. Eliminating states sequentially.");
+                    return 1;
+                }
+                return numberOfThreads;
+            }
+            
             template class PrioritizedStateEliminator<double>;
 
 #ifdef STORM_HAVE_CARL
@@ -1,6 +1,9 @@
 #ifndef STORM_SOLVER_STATEELIMINATION_PRIORITIZEDSTATEELIMINATOR_H_
 #define STORM_SOLVER_STATEELIMINATION_PRIORITIZEDSTATEELIMINATOR_H_
 
+#include <functional>
+#include <mutex>
+
 #include "storm/solver/stateelimination/StateEliminator.h"
 
 namespace storm {
@@ -23,10 +26,55 @@ namespace storm {
                 virtual void updatePriority(storm::storage::sparse::state_type const& state) override;
 
                 virtual void eliminateAll(bool eliminateForwardTransitions = true);
+                
+                /*!
+                 * Eliminates all states in the priority queue using the given number of threads. In every round, the
+                 * states with the highest priorities are scanned and a batch of states with pairwise disjoint
+                 * neighbourhoods (the state itself, its predecessors and its successors) is selected. As eliminating a
+                 * state only modifies the rows and values of the states in its neighbourhood, the states of a batch can
+                 * be eliminated concurrently without any synchronization on the matrices. Priority updates triggered
+                 * during a batch are applied once the batch is complete.
+                 *
+                 * If the value type does not support parallel elimination, the states are eliminated sequentially.
+                 *
+                 * @param numberOfThreads The number of threads to use.
+                 * @param removeForwardTransitions Decides for every state whether its forward transitions are removed.
+                 */
+                void eliminateAllInParallel(uint64_t numberOfThreads, std::function<bool(storm::storage::sparse::state_type const&)> const& removeForwardTransitions);
+                
                 virtual void clearStateValues(storm::storage::sparse::state_type const& state);
+                
+                /*!
+                 * Retrieves the number of threads that are used to eliminate states in parallel. Only double values are
+                 * eliminated in parallel, because the arithmetic of the exact and parametric value types is not
+                 * thread-safe (e.g. the reference counts of CLN numbers and the caches of carl).
+                 *
+                 * @param numberOfThreads The number of requested threads.
+                 * @return The number of threads that are actually used.
+                 */
+                static uint64_t getNumberOfEliminationThreads(uint64_t numberOfThreads);
+                
             protected:
                 PriorityQueuePointer priorityQueue;
                 std::vector<ValueType>& stateValues;
+                
+            private:
+                /*!
+                 * Retrieves whether none of the states in the neighbourhood of the given state is marked.
+                 */
+                bool isNeighbourhoodUnmarked(storm::storage::sparse::state_type const& state, storm::storage::BitVector const& markedStates) const;
+                
+                /*!
+                 * Marks all states in the neighbourhood of the given state.
+                 */
+                void markNeighbourhood(storm::storage::sparse::state_type const& state, storm::storage::BitVector& markedStates) const;
+                
+                // Whether priority updates are currently collected instead of being applied immediately.
+                bool deferPriorityUpdates = false;
+                
+                // The states whose priority needs to be updated after the current batch and a mutex guarding them.
+                std::vector<storm::storage::sparse::state_type> deferredPriorityUpdates;
+                std::mutex deferredPriorityUpdatesMutex;
             };
             
         } // namespace stateelimination
@@ -97,7 +97,7 @@ namespace storm {
                     }
                 } else {
                     constantDefinitions.push_back("");
-                    janiFiles.push_back(janiFileName);
+                    janiFiles.push_back(modelPath + "/" + janiFileName);
                 }
             }
         }
@@ -1,32 +1,85 @@
 #include <storm/utility/vector.h>
 #include "storm/storage/Scheduler.h"
 
+#include <limits>
+
 #include "storm/utility/macros.h"
 #include "storm/exceptions/NotImplementedException.h"
+#include "storm/exceptions/InvalidOperationException.h"
 
 namespace storm {
     namespace storage {
         
         template <typename ValueType>
-        Scheduler<ValueType>::Scheduler(uint_fast64_t numberOfModelStates, boost::optional<storm::storage::MemoryStructure> const& memoryStructure) : memoryStructure(memoryStructure) {
-            uint_fast64_t numOfMemoryStates = memoryStructure ? memoryStructure->getNumberOfStates() : 1;
-            schedulerChoices = std::vector<std::vector<SchedulerChoice<ValueType>>>(numOfMemoryStates, std::vector<SchedulerChoice<ValueType>>(numberOfModelStates));
+        Scheduler<ValueType>::Scheduler(uint_fast64_t numberOfModelStates, boost::optional<storm::storage::MemoryStructure> const& memoryStructure) : memoryStructure(memoryStructure), numberOfModelStates(numberOfModelStates) {
+            uint_fast64_t numOfMemoryStates = this->memoryStructure ? this->memoryStructure->getNumberOfStates() : 1;
+            compactRepresentation = numOfMemoryStates == 1;
+            if (compactRepresentation) {
+                compactChoices = std::vector<uint32_t>(numberOfModelStates, 0);
+                undefinedStates = storm::storage::BitVector(numberOfModelStates, true);
+            } else {
+                schedulerChoices = std::vector<std::vector<SchedulerChoice<ValueType>>>(numOfMemoryStates, std::vector<SchedulerChoice<ValueType>>(numberOfModelStates));
+            }
             numOfUndefinedChoices = numOfMemoryStates * numberOfModelStates;
             numOfDeterministicChoices = 0;
         }
         
         template <typename ValueType>
-        Scheduler<ValueType>::Scheduler(uint_fast64_t numberOfModelStates, boost::optional<storm::storage::MemoryStructure>&& memoryStructure) : memoryStructure(std::move(memoryStructure)) {
-            uint_fast64_t numOfMemoryStates = memoryStructure ? memoryStructure->getNumberOfStates() : 1;
-            schedulerChoices = std::vector<std::vector<SchedulerChoice<ValueType>>>(numOfMemoryStates, std::vector<SchedulerChoice<ValueType>>(numberOfModelStates));
+        Scheduler<ValueType>::Scheduler(uint_fast64_t numberOfModelStates, boost::optional<storm::storage::MemoryStructure>&& memoryStructure) : memoryStructure(std::move(memoryStructure)), numberOfModelStates(numberOfModelStates) {
+            uint_fast64_t numOfMemoryStates = this->memoryStructure ? this->memoryStructure->getNumberOfStates() : 1;
+            compactRepresentation = numOfMemoryStates == 1;
+            if (compactRepresentation) {
+                compactChoices = std::vector<uint32_t>(numberOfModelStates, 0);
+                undefinedStates = storm::storage::BitVector(numberOfModelStates, true);
+            } else {
+                schedulerChoices = std::vector<std::vector<SchedulerChoice<ValueType>>>(numOfMemoryStates, std::vector<SchedulerChoice<ValueType>>(numberOfModelStates));
+            }
             numOfUndefinedChoices = numOfMemoryStates * numberOfModelStates;
             numOfDeterministicChoices = 0;
         }
         
+        template <typename ValueType>
+        void Scheduler<ValueType>::convertToFullRepresentation() {
+            STORM_LOG_ASSERT(compactRepresentation, "Scheduler is already in full representation.");
+            std::vector<SchedulerChoice<ValueType>> choices(numberOfModelStates);
+            for (uint_fast64_t modelState = 0; modelState < numberOfModelStates; ++modelState) {
+                if (!undefinedStates.get(modelState)) {
+                    choices[modelState] = SchedulerChoice<ValueType>(static_cast<uint_fast64_t>(compactChoices[modelState]));
+                }
+            }
+            schedulerChoices.clear();
+            schedulerChoices.push_back(std::move(choices));
+            compactRepresentation = false;
+            compactChoices = std::vector<uint32_t>();
+            undefinedStates = storm::storage::BitVector();
+        }
+        
         template <typename ValueType>
         void Scheduler<ValueType>::setChoice(SchedulerChoice<ValueType> const& choice, uint_fast64_t modelState, uint_fast64_t memoryState) {
             STORM_LOG_ASSERT(memoryState < getNumberOfMemoryStates(), "Illegal memory state index");
-            STORM_LOG_ASSERT(modelState < schedulerChoices[memoryState].size(), "Illegal model state index");
+            STORM_LOG_ASSERT(modelState < numberOfModelStates, "Illegal model state index");
+            
+            if (compactRepresentation) {
+                // Randomized choices (and choice indices that do not fit into the compact representation) require the full representation.
+                if (choice.isDefined() && (!choice.isDeterministic() || choice.getDeterministicChoice() > std::numeric_limits<uint32_t>::max())) {
+                    convertToFullRepresentation();
+                } else {
+                    bool wasDefined = !undefinedStates.get(modelState);
+                    if (wasDefined && !choice.isDefined()) {
+                        ++numOfUndefinedChoices;
+                        assert(numOfDeterministicChoices > 0);
+                        --numOfDeterministicChoices;
+                    } else if (!wasDefined && choice.isDefined()) {
+                        assert(numOfUndefinedChoices > 0);
+                        --numOfUndefinedChoices;
+                        ++numOfDeterministicChoices;
+                    }
+                    undefinedStates.set(modelState, !choice.isDefined());
+                    compactChoices[modelState] = choice.isDefined() ? static_cast<uint32_t>(choice.getDeterministicChoice()) : 0;
+                    return;
+                }
+            }
+            
             auto& schedulerChoice = schedulerChoices[memoryState][modelState];
             if (schedulerChoice.isDefined()) {
                 if (!choice.isDefined()) {
@@ -54,6 +107,9 @@ namespace storm {
 
         template <typename ValueType>
         bool Scheduler<ValueType>::isChoiceSelected(BitVector const& selectedStates, uint64_t memoryState) const {
+            if (compactRepresentation) {
+                return selectedStates.isDisjointFrom(undefinedStates);
+            }
             for (auto const& selectedState : selectedStates) {
                 auto& schedulerChoice = schedulerChoices[memoryState][selectedState];
                 if (!schedulerChoice.isDefined()) {
@@ -66,22 +122,60 @@ namespace storm {
         template <typename ValueType>
         void Scheduler<ValueType>::clearChoice(uint_fast64_t modelState, uint_fast64_t memoryState) {
             STORM_LOG_ASSERT(memoryState < getNumberOfMemoryStates(), "Illegal memory state index");
-            STORM_LOG_ASSERT(modelState < schedulerChoices[memoryState].size(), "Illegal model state index");
+            STORM_LOG_ASSERT(modelState < numberOfModelStates, "Illegal model state index");
             setChoice(SchedulerChoice<ValueType>(), modelState, memoryState);
         }
  
         template <typename ValueType>
-        SchedulerChoice<ValueType> const& Scheduler<ValueType>::getChoice(uint_fast64_t modelState, uint_fast64_t memoryState) const {
+        SchedulerChoice<ValueType> Scheduler<ValueType>::getChoice(uint_fast64_t modelState, uint_fast64_t memoryState) const {
             STORM_LOG_ASSERT(memoryState < getNumberOfMemoryStates(), "Illegal memory state index");
-            STORM_LOG_ASSERT(modelState < schedulerChoices[memoryState].size(), "Illegal model state index");
+            STORM_LOG_ASSERT(modelState < numberOfModelStates, "Illegal model state index");
+            if (compactRepresentation) {
+                if (undefinedStates.get(modelState)) {
+                    return SchedulerChoice<ValueType>();
+                }
+                return SchedulerChoice<ValueType>(static_cast<uint_fast64_t>(compactChoices[modelState]));
+            }
             return schedulerChoices[memoryState][modelState];
         }
+        
+        template <typename ValueType>
+        bool Scheduler<ValueType>::isChoiceDefined(uint_fast64_t modelState, uint_fast64_t memoryState) const {
+            STORM_LOG_ASSERT(memoryState < getNumberOfMemoryStates(), "Illegal memory state index");
+            STORM_LOG_ASSERT(modelState < numberOfModelStates, "Illegal model state index");
+            if (compactRepresentation) {
+                return !undefinedStates.get(modelState);
+            }
+            return schedulerChoices[memoryState][modelState].isDefined();
+        }
+        
+        template <typename ValueType>
+        uint_fast64_t Scheduler<ValueType>::getDeterministicChoice(uint_fast64_t modelState, uint_fast64_t memoryState) const {
+            STORM_LOG_ASSERT(memoryState < getNumberOfMemoryStates(), "Illegal memory state index");
+            STORM_LOG_ASSERT(modelState < numberOfModelStates, "Illegal model state index");
+            if (compactRepresentation) {
+                STORM_LOG_THROW(!undefinedStates.get(modelState), storm::exceptions::InvalidOperationException, "Tried to obtain the deterministic choice of a scheduler, but the choice is not defined");
+                return compactChoices[modelState];
+            }
+            return schedulerChoices[memoryState][modelState].getDeterministicChoice();
+        }
 
         template<typename ValueType>
         storm::storage::BitVector Scheduler<ValueType>::computeActionSupport(std::vector<uint_fast64_t> const& nondeterministicChoiceIndices) const {
             auto nrActions = nondeterministicChoiceIndices.back();
             storm::storage::BitVector result(nrActions);
 
+            if (compactRepresentation) {
+                STORM_LOG_ASSERT(nondeterministicChoiceIndices.size()-2 < numberOfModelStates, "Illegal model state index");
+                for (uint64_t stateId = 0; stateId < nondeterministicChoiceIndices.size()-1; ++stateId) {
+                    if (!undefinedStates.get(stateId)) {
+                        STORM_LOG_ASSERT(compactChoices[stateId] < nondeterministicChoiceIndices[stateId+1] - nondeterministicChoiceIndices[stateId], "Scheduler chooses action indexed " << compactChoices[stateId] << " in state id "  << stateId << " but state contains only " << nondeterministicChoiceIndices[stateId+1] - nondeterministicChoiceIndices[stateId] << " choices .");
+                        result.set(nondeterministicChoiceIndices[stateId] + compactChoices[stateId]);
+                    }
+                }
+                return result;
+            }
+
             for (auto const& choicesPerMemoryNode : schedulerChoices) {
 
                 STORM_LOG_ASSERT(nondeterministicChoiceIndices.size()-2 < choicesPerMemoryNode.size(), "Illegal model state index");
@@ -102,7 +196,7 @@ namespace storm {
         
         template <typename ValueType>
         bool Scheduler<ValueType>::isDeterministicScheduler() const {
-            return numOfDeterministicChoices == (schedulerChoices.size() * schedulerChoices.begin()->size()) - numOfUndefinedChoices;
+            return numOfDeterministicChoices == (getNumberOfMemoryStates() * numberOfModelStates) - numOfUndefinedChoices;
         }
         
         template <typename ValueType>
@@ -110,6 +204,16 @@ namespace storm {
             return getNumberOfMemoryStates() == 1;
         }
 
+        template <typename ValueType>
+        bool Scheduler<ValueType>::hasCompactRepresentation() const {
+            return compactRepresentation;
+        }
+        
+        template <typename ValueType>
+        uint_fast64_t Scheduler<ValueType>::getNumberOfModelStates() const {
+            return numberOfModelStates;
+        }
+
         template <typename ValueType>
         uint_fast64_t Scheduler<ValueType>::getNumberOfMemoryStates() const {
             return memoryStructure ? memoryStructure->getNumberOfStates() : 1;
@@ -122,13 +226,13 @@ namespace storm {
 
         template <typename ValueType>
         void Scheduler<ValueType>::printToStream(std::ostream& out, std::shared_ptr<storm::models::sparse::Model<ValueType>> model, bool skipUniqueChoices) const {
-            STORM_LOG_THROW(model == nullptr || model->getNumberOfStates() == schedulerChoices.front().size(), storm::exceptions::InvalidOperationException, "The given model is not compatible with this scheduler.");
+            STORM_LOG_THROW(model == nullptr || model->getNumberOfStates() == numberOfModelStates, storm::exceptions::InvalidOperationException, "The given model is not compatible with this scheduler.");
             
             bool const stateValuationsGiven = model != nullptr && model->hasStateValuations();
             bool const choiceOriginsGiven = model != nullptr && model->hasChoiceOrigins();
-            uint_fast64_t widthOfStates = std::to_string(schedulerChoices.front().size()).length();
+            uint_fast64_t widthOfStates = std::to_string(numberOfModelStates).length();
             if (stateValuationsGiven) {
-                widthOfStates += model->getStateValuations().getStateInfo(schedulerChoices.front().size() - 1).length() + 5;
+                widthOfStates += model->getStateValuations().getStateInfo(numberOfModelStates - 1).length() + 5;
             }
             widthOfStates = std::max(widthOfStates, (uint_fast64_t)12);
             uint_fast64_t numOfSkippedStatesWithUniqueChoice = 0;
@@ -143,7 +247,7 @@ namespace storm {
             out << ":" << std::endl;
             STORM_LOG_WARN_COND(!(skipUniqueChoices && model == nullptr), "Can not skip unique choices if the model is not given.");
             out << std::setw(widthOfStates) << "model state:" << "    " << (isMemorylessScheduler() ? "" : " memory:     ") << "choice(s)" << std::endl;
-                for (uint_fast64_t state = 0; state < schedulerChoices.front().size(); ++state) {
+                for (uint_fast64_t state = 0; state < numberOfModelStates; ++state) {
                     // Check whether the state is skipped
                     if (skipUniqueChoices && model != nullptr && model->getTransitionMatrix().getRowGroupSize(state) == 1) {
                         ++numOfSkippedStatesWithUniqueChoice;
@@ -173,7 +277,7 @@ namespace storm {
                         }
                         
                         // Print choice info
-                        SchedulerChoice<ValueType> const& choice = schedulerChoices[memoryState][state];
+                        SchedulerChoice<ValueType> choice = getChoice(state, memoryState);
                         if (choice.isDefined()) {
                             if (choice.isDeterministic()) {
                                 if (choiceOriginsGiven) {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include "storm/storage/BitVector.h"
 #include "storm/storage/memorystructure/MemoryStructure.h"
 #include "storm/storage/SchedulerChoice.h"
 
@@ -13,6 +14,10 @@ namespace storm {
          * This class defines which action is chosen in a particular state of a non-deterministic model. More concretely, a scheduler maps a state s to i
          * if the scheduler takes the i-th action available in s (i.e. the choices are relative to the states).
          * A Choice can be undefined, deterministic
+         *
+         * Memoryless schedulers whose choices are all deterministic (or undefined) are stored in a compact form that
+         * only keeps the local choice index of every state and a bit vector of the states with undefined choice. As
+         * soon as a randomized choice is set, the scheduler switches to the full representation.
          */
         template <typename ValueType>
         class Scheduler {
@@ -51,11 +56,23 @@ namespace storm {
             
             /*!
              * Gets the choice defined by the scheduler for the given model and memory state.
+             * Note that the choice is returned by value as it is not stored explicitly in the compact representation.
              *
              * @param state The state for which to get the choice.
              * @param memoryState the memory state which we consider.
              */
-            SchedulerChoice<ValueType> const& getChoice(uint_fast64_t modelState, uint_fast64_t memoryState = 0) const;
+            SchedulerChoice<ValueType> getChoice(uint_fast64_t modelState, uint_fast64_t memoryState = 0) const;
+            
+            /*!
+             * Retrieves whether the choice for the given model and memory state is defined.
+             */
+            bool isChoiceDefined(uint_fast64_t modelState, uint_fast64_t memoryState = 0) const;
+            
+            /*!
+             * Gets the (local) choice index for the given model and memory state. Throws if the choice is not deterministic.
+             * In contrast to getChoice, this does not construct a SchedulerChoice.
+             */
+            uint_fast64_t getDeterministicChoice(uint_fast64_t modelState, uint_fast64_t memoryState = 0) const;
 
             /*!
              * Compute the Action Support: A bit vector that indicates all actions that are selected with positive probability in some memory state
@@ -77,6 +94,16 @@ namespace storm {
              */
             bool isMemorylessScheduler() const;
             
+            /*!
+             * Retrieves whether the scheduler is stored in the compact representation for memoryless deterministic schedulers.
+             */
+            bool hasCompactRepresentation() const;
+            
+            /*!
+             * Retrieves the number of model states this scheduler considers.
+             */
+            uint_fast64_t getNumberOfModelStates() const;
+            
             /*!
              * Retrieves the number of memory states this scheduler considers.
              */
@@ -92,7 +119,7 @@ namespace storm {
              */
             template<typename NewValueType>
 			Scheduler<NewValueType> toValueType() const {
-                uint_fast64_t numModelStates = schedulerChoices.front().size();
+                uint_fast64_t numModelStates = this->getNumberOfModelStates();
                 Scheduler<NewValueType> newScheduler(numModelStates, memoryStructure);
                 for (uint_fast64_t memState = 0; memState < this->getNumberOfMemoryStates(); ++memState) {
                     for (uint_fast64_t modelState = 0; modelState < numModelStates; ++modelState) {
@@ -114,8 +141,22 @@ namespace storm {
         
         private:
             
+            /*!
+             * Switches from the compact representation to the full representation.
+             */
+            void convertToFullRepresentation();
+            
             boost::optional<storm::storage::MemoryStructure> memoryStructure;
+            uint_fast64_t numberOfModelStates;
+            
+            // The full representation that stores one choice per pair of model and memory state.
             std::vector<std::vector<SchedulerChoice<ValueType>>> schedulerChoices;
+            
+            // The compact representation for memoryless deterministic schedulers.
+            bool compactRepresentation;
+            std::vector<uint32_t> compactChoices;
+            storm::storage::BitVector undefinedStates;
+            
             uint_fast64_t numOfUndefinedChoices;
             uint_fast64_t numOfDeterministicChoices;
         };
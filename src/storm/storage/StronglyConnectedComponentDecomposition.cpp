@@ -4,6 +4,7 @@
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/Profiler.h"
 
 #include "storm/exceptions/UnexpectedException.h"
 
@@ -231,6 +232,9 @@ namespace storm {
                     storm::utility::vector::filterVectorInPlace(this->sccDepths.get(), ~blocksToDrop);
                 }
             }
+            
+            storm::utility::addToProfilerCounter("scc decompositions", 1);
+            storm::utility::addToProfilerCounter("sccs", this->blocks.size());
         }
         
         template <typename ValueType>
@@ -149,12 +149,17 @@ namespace storm {
             return preprocess(substitution);
         }
         
-        SymbolicModelDescription SymbolicModelDescription::preprocess(std::map<storm::expressions::Variable, storm::expressions::Expression> const& constantDefinitions) const {
+        SymbolicModelDescription SymbolicModelDescription::preprocess(std::map<storm::expressions::Variable, storm::expressions::Expression> const& constantDefinitions, bool substituteConstants) const {
             if (this->isJaniModel()) {
-                storm::jani::Model preparedModel = this->asJaniModel().defineUndefinedConstants(constantDefinitions).substituteConstantsFunctions();
+                storm::jani::Model preparedModel = this->asJaniModel().defineUndefinedConstants(constantDefinitions);
+                if (substituteConstants) {
+                    preparedModel = preparedModel.substituteConstantsFunctions();
+                } else {
+                    preparedModel.substituteFunctions();
+                }
                 return SymbolicModelDescription(preparedModel);
             } else if (this->isPrismProgram()) {
-                return SymbolicModelDescription(this->asPrismProgram().defineUndefinedConstants(constantDefinitions).substituteConstantsFormulas());
+                return SymbolicModelDescription(this->asPrismProgram().defineUndefinedConstants(constantDefinitions).substituteConstantsFormulas(substituteConstants));
             }
             return *this;
         }
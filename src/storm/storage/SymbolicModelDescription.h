@@ -51,7 +51,13 @@ namespace storm {
             std::pair<SymbolicModelDescription, std::vector<storm::jani::Property>> toJani(std::vector<storm::jani::Property> const& properties, bool makeVariablesGlobal) const;
             
             SymbolicModelDescription preprocess(std::string const& constantDefinitionString = "") const;
-            SymbolicModelDescription preprocess(std::map<storm::expressions::Variable, storm::expressions::Expression> const& constantDefinitions) const;
+            
+            /*!
+             * Defines the given undefined constants and substitutes formulas (or functions, respectively). If
+             * requested, the (now defined) constants are also substituted by their values. Otherwise, they remain
+             * symbolic in the expressions of the model.
+             */
+            SymbolicModelDescription preprocess(std::map<storm::expressions::Variable, storm::expressions::Expression> const& constantDefinitions, bool substituteConstants = true) const;
             
             std::map<storm::expressions::Variable, storm::expressions::Expression> parseConstantDefinitions(std::string const& constantDefinitionString) const;
             
@@ -1042,6 +1042,18 @@ namespace storm {
             return Add<LibraryType, ValueType>(ddManager, InternalAdd<LibraryType, ValueType>::fromVector(ddManager.getInternalDdManagerPointer(), values, odd, ddManager.getSortedVariableIndices(metaVariables)), metaVariables);
         }
         
+        template<DdType LibraryType, typename ValueType>
+        Add<LibraryType, ValueType> Add<LibraryType, ValueType>::sum(DdManager<LibraryType> const& ddManager, std::vector<Add<LibraryType, ValueType>> const& adds) {
+            std::vector<InternalAdd<LibraryType, ValueType>> internalAdds;
+            internalAdds.reserve(adds.size());
+            std::set<storm::expressions::Variable> metaVariables;
+            for (auto const& add : adds) {
+                internalAdds.push_back(add.internalAdd);
+                metaVariables.insert(add.getContainedMetaVariables().begin(), add.getContainedMetaVariables().end());
+            }
+            return Add<LibraryType, ValueType>(ddManager, InternalAdd<LibraryType, ValueType>::sum(ddManager.getInternalDdManagerPointer(), internalAdds), metaVariables);
+        }
+        
         template<DdType LibraryType, typename ValueType>
         Bdd<LibraryType> Add<LibraryType, ValueType>::toBdd() const {
             return this->notZero();
@@ -59,6 +59,16 @@ namespace storm {
              */
             static Add<LibraryType, ValueType> fromVector(DdManager<LibraryType> const& ddManager, std::vector<ValueType> const& values, Odd const& odd, std::set<storm::expressions::Variable> const& metaVariables);
             
+            /*!
+             * Computes the sum of the given ADDs. The ADDs are summed in a balanced tree, whose independent subtrees
+             * are evaluated in parallel if the underlying library supports it (Sylvan).
+             *
+             * @param ddManager The manager responsible for the ADDs.
+             * @param adds The ADDs to sum.
+             * @return The sum of the ADDs.
+             */
+            static Add<LibraryType, ValueType> sum(DdManager<LibraryType> const& ddManager, std::vector<Add<LibraryType, ValueType>> const& adds);
+            
             /*!
              * Retrieves whether the two DDs represent the same function.
              *
@@ -68,6 +68,18 @@ namespace storm {
             return Bdd<LibraryType>(ddManager, InternalBdd<LibraryType>::fromVector(&ddManager.getInternalDdManager(), odd, ddManager.getSortedVariableIndices(metaVariables), [targetOffset] (uint64_t offset) { return offset == targetOffset; }), metaVariables);
         }
         
+        template<DdType LibraryType>
+        Bdd<LibraryType> Bdd<LibraryType>::disjunction(DdManager<LibraryType> const& ddManager, std::vector<Bdd<LibraryType>> const& bdds) {
+            std::vector<InternalBdd<LibraryType>> internalBdds;
+            internalBdds.reserve(bdds.size());
+            std::set<storm::expressions::Variable> metaVariables;
+            for (auto const& bdd : bdds) {
+                internalBdds.push_back(bdd.internalBdd);
+                metaVariables.insert(bdd.getContainedMetaVariables().begin(), bdd.getContainedMetaVariables().end());
+            }
+            return Bdd<LibraryType>(ddManager, InternalBdd<LibraryType>::disjunction(ddManager.getInternalDdManagerPointer(), internalBdds), metaVariables);
+        }
+        
         template<DdType LibraryType>
         bool Bdd<LibraryType>::operator==(Bdd<LibraryType> const& other) const {
             return internalBdd == other.internalBdd;
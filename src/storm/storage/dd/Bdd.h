@@ -55,6 +55,16 @@ namespace storm {
              */
             static Bdd<LibraryType> getEncoding(DdManager<LibraryType> const& ddManager, uint64_t targetOffset, storm::dd::Odd const& odd, std::set<storm::expressions::Variable> const& metaVariables);
             
+            /*!
+             * Computes the disjunction of the given BDDs. The BDDs are combined in a balanced tree, whose independent
+             * subtrees are evaluated in parallel if the underlying library supports it (Sylvan).
+             *
+             * @param ddManager The manager responsible for the BDDs.
+             * @param bdds The BDDs to combine.
+             * @return The disjunction of the BDDs.
+             */
+            static Bdd<LibraryType> disjunction(DdManager<LibraryType> const& ddManager, std::vector<Bdd<LibraryType>> const& bdds);
+            
             /*!
              * Constructs a BDD representation of all encodings whose value is true in the given list of truth values.
              *
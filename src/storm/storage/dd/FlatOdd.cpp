@@ -0,0 +1,154 @@
+#include "storm/storage/dd/FlatOdd.h"
+
+#include <limits>
+#include <unordered_map>
+
+#include "storm/storage/dd/Odd.h"
+#include "storm/storage/BitVector.h"
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+namespace storm {
+    namespace dd {
+        const uint64_t FlatOdd::NO_SUCCESSOR = std::numeric_limits<uint64_t>::max();
+
+        FlatOdd::FlatOdd(Odd const& odd) {
+            // Number the nodes level by level. As all paths through an ODD have the same length, every node belongs to
+            // exactly one level.
+            std::vector<Odd const*> oddNodes = {&odd};
+            uint64_t levelStart = 0;
+            while (levelStart < oddNodes.size()) {
+                uint64_t levelEnd = oddNodes.size();
+                levelStarts.push_back(levelStart);
+
+                std::unordered_map<Odd const*, uint64_t> nextLevelIndices;
+                auto getIndex = [&oddNodes, &nextLevelIndices] (Odd const* oddNode) {
+                    auto insertionResult = nextLevelIndices.emplace(oddNode, oddNodes.size());
+                    if (insertionResult.second) {
+                        oddNodes.push_back(oddNode);
+                    }
+                    return insertionResult.first->second;
+                };
+
+                for (uint64_t index = levelStart; index < levelEnd; ++index) {
+                    Odd const* oddNode = oddNodes[index];
+                    Node node = {oddNode->getElseOffset(), oddNode->getThenOffset(), NO_SUCCESSOR, NO_SUCCESSOR};
+                    if (!oddNode->isTerminalNode()) {
+                        node.elseSuccessor = getIndex(&oddNode->getElseSuccessor());
+                        node.thenSuccessor = getIndex(&oddNode->getThenSuccessor());
+                    }
+                    nodes.push_back(node);
+                }
+                levelStart = levelEnd;
+            }
+            levelStarts.push_back(nodes.size());
+        }
+
+        uint64_t FlatOdd::getHeight() const {
+            return levelStarts.size() - 1;
+        }
+
+        uint64_t FlatOdd::getNodeCount() const {
+            return nodes.size();
+        }
+
+        uint64_t FlatOdd::getTotalOffset() const {
+            return nodes.front().getTotalOffset();
+        }
+
+        uint64_t FlatOdd::getFirstNodeIndexOfLevel(uint64_t level) const {
+            return levelStarts[level];
+        }
+
+        FlatOdd::Node const& FlatOdd::getNode(uint64_t index) const {
+            return nodes[index];
+        }
+
+        storm::storage::BitVector FlatOdd::getEncoding(uint64_t offset, uint64_t variableCount) const {
+            storm::storage::BitVector result(variableCount > 0 ? variableCount : this->getHeight());
+            uint64_t variable = 0;
+            for (Node const* node = &nodes.front(); !node->isTerminalNode(); ++variable) {
+                if (node->elseOffset <= offset) {
+                    offset -= node->elseOffset;
+                    result.set(variable);
+                    node = &nodes[node->thenSuccessor];
+                } else {
+                    node = &nodes[node->elseSuccessor];
+                }
+            }
+            return result;
+        }
+
+        namespace detail {
+            struct OffsetPair {
+                uint64_t oldNode;
+                uint64_t newNode;
+                uint64_t oldOffset;
+                uint64_t newOffset;
+            };
+        }
+
+        template <typename ValueType>
+        void FlatOdd::expandExplicitVector(FlatOdd const& newOdd, std::vector<ValueType> const& oldValues, std::vector<ValueType>& newValues) const {
+            STORM_LOG_THROW(this->getHeight() == newOdd.getHeight(), storm::exceptions::InvalidArgumentException, "The ODDs for the translation must have the same height.");
+
+            // Traverse both ODDs simultaneously. The then-successors are pushed first, so the else-successors are
+            // processed first.
+            std::vector<detail::OffsetPair> stack = {{0, 0, 0, 0}};
+            while (!stack.empty()) {
+                detail::OffsetPair current = stack.back();
+                stack.pop_back();
+                Node const& oldNode = nodes[current.oldNode];
+                Node const& newNode = newOdd.nodes[current.newNode];
+
+                if (oldNode.isTerminalNode()) {
+                    if (oldNode.thenOffset != 0) {
+                        newValues[current.newOffset] += oldValues[current.oldOffset];
+                    }
+                } else if (oldNode.getTotalOffset() != 0) {
+                    stack.push_back({oldNode.thenSuccessor, newNode.thenSuccessor, current.oldOffset + oldNode.elseOffset, current.newOffset + newNode.elseOffset});
+                    stack.push_back({oldNode.elseSuccessor, newNode.elseSuccessor, current.oldOffset, current.newOffset});
+                }
+            }
+        }
+
+        void FlatOdd::oldToNewIndex(FlatOdd const& newOdd, std::function<void (uint64_t oldOffset, uint64_t newOffset)> const& callback) const {
+            STORM_LOG_ASSERT(this->getHeight() < newOdd.getHeight(), "Expected increase in height.");
+
+            std::vector<detail::OffsetPair> stack = {{0, 0, 0, 0}};
+            while (!stack.empty()) {
+                detail::OffsetPair current = stack.back();
+                stack.pop_back();
+                Node const& oldNode = nodes[current.oldNode];
+                Node const& newNode = newOdd.nodes[current.newNode];
+                if (oldNode.getTotalOffset() == 0 || newNode.getTotalOffset() == 0) {
+                    continue;
+                }
+
+                if (oldNode.isTerminalNode()) {
+                    if (oldNode.thenOffset != 0) {
+                        if (newNode.isTerminalNode()) {
+                            if (newNode.thenOffset != 0) {
+                                callback(current.oldOffset, current.newOffset);
+                            }
+                        } else {
+                            // Only the new ODD descends further.
+                            stack.push_back({current.oldNode, newNode.thenSuccessor, current.oldOffset, current.newOffset + newNode.elseOffset});
+                            stack.push_back({current.oldNode, newNode.elseSuccessor, current.oldOffset, current.newOffset});
+                        }
+                    }
+                } else {
+                    stack.push_back({oldNode.thenSuccessor, newNode.thenSuccessor, current.oldOffset + oldNode.elseOffset, current.newOffset + newNode.elseOffset});
+                    stack.push_back({oldNode.elseSuccessor, newNode.elseSuccessor, current.oldOffset, current.newOffset});
+                }
+            }
+        }
+
+        template void FlatOdd::expandExplicitVector(FlatOdd const& newOdd, std::vector<double> const& oldValues, std::vector<double>& newValues) const;
+        template void FlatOdd::expandExplicitVector(FlatOdd const& newOdd, std::vector<storm::RationalNumber> const& oldValues, std::vector<storm::RationalNumber>& newValues) const;
+        template void FlatOdd::expandExplicitVector(FlatOdd const& newOdd, std::vector<storm::RationalFunction> const& oldValues, std::vector<storm::RationalFunction>& newValues) const;
+    }
+}
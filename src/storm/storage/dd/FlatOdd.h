@@ -0,0 +1,121 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <vector>
+
+namespace storm {
+    namespace storage {
+        class BitVector;
+    }
+
+    namespace dd {
+        class Odd;
+
+        /*!
+         * An offset-labeled DD whose nodes are stored level by level in one contiguous array. In contrast to the
+         * pointer-based ODD, all traversals are non-recursive and the nodes of one level are adjacent in memory.
+         */
+        class FlatOdd {
+        public:
+            // The index used for the (non-existing) successors of terminal nodes.
+            static const uint64_t NO_SUCCESSOR;
+
+            struct Node {
+                // The offsets that need to be added if the else- or then-successor is taken, respectively.
+                uint64_t elseOffset;
+                uint64_t thenOffset;
+
+                // The indices of the else- and then-successor in the node array.
+                uint64_t elseSuccessor;
+                uint64_t thenSuccessor;
+
+                bool isTerminalNode() const {
+                    return elseSuccessor == NO_SUCCESSOR;
+                }
+
+                uint64_t getTotalOffset() const {
+                    return elseOffset + thenOffset;
+                }
+            };
+
+            /*!
+             * Constructs the flat representation of the given ODD.
+             *
+             * @param odd The ODD to flatten.
+             */
+            FlatOdd(Odd const& odd);
+
+            FlatOdd(FlatOdd const& other) = default;
+            FlatOdd& operator=(FlatOdd const& other) = default;
+            FlatOdd(FlatOdd&& other) = default;
+            FlatOdd& operator=(FlatOdd&& other) = default;
+
+            /*!
+             * Retrieves the height of the ODD, i.e. the number of levels including the one of the terminal nodes.
+             */
+            uint64_t getHeight() const;
+
+            /*!
+             * Retrieves the number of (distinct) nodes of the ODD.
+             */
+            uint64_t getNodeCount() const;
+
+            /*!
+             * Retrieves the total offset of the root, i.e. the number of encodings represented by the ODD.
+             */
+            uint64_t getTotalOffset() const;
+
+            /*!
+             * Retrieves the index of the first node on the given level. The nodes of the level are the ones with
+             * indices between this index and the first index of the next level.
+             *
+             * @param level The level. Passing the height yields the total number of nodes.
+             */
+            uint64_t getFirstNodeIndexOfLevel(uint64_t level) const;
+
+            /*!
+             * Retrieves the node with the given index. The root has index 0.
+             */
+            Node const& getNode(uint64_t index) const;
+
+            /*!
+             * Retrieves the encoding for the given offset.
+             *
+             * @param offset The target offset.
+             * @param variableCount If not null, this indicates how many variables are contained in the encoding. If 0,
+             * this number is automatically determined.
+             */
+            storm::storage::BitVector getEncoding(uint64_t offset, uint64_t variableCount = 0) const;
+
+            /*!
+             * Adds the old values to the new values. It does so by writing the old values at their correct positions
+             * wrt. to the new ODD.
+             *
+             * @param newOdd The new ODD to use. It needs to have the same height as this ODD.
+             * @param oldValues The old vector of values (which is being read).
+             * @param newValues The new vector of values (which is being written).
+             */
+            template <typename ValueType>
+            void expandExplicitVector(FlatOdd const& newOdd, std::vector<ValueType> const& oldValues, std::vector<ValueType>& newValues) const;
+
+            /*!
+             * Translates the indices of the old ODD to that of the new ODD by calling the callback for each old-new
+             * offset pair. Note that for each old offset, there may be multiple new offsets. The new ODD is expected
+             * to extend the old ODD by adding layers *at the bottom*.
+             *
+             * @param newOdd The new ODD to use.
+             * @param callback The callback function.
+             */
+            void oldToNewIndex(FlatOdd const& newOdd, std::function<void (uint64_t oldOffset, uint64_t newOffset)> const& callback) const;
+
+        private:
+            // The nodes ordered by level, where the root is the first node.
+            std::vector<Node> nodes;
+
+            // For each level (and the height), the index of the first node of the level.
+            std::vector<uint64_t> levelStarts;
+        };
+    }
+}
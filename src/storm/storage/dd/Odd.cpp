@@ -5,6 +5,7 @@
 #include <boost/algorithm/string/join.hpp>
 
 #include "storm/storage/BitVector.h"
+#include "storm/storage/dd/FlatOdd.h"
 
 #include "storm/utility/macros.h"
 #include "storm/exceptions/InvalidArgumentException.h"
@@ -32,6 +33,7 @@ namespace storm {
         
         void Odd::setElseOffset(uint_fast64_t newOffset) {
             this->elseOffset = newOffset;
+            std::atomic_store(&this->flatOdd, std::shared_ptr<FlatOdd const>());
         }
         
         uint_fast64_t Odd::getThenOffset() const {
@@ -40,6 +42,7 @@ namespace storm {
         
         void Odd::setThenOffset(uint_fast64_t newOffset) {
             this->thenOffset = newOffset;
+            std::atomic_store(&this->flatOdd, std::shared_ptr<FlatOdd const>());
         }
         
         uint_fast64_t Odd::getTotalOffset() const {
@@ -61,12 +64,12 @@ namespace storm {
         }
         
         uint_fast64_t Odd::getHeight() const {
-            if (this->isTerminalNode()) {
-                return 1;
-            } else {
-                // Since both subtrees have the same height, we only count the height of the else-tree.
-                return 1 + this->getElseSuccessor().getHeight();
+            // Since all subtrees of a node have the same height, we only follow the else-successors.
+            uint_fast64_t height = 1;
+            for (Odd const* node = this; !node->isTerminalNode(); node = node->elseNode.get()) {
+                ++height;
             }
+            return height;
         }
         
         bool Odd::isTerminalNode() const {
@@ -75,47 +78,24 @@ namespace storm {
         
         template <typename ValueType>
         void Odd::expandExplicitVector(storm::dd::Odd const& newOdd, std::vector<ValueType> const& oldValues, std::vector<ValueType>& newValues) const {
-            expandValuesToVectorRec(0, *this, oldValues, 0, newOdd, newValues);
+            this->getFlatOdd().expandExplicitVector(newOdd.getFlatOdd(), oldValues, newValues);
         }
         
-        template <typename ValueType>
-        void Odd::expandValuesToVectorRec(uint_fast64_t oldOffset, storm::dd::Odd const& oldOdd, std::vector<ValueType> const& oldValues, uint_fast64_t newOffset, storm::dd::Odd const& newOdd, std::vector<ValueType>& newValues) {
-            if (oldOdd.isTerminalNode()) {
-                STORM_LOG_THROW(newOdd.isTerminalNode(), storm::exceptions::InvalidArgumentException, "The ODDs for the translation must have the same height.");
-                if (oldOdd.getThenOffset() != 0) {
-                    newValues[newOffset] += oldValues[oldOffset];
-                }
-            } else {
-                expandValuesToVectorRec(oldOffset, oldOdd.getElseSuccessor(), oldValues, newOffset, newOdd.getElseSuccessor(), newValues);
-                expandValuesToVectorRec(oldOffset + oldOdd.getElseOffset(), oldOdd.getThenSuccessor(), oldValues, newOffset + newOdd.getElseOffset(), newOdd.getThenSuccessor(), newValues);
-            }
-        }
-
         void Odd::oldToNewIndex(storm::dd::Odd const& newOdd, std::function<void (uint64_t oldOffset, uint64_t newOffset)> const& callback) const {
-            STORM_LOG_ASSERT(this->getHeight() < newOdd.getHeight(), "Expected increase in height.");
-            oldToNewIndexRec(0, *this, 0, newOdd, callback);
+            this->getFlatOdd().oldToNewIndex(newOdd.getFlatOdd(), callback);
         }
         
-        void Odd::oldToNewIndexRec(uint_fast64_t oldOffset, storm::dd::Odd const& oldOdd, uint_fast64_t newOffset, storm::dd::Odd const& newOdd, std::function<void (uint64_t oldOffset, uint64_t newOffset)> const& callback) {
-            if (oldOdd.getTotalOffset() == 0 || newOdd.getTotalOffset() == 0) {
-                return;
-            }
-            
-            if (oldOdd.isTerminalNode()) {
-                if (oldOdd.getThenOffset() != 0) {
-                    if (newOdd.isTerminalNode()) {
-                        if (newOdd.getThenOffset() != 0) {
-                            callback(oldOffset, newOffset);
-                        }
-                    } else {
-                        oldToNewIndexRec(oldOffset, oldOdd, newOffset, newOdd.getElseSuccessor(), callback);
-                        oldToNewIndexRec(oldOffset, oldOdd, newOffset + newOdd.getElseOffset(), newOdd.getThenSuccessor(), callback);
-                    }
+        FlatOdd const& Odd::getFlatOdd() const {
+            std::shared_ptr<FlatOdd const> result = std::atomic_load(&this->flatOdd);
+            if (!result) {
+                // If several threads request the flat ODD at the same time, each of them creates it, but all but one
+                // of the (identical) results are discarded.
+                std::shared_ptr<FlatOdd const> newFlatOdd = std::make_shared<FlatOdd const>(*this);
+                if (std::atomic_compare_exchange_strong(&this->flatOdd, &result, newFlatOdd)) {
+                    result = newFlatOdd;
                 }
-            } else {
-                oldToNewIndexRec(oldOffset, oldOdd.getElseSuccessor(), newOffset, newOdd.getElseSuccessor(), callback);
-                oldToNewIndexRec(oldOffset + oldOdd.getElseOffset(), oldOdd.getThenSuccessor(), newOffset + newOdd.getElseOffset(), newOdd.getThenSuccessor(), callback);
             }
+            return *result;
         }
         
         void Odd::exportToDot(std::string const& filename) const {
@@ -159,23 +139,18 @@ namespace storm {
             storm::utility::closeFile(dotFile);
         }
         
-        void getEncodingRec(Odd const& odd, uint64_t index, uint64_t offset, storm::storage::BitVector& result) {
-            if (odd.isTerminalNode()) {
-                return;
-            }
-            
-            bool thenPath = false;
-            if (odd.getElseOffset() <= offset) {
-                thenPath = true;
-                offset -= odd.getElseOffset();
-                result.set(index);
-            }
-            getEncodingRec(thenPath ? odd.getThenSuccessor() : odd.getElseSuccessor(), index + 1, offset, result);
-        }
-        
         storm::storage::BitVector Odd::getEncoding(uint64_t offset, uint64_t variableCount) const {
             storm::storage::BitVector result(variableCount > 0 ? variableCount : this->getHeight());
-            getEncodingRec(*this, 0, offset, result);
+            uint64_t index = 0;
+            for (Odd const* node = this; !node->isTerminalNode(); ++index) {
+                if (node->getElseOffset() <= offset) {
+                    offset -= node->getElseOffset();
+                    result.set(index);
+                    node = node->thenNode.get();
+                } else {
+                    node = node->elseNode.get();
+                }
+            }
             return result;
         }
         
@@ -13,6 +13,8 @@ namespace storm {
     }
     
     namespace dd {
+        class FlatOdd;
+        
         class Odd {
         public:
             /*!
@@ -143,6 +145,15 @@ namespace storm {
              */
             storm::storage::BitVector getEncoding(uint64_t offset, uint64_t variableCount = 0) const;
             
+            /*!
+             * Retrieves a representation of this ODD whose nodes are stored level by level in contiguous memory and that
+             * can be traversed without recursion. It is created upon the first request and reused afterwards, so the
+             * conversions that use this ODD several times flatten it only once.
+             *
+             * @return The flattened ODD.
+             */
+            FlatOdd const& getFlatOdd() const;
+            
         private:
             /*!
              * Adds all nodes below the current one to the given mapping.
@@ -152,22 +163,6 @@ namespace storm {
              */
             void addToLevelToOddNodesMap(std::map<uint_fast64_t, std::unordered_set<storm::dd::Odd const*>>& levelToOddNodesMap, uint_fast64_t level = 0) const;
             
-            /*!
-             * Adds the values of the old explicit values to the new explicit values where the positions in the old vector
-             * are given by the current old ODD and the positions in the new vector are given by the new ODD.
-             *
-             * @param oldOffset The offset in the old explicit values.
-             * @param oldOdd The ODD to use for the old explicit values.
-             * @param oldValues The vector of old values.
-             * @param newOffset The offset in the new explicit values.
-             * @param newOdd The ODD to use for the new explicit values.
-             * @param newValues The vector of new values.
-             */
-            template <typename ValueType>
-            static void expandValuesToVectorRec(uint_fast64_t oldOffset, storm::dd::Odd const& oldOdd, std::vector<ValueType> const& oldValues, uint_fast64_t newOffset, storm::dd::Odd const& newOdd, std::vector<ValueType>& newValues);
-            
-            static void oldToNewIndexRec(uint_fast64_t oldOffset, storm::dd::Odd const& oldOdd, uint_fast64_t newOffset, storm::dd::Odd const& newOdd, std::function<void (uint64_t oldOffset, uint64_t newOffset)> const& callback);
-            
             // The then- and else-nodes.
             std::shared_ptr<Odd> elseNode;
             std::shared_ptr<Odd> thenNode;
@@ -175,6 +170,10 @@ namespace storm {
             // The offsets that need to be added if the then- or else-successor is taken, respectively.
             uint_fast64_t elseOffset;
             uint_fast64_t thenOffset;
+            
+            // The flattened ODD, if it was already requested. Since it is created lazily in const contexts that may be
+            // entered by several threads, it is only accessed atomically.
+            mutable std::shared_ptr<FlatOdd const> flatOdd;
         };
     }
 }
@@ -1,9 +1,14 @@
 #include "storm/storage/dd/cudd/InternalCuddAdd.h"
 
+#include <algorithm>
+#include <thread>
+#include <tuple>
+
 #include "storm/storage/dd/cudd/InternalCuddDdManager.h"
 #include "storm/storage/dd/cudd/InternalCuddBdd.h"
 #include "storm/storage/dd/cudd/CuddAddIterator.h"
 #include "storm/storage/dd/Odd.h"
+#include "storm/storage/dd/FlatOdd.h"
 
 #include "storm/storage/SparseMatrix.h"
 #include "storm/storage/BitVector.h"
@@ -13,6 +18,15 @@
 #include "storm/exceptions/NotImplementedException.h"
 #include "storm/exceptions/NotSupportedException.h"
 
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+
+#include "storm-config.h"
+
+#ifdef STORM_HAVE_INTELTBB
+#include "tbb/tbb.h"
+#endif
+
 namespace storm {
     namespace dd {
         template<typename ValueType>
@@ -494,24 +508,24 @@ namespace storm {
         
         template<typename ValueType>
         void InternalAdd<DdType::CUDD, ValueType>::composeWithExplicitVector(storm::dd::Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices, std::vector<ValueType>& targetVector, std::function<ValueType (ValueType const&, ValueType const&)> const& function) const {
-            forEachRec(this->getCuddDdNode(), 0, ddVariableIndices.size(), 0, odd, ddVariableIndices, [&function, &targetVector] (uint64_t const& offset, ValueType const& value) { targetVector[offset] = function(targetVector[offset], value); });
+            forEachRec(this->getCuddDdNode(), 0, ddVariableIndices.size(), 0, odd.getFlatOdd(), 0, ddVariableIndices, [&function, &targetVector] (uint64_t const& offset, ValueType const& value) { targetVector[offset] = function(targetVector[offset], value); });
         }
         
         template<typename ValueType>
         void InternalAdd<DdType::CUDD, ValueType>::forEach(Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices, std::function<void (uint64_t const&, ValueType const&)> const& function) const {
-            forEachRec(this->getCuddDdNode(), 0, ddVariableIndices.size(), 0, odd, ddVariableIndices, function);
+            forEachRec(this->getCuddDdNode(), 0, ddVariableIndices.size(), 0, odd.getFlatOdd(), 0, ddVariableIndices, function);
         }
         
         template<typename ValueType>
         void InternalAdd<DdType::CUDD, ValueType>::composeWithExplicitVector(storm::dd::Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices, std::vector<uint_fast64_t> const& offsets, std::vector<ValueType>& targetVector, std::function<ValueType (ValueType const&, ValueType const&)> const& function) const {
-            forEachRec(this->getCuddDdNode(), 0, ddVariableIndices.size(), 0, odd, ddVariableIndices, [&function, &targetVector, &offsets] (uint64_t const& offset, ValueType const& value) {
+            forEachRec(this->getCuddDdNode(), 0, ddVariableIndices.size(), 0, odd.getFlatOdd(), 0, ddVariableIndices, [&function, &targetVector, &offsets] (uint64_t const& offset, ValueType const& value) {
                 ValueType& targetValue = targetVector[offsets[offset]];
                 targetValue = function(targetValue, value);
             });
         }
 
         template<typename ValueType>
-        void InternalAdd<DdType::CUDD, ValueType>::forEachRec(DdNode const* dd, uint_fast64_t currentLevel, uint_fast64_t maxLevel, uint_fast64_t currentOffset, Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices, std::function<void (uint64_t const&, ValueType const&)> const& function) const {
+        void InternalAdd<DdType::CUDD, ValueType>::forEachRec(DdNode const* dd, uint_fast64_t currentLevel, uint_fast64_t maxLevel, uint_fast64_t currentOffset, FlatOdd const& odd, uint_fast64_t oddNode, std::vector<uint_fast64_t> const& ddVariableIndices, std::function<void (uint64_t const&, ValueType const&)> const& function) const {
             // For the empty DD, we do not need to add any entries.
             if (dd == Cudd_ReadZero(ddManager->getCuddManager().getManager())) {
                 return;
@@ -523,12 +537,14 @@ namespace storm {
             } else if (ddVariableIndices[currentLevel] < Cudd_NodeReadIndex(dd)) {
                 // If we skipped a level, we need to enumerate the explicit entries for the case in which the bit is set
                 // and for the one in which it is not set.
-                forEachRec(dd, currentLevel + 1, maxLevel, currentOffset, odd.getElseSuccessor(), ddVariableIndices, function);
-                forEachRec(dd, currentLevel + 1, maxLevel, currentOffset + odd.getElseOffset(), odd.getThenSuccessor(), ddVariableIndices, function);
+                FlatOdd::Node const& node = odd.getNode(oddNode);
+                forEachRec(dd, currentLevel + 1, maxLevel, currentOffset, odd, node.elseSuccessor, ddVariableIndices, function);
+                forEachRec(dd, currentLevel + 1, maxLevel, currentOffset + node.elseOffset, odd, node.thenSuccessor, ddVariableIndices, function);
             } else {
                 // Otherwise, we simply recursively call the function for both (different) cases.
-                forEachRec(Cudd_E_const(dd), currentLevel + 1, maxLevel, currentOffset, odd.getElseSuccessor(), ddVariableIndices, function);
-                forEachRec(Cudd_T_const(dd), currentLevel + 1, maxLevel, currentOffset + odd.getElseOffset(), odd.getThenSuccessor(), ddVariableIndices, function);
+                FlatOdd::Node const& node = odd.getNode(oddNode);
+                forEachRec(Cudd_E_const(dd), currentLevel + 1, maxLevel, currentOffset, odd, node.elseSuccessor, ddVariableIndices, function);
+                forEachRec(Cudd_T_const(dd), currentLevel + 1, maxLevel, currentOffset + node.elseOffset, odd, node.thenSuccessor, ddVariableIndices, function);
             }
         }
         
@@ -627,11 +643,17 @@ namespace storm {
         
         template<typename ValueType>
         void InternalAdd<DdType::CUDD, ValueType>::toMatrixComponents(std::vector<uint_fast64_t> const& rowGroupIndices, std::vector<uint_fast64_t>& rowIndications, std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues, Odd const& rowOdd, Odd const& columnOdd, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const {
-            return toMatrixComponentsRec(this->getCuddDdNode(), rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0, ddRowVariableIndices.size() + ddColumnVariableIndices.size(), 0, 0, ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+#ifdef STORM_HAVE_INTELTBB
+            if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
+                toMatrixComponentsParallel(rowGroupIndices, rowIndications, columnsAndValues, rowOdd.getFlatOdd(), columnOdd.getFlatOdd(), ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+                return;
+            }
+#endif
+            return toMatrixComponentsRec(this->getCuddDdNode(), rowGroupIndices, rowIndications, columnsAndValues, rowOdd.getFlatOdd(), 0, columnOdd.getFlatOdd(), 0, 0, 0, ddRowVariableIndices.size() + ddColumnVariableIndices.size(), 0, 0, ddRowVariableIndices, ddColumnVariableIndices, writeValues);
         }
 
         template<typename ValueType>
-        void InternalAdd<DdType::CUDD, ValueType>::toMatrixComponentsRec(DdNode const* dd, std::vector<uint_fast64_t> const& rowGroupOffsets, std::vector<uint_fast64_t>& rowIndications, std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues, Odd const& rowOdd, Odd const& columnOdd, uint_fast64_t currentRowLevel, uint_fast64_t currentColumnLevel, uint_fast64_t maxLevel, uint_fast64_t currentRowOffset, uint_fast64_t currentColumnOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool generateValues) const {
+        void InternalAdd<DdType::CUDD, ValueType>::toMatrixComponentsRec(DdNode const* dd, std::vector<uint_fast64_t> const& rowGroupOffsets, std::vector<uint_fast64_t>& rowIndications, std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues, FlatOdd const& rowOdd, uint_fast64_t rowOddNode, FlatOdd const& columnOdd, uint_fast64_t columnOddNode, uint_fast64_t currentRowLevel, uint_fast64_t currentColumnLevel, uint_fast64_t maxLevel, uint_fast64_t currentRowOffset, uint_fast64_t currentColumnOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool generateValues) const {
             // For the empty DD, we do not need to add any entries.
             if (dd == Cudd_ReadZero(ddManager->getCuddManager().getManager())) {
                 return;
@@ -672,15 +694,142 @@ namespace storm {
                     }
                 }
                 
+                FlatOdd::Node const& rowNode = rowOdd.getNode(rowOddNode);
+                FlatOdd::Node const& columnNode = columnOdd.getNode(columnOddNode);
+                
                 // Visit else-else.
-                toMatrixComponentsRec(elseElse, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getElseSuccessor(), columnOdd.getElseSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset, currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, generateValues);
+                toMatrixComponentsRec(elseElse, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd, rowNode.elseSuccessor, columnOdd, columnNode.elseSuccessor, currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset, currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, generateValues);
                 // Visit else-then.
-                toMatrixComponentsRec(elseThen, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getElseSuccessor(), columnOdd.getThenSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset, currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices, generateValues);
+                toMatrixComponentsRec(elseThen, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd, rowNode.elseSuccessor, columnOdd, columnNode.thenSuccessor, currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset, currentColumnOffset + columnNode.elseOffset, ddRowVariableIndices, ddColumnVariableIndices, generateValues);
                 // Visit then-else.
-                toMatrixComponentsRec(thenElse, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getThenSuccessor(), columnOdd.getElseSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, generateValues);
+                toMatrixComponentsRec(thenElse, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd, rowNode.thenSuccessor, columnOdd, columnNode.elseSuccessor, currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset + rowNode.elseOffset, currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, generateValues);
                 // Visit then-then.
-                toMatrixComponentsRec(thenThen, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getThenSuccessor(), columnOdd.getThenSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices, generateValues);
+                toMatrixComponentsRec(thenThen, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd, rowNode.thenSuccessor, columnOdd, columnNode.thenSuccessor, currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset + rowNode.elseOffset, currentColumnOffset + columnNode.elseOffset, ddRowVariableIndices, ddColumnVariableIndices, generateValues);
+            }
+        }
+        
+        template<typename ValueType>
+        void InternalAdd<DdType::CUDD, ValueType>::toMatrixComponentsParallel(std::vector<uint_fast64_t> const& rowGroupOffsets, std::vector<uint_fast64_t>& rowIndications, std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues, FlatOdd const& rowOdd, FlatOdd const& columnOdd, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const {
+            // A part of the DD together with the (index of the) column ODD node and column offset it is to be traversed with.
+            typedef std::tuple<DdNode const*, uint_fast64_t, uint_fast64_t> MatrixPart;
+            
+            // A set of rows given by a node of the row ODD together with the parts of the DD whose entries lie in these rows.
+            struct RowBlock {
+                uint_fast64_t rowOddNode;
+                uint_fast64_t rowOffset;
+                std::vector<MatrixPart> parts;
+            };
+            
+            DdNode const* zero = Cudd_ReadZero(ddManager->getCuddManager().getManager());
+            uint_fast64_t maxLevel = ddRowVariableIndices.size() + ddColumnVariableIndices.size();
+            uint_fast64_t numberOfBlocks = 8 * std::max(1u, std::thread::hardware_concurrency());
+            
+            // Split the rows along the topmost levels until there are enough blocks to balance the load. Splitting
+            // descends into the DD in the same way as toMatrixComponentsRec.
+            std::vector<RowBlock> blocks = {{0, 0, {MatrixPart(this->getCuddDdNode(), 0, 0)}}};
+            uint_fast64_t level = 0;
+            for (; level < ddRowVariableIndices.size() && blocks.size() < numberOfBlocks; ++level) {
+                std::vector<RowBlock> nextBlocks;
+                for (auto const& block : blocks) {
+                    FlatOdd::Node const& rowNode = rowOdd.getNode(block.rowOddNode);
+                    RowBlock elseBlock = {rowNode.elseSuccessor, block.rowOffset, {}};
+                    RowBlock thenBlock = {rowNode.thenSuccessor, block.rowOffset + rowNode.elseOffset, {}};
+                    
+                    for (auto const& part : block.parts) {
+                        DdNode const* dd = std::get<0>(part);
+                        FlatOdd::Node const& columnNode = columnOdd.getNode(std::get<1>(part));
+                        uint_fast64_t columnOffset = std::get<2>(part);
+                        
+                        DdNode const* elseElse;
+                        DdNode const* elseThen;
+                        DdNode const* thenElse;
+                        DdNode const* thenThen;
+                        if (ddColumnVariableIndices[level] < Cudd_NodeReadIndex(dd)) {
+                            elseElse = elseThen = thenElse = thenThen = dd;
+                        } else if (ddRowVariableIndices[level] < Cudd_NodeReadIndex(dd)) {
+                            elseElse = thenElse = Cudd_E_const(dd);
+                            elseThen = thenThen = Cudd_T_const(dd);
+                        } else {
+                            DdNode const* elseNode = Cudd_E_const(dd);
+                            if (ddColumnVariableIndices[level] < Cudd_NodeReadIndex(elseNode)) {
+                                elseElse = elseThen = elseNode;
+                            } else {
+                                elseElse = Cudd_E_const(elseNode);
+                                elseThen = Cudd_T_const(elseNode);
+                            }
+                            
+                            DdNode const* thenNode = Cudd_T_const(dd);
+                            if (ddColumnVariableIndices[level] < Cudd_NodeReadIndex(thenNode)) {
+                                thenElse = thenThen = thenNode;
+                            } else {
+                                thenElse = Cudd_E_const(thenNode);
+                                thenThen = Cudd_T_const(thenNode);
+                            }
+                        }
+                        
+                        if (elseElse != zero) {
+                            elseBlock.parts.emplace_back(elseElse, columnNode.elseSuccessor, columnOffset);
+                        }
+                        if (elseThen != zero) {
+                            elseBlock.parts.emplace_back(elseThen, columnNode.thenSuccessor, columnOffset + columnNode.elseOffset);
+                        }
+                        if (thenElse != zero) {
+                            thenBlock.parts.emplace_back(thenElse, columnNode.elseSuccessor, columnOffset);
+                        }
+                        if (thenThen != zero) {
+                            thenBlock.parts.emplace_back(thenThen, columnNode.thenSuccessor, columnOffset + columnNode.elseOffset);
+                        }
+                    }
+                    
+                    if (!elseBlock.parts.empty()) {
+                        nextBlocks.push_back(std::move(elseBlock));
+                    }
+                    if (!thenBlock.parts.empty()) {
+                        nextBlocks.push_back(std::move(thenBlock));
+                    }
+                }
+                blocks = std::move(nextBlocks);
+            }
+            
+            // Since the blocks cover disjoint rows, they write disjoint parts of the row indications and entries. The
+            // parts of a block are ordered by their columns, so the entries of each row remain sorted.
+            auto processBlocks = [&] (uint_fast64_t begin, uint_fast64_t end) {
+                for (uint_fast64_t blockIndex = begin; blockIndex < end; ++blockIndex) {
+                    RowBlock const& block = blocks[blockIndex];
+                    for (auto const& part : block.parts) {
+                        toMatrixComponentsRec(std::get<0>(part), rowGroupOffsets, rowIndications, columnsAndValues, rowOdd, block.rowOddNode, columnOdd, std::get<1>(part), level, level, maxLevel, block.rowOffset, std::get<2>(part), ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+                    }
+                }
+            };
+#ifdef STORM_HAVE_INTELTBB
+            tbb::parallel_for(tbb::blocked_range<uint_fast64_t>(0, blocks.size()), [&processBlocks] (tbb::blocked_range<uint_fast64_t> const& range) {
+                processBlocks(range.begin(), range.end());
+            });
+#else
+            processBlocks(0, blocks.size());
+#endif
+        }
+        
+        template<typename ValueType>
+        InternalAdd<DdType::CUDD, ValueType> InternalAdd<DdType::CUDD, ValueType>::sum(InternalDdManager<DdType::CUDD> const* ddManager, std::vector<InternalAdd<DdType::CUDD, ValueType>> const& adds) {
+            if (adds.empty()) {
+                return ddManager->template getAddZero<ValueType>();
+            }
+            
+            // CUDD is not thread-safe, so the levels of the tree are combined sequentially.
+            std::vector<InternalAdd<DdType::CUDD, ValueType>> level = adds;
+            while (level.size() > 1) {
+                std::vector<InternalAdd<DdType::CUDD, ValueType>> nextLevel;
+                nextLevel.reserve((level.size() + 1) / 2);
+                for (uint_fast64_t index = 0; index + 1 < level.size(); index += 2) {
+                    nextLevel.push_back(level[index] + level[index + 1]);
+                }
+                if (level.size() % 2 == 1) {
+                    nextLevel.push_back(level.back());
+                }
+                level = std::move(nextLevel);
             }
+            return level.front();
         }
         
         template<typename ValueType>
@@ -4,6 +4,7 @@
 
 #include "storm/storage/dd/cudd/InternalCuddDdManager.h"
 #include "storm/storage/dd/Odd.h"
+#include "storm/storage/dd/FlatOdd.h"
 
 #include "storm/storage/BitVector.h"
 #include "storm/storage/PairHash.h"
@@ -16,6 +17,27 @@ namespace storm {
             // Intentionally left empty.
         }
         
+        InternalBdd<DdType::CUDD> InternalBdd<DdType::CUDD>::disjunction(InternalDdManager<DdType::CUDD> const* ddManager, std::vector<InternalBdd<DdType::CUDD>> const& bdds) {
+            if (bdds.empty()) {
+                return ddManager->getBddZero();
+            }
+            
+            // CUDD is not thread-safe, so the levels of the tree are combined sequentially.
+            std::vector<InternalBdd<DdType::CUDD>> level = bdds;
+            while (level.size() > 1) {
+                std::vector<InternalBdd<DdType::CUDD>> nextLevel;
+                nextLevel.reserve((level.size() + 1) / 2);
+                for (uint_fast64_t index = 0; index + 1 < level.size(); index += 2) {
+                    nextLevel.push_back(level[index] || level[index + 1]);
+                }
+                if (level.size() % 2 == 1) {
+                    nextLevel.push_back(level.back());
+                }
+                level = std::move(nextLevel);
+            }
+            return level.front();
+        }
+        
         InternalBdd<DdType::CUDD> InternalBdd<DdType::CUDD>::fromVector(InternalDdManager<DdType::CUDD> const* ddManager, Odd const& odd, std::vector<uint_fast64_t> const& sortedDdVariableIndices, std::function<bool (uint64_t)> const& filter) {
             uint_fast64_t offset = 0;
             return InternalBdd<DdType::CUDD>(ddManager, cudd::BDD(ddManager->getCuddManager(), fromVectorRec(ddManager->getCuddManager().getManager(), offset, 0, sortedDdVariableIndices.size(), odd, sortedDdVariableIndices, filter)));
@@ -283,11 +305,11 @@ namespace storm {
         
         storm::storage::BitVector InternalBdd<DdType::CUDD>::toVector(storm::dd::Odd const& rowOdd, std::vector<uint_fast64_t> const& ddVariableIndices) const {
             storm::storage::BitVector result(rowOdd.getTotalOffset());
-            this->toVectorRec(Cudd_Regular(this->getCuddDdNode()), ddManager->getCuddManager(), result, rowOdd, Cudd_IsComplement(this->getCuddDdNode()), 0, ddVariableIndices.size(), 0, ddVariableIndices);
+            this->toVectorRec(Cudd_Regular(this->getCuddDdNode()), ddManager->getCuddManager(), result, rowOdd.getFlatOdd(), 0, Cudd_IsComplement(this->getCuddDdNode()), 0, ddVariableIndices.size(), 0, ddVariableIndices);
             return result;
         }
         
-        void InternalBdd<DdType::CUDD>::toVectorRec(DdNode const* dd, cudd::Cudd const& manager, storm::storage::BitVector& result, Odd const& rowOdd, bool complement, uint_fast64_t currentRowLevel, uint_fast64_t maxLevel, uint_fast64_t currentRowOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices) const {
+        void InternalBdd<DdType::CUDD>::toVectorRec(DdNode const* dd, cudd::Cudd const& manager, storm::storage::BitVector& result, FlatOdd const& rowOdd, uint_fast64_t rowOddNode, bool complement, uint_fast64_t currentRowLevel, uint_fast64_t maxLevel, uint_fast64_t currentRowOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices) const {
             // If there are no more values to select, we can directly return.
             if (dd == Cudd_ReadLogicZero(manager.getManager()) && !complement) {
                 return;
@@ -299,10 +321,12 @@ namespace storm {
             if (currentRowLevel == maxLevel) {
                 result.set(currentRowOffset, true);
             } else if (ddRowVariableIndices[currentRowLevel] < Cudd_NodeReadIndex(dd)) {
-                toVectorRec(dd, manager, result, rowOdd.getElseSuccessor(), complement, currentRowLevel + 1, maxLevel, currentRowOffset, ddRowVariableIndices);
-                toVectorRec(dd, manager, result, rowOdd.getThenSuccessor(), complement, currentRowLevel + 1, maxLevel, currentRowOffset + rowOdd.getElseOffset(), ddRowVariableIndices);
+                FlatOdd::Node const& rowNode = rowOdd.getNode(rowOddNode);
+                toVectorRec(dd, manager, result, rowOdd, rowNode.elseSuccessor, complement, currentRowLevel + 1, maxLevel, currentRowOffset, ddRowVariableIndices);
+                toVectorRec(dd, manager, result, rowOdd, rowNode.thenSuccessor, complement, currentRowLevel + 1, maxLevel, currentRowOffset + rowNode.elseOffset, ddRowVariableIndices);
             } else {
                 // Otherwise, we compute the ODDs for both the then- and else successors.
+                FlatOdd::Node const& rowNode = rowOdd.getNode(rowOddNode);
                 DdNode const* elseDdNode = Cudd_E_const(dd);
                 DdNode const* thenDdNode = Cudd_T_const(dd);
                 
@@ -310,8 +334,8 @@ namespace storm {
                 bool elseComplemented = Cudd_IsComplement(elseDdNode) ^ complement;
                 bool thenComplemented = Cudd_IsComplement(thenDdNode) ^ complement;
                 
-                toVectorRec(Cudd_Regular(elseDdNode), manager, result, rowOdd.getElseSuccessor(), elseComplemented, currentRowLevel + 1, maxLevel, currentRowOffset, ddRowVariableIndices);
-                toVectorRec(Cudd_Regular(thenDdNode), manager, result, rowOdd.getThenSuccessor(), thenComplemented, currentRowLevel + 1, maxLevel, currentRowOffset + rowOdd.getElseOffset(), ddRowVariableIndices);
+                toVectorRec(Cudd_Regular(elseDdNode), manager, result, rowOdd, rowNode.elseSuccessor, elseComplemented, currentRowLevel + 1, maxLevel, currentRowOffset, ddRowVariableIndices);
+                toVectorRec(Cudd_Regular(thenDdNode), manager, result, rowOdd, rowNode.thenSuccessor, thenComplemented, currentRowLevel + 1, maxLevel, currentRowOffset + rowNode.elseOffset, ddRowVariableIndices);
             }
         }
         
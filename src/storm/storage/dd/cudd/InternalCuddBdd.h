@@ -29,6 +29,7 @@ namespace storm {
         class InternalAdd;
         
         class Odd;
+        class FlatOdd;
         
         template<>
         class InternalBdd<DdType::CUDD> {
@@ -63,6 +64,16 @@ namespace storm {
              */
             static InternalBdd<storm::dd::DdType::CUDD> fromVector(InternalDdManager<DdType::CUDD> const* ddManager, Odd const& odd, std::vector<uint_fast64_t> const& sortedDdVariableIndices, std::function<bool (uint64_t)> const& filter);
             
+            /*!
+             * Computes the disjunction of the given BDDs. The BDDs are combined in a balanced tree, which tends to keep
+             * the intermediate results smaller than combining them one after another.
+             *
+             * @param ddManager The manager responsible for the BDDs.
+             * @param bdds The BDDs to combine.
+             * @return The disjunction of the BDDs.
+             */
+            static InternalBdd<storm::dd::DdType::CUDD> disjunction(InternalDdManager<DdType::CUDD> const* ddManager, std::vector<InternalBdd<DdType::CUDD>> const& bdds);
+            
             /*!
              * Retrieves whether the two BDDs represent the same function.
              *
@@ -430,14 +441,15 @@ namespace storm {
              * @param dd The DD to convert.
              * @param manager The Cudd manager responsible for the DDs.
              * @param result The vector that will hold the values upon successful completion.
-             * @param rowOdd The ODD used for the row translation.
+             * @param rowOdd The flattened ODD used for the row translation.
+             * @param rowOddNode The index of the current node of the flattened row ODD.
              * @param complement A flag indicating whether the result is to be interpreted as a complement.
              * @param currentRowLevel The currently considered row level in the DD.
              * @param maxLevel The number of levels that need to be considered.
              * @param currentRowOffset The current row offset.
              * @param ddRowVariableIndices The (sorted) indices of all DD row variables that need to be considered.
              */
-            void toVectorRec(DdNode const* dd, cudd::Cudd const& manager, storm::storage::BitVector& result, Odd const& rowOdd, bool complement, uint_fast64_t currentRowLevel, uint_fast64_t maxLevel, uint_fast64_t currentRowOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices) const;
+            void toVectorRec(DdNode const* dd, cudd::Cudd const& manager, storm::storage::BitVector& result, FlatOdd const& rowOdd, uint_fast64_t rowOddNode, bool complement, uint_fast64_t currentRowLevel, uint_fast64_t maxLevel, uint_fast64_t currentRowOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices) const;
             
             // Declare a hash functor that is used for the unique tables in the construction process of ODDs.
             class HashFunctor {
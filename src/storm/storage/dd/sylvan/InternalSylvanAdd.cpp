@@ -1,8 +1,14 @@
 #include "storm/storage/dd/sylvan/InternalSylvanAdd.h"
 
+#include <algorithm>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+
 #include "storm/storage/dd/sylvan/SylvanAddIterator.h"
 #include "storm/storage/dd/sylvan/InternalSylvanDdManager.h"
 #include "storm/storage/dd/DdManager.h"
+#include "storm/storage/dd/FlatOdd.h"
 
 #include "storm/storage/SparseMatrix.h"
 #include "storm/storage/BitVector.h"
@@ -13,10 +19,60 @@
 #include "storm/exceptions/InvalidOperationException.h"
 #include "storm/exceptions/NotSupportedException.h"
 
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+
 #include "storm-config.h"
 
+#ifdef STORM_HAVE_INTELTBB
+#include "tbb/tbb.h"
+#endif
+
 namespace storm {
     namespace dd {
+
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wzero-length-array"
+#pragma clang diagnostic ignored "-Wc99-extensions"
+#endif
+        
+        /*!
+         * Combines the given MTBDDs with the given binary operation in a balanced tree. The two halves are combined
+         * by different Lace tasks, so idle workers can steal one of them.
+         */
+        TASK_3(MTBDD, storm_mtbdd_apply_balanced, MTBDD const*, dds, size_t, count, mtbdd_apply_op, op) {
+            if (count == 1) {
+                return dds[0];
+            }
+            
+            size_t half = count / 2;
+            mtbdd_refs_spawn(SPAWN(storm_mtbdd_apply_balanced, dds, half, op));
+            MTBDD right = CALL(storm_mtbdd_apply_balanced, dds + half, count - half, op);
+            mtbdd_refs_push(right);
+            MTBDD left = mtbdd_refs_sync(SYNC(storm_mtbdd_apply_balanced));
+            mtbdd_refs_push(left);
+            MTBDD result = mtbdd_apply(left, right, op);
+            mtbdd_refs_pop(2);
+            return result;
+        }
+        
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
+        
+        template<typename ValueType>
+        sylvan::Mtbdd applyBalanced(std::vector<InternalAdd<DdType::Sylvan, ValueType>> const& adds, mtbdd_apply_op op) {
+            // The MTBDDs are protected from garbage collection by the ADDs holding them.
+            std::vector<MTBDD> dds;
+            dds.reserve(adds.size());
+            for (auto const& add : adds) {
+                dds.push_back(add.getSylvanMtbdd().GetMTBDD());
+            }
+            LACE_ME;
+            return sylvan::Mtbdd(CALL(storm_mtbdd_apply_balanced, dds.data(), dds.size(), op));
+        }
+        
         template<typename ValueType>
         InternalAdd<DdType::Sylvan, ValueType>::InternalAdd() : ddManager(nullptr), sylvanMtbdd() {
             // Intentionally left empty.
@@ -108,6 +164,32 @@ namespace storm {
         }
 #endif
 
+        template<typename ValueType>
+        InternalAdd<DdType::Sylvan, ValueType> InternalAdd<DdType::Sylvan, ValueType>::sum(InternalDdManager<DdType::Sylvan> const* ddManager, std::vector<InternalAdd<DdType::Sylvan, ValueType>> const& adds) {
+            if (adds.empty()) {
+                return ddManager->template getAddZero<ValueType>();
+            }
+            return InternalAdd<DdType::Sylvan, ValueType>(ddManager, applyBalanced(adds, TASK(mtbdd_op_plus)));
+        }
+        
+        template<>
+        InternalAdd<DdType::Sylvan, storm::RationalNumber> InternalAdd<DdType::Sylvan, storm::RationalNumber>::sum(InternalDdManager<DdType::Sylvan> const* ddManager, std::vector<InternalAdd<DdType::Sylvan, storm::RationalNumber>> const& adds) {
+            if (adds.empty()) {
+                return ddManager->template getAddZero<storm::RationalNumber>();
+            }
+            return InternalAdd<DdType::Sylvan, storm::RationalNumber>(ddManager, applyBalanced(adds, TASK(sylvan_storm_rational_number_op_plus)));
+        }
+        
+#ifdef STORM_HAVE_CARL
+		template<>
+        InternalAdd<DdType::Sylvan, storm::RationalFunction> InternalAdd<DdType::Sylvan, storm::RationalFunction>::sum(InternalDdManager<DdType::Sylvan> const* ddManager, std::vector<InternalAdd<DdType::Sylvan, storm::RationalFunction>> const& adds) {
+            if (adds.empty()) {
+                return ddManager->template getAddZero<storm::RationalFunction>();
+            }
+            return InternalAdd<DdType::Sylvan, storm::RationalFunction>(ddManager, applyBalanced(adds, TASK(sylvan_storm_rational_function_op_plus)));
+        }
+#endif
+
         template<typename ValueType>
         InternalAdd<DdType::Sylvan, ValueType>& InternalAdd<DdType::Sylvan, ValueType>::operator+=(InternalAdd<DdType::Sylvan, ValueType> const& other) {
             this->sylvanMtbdd = this->sylvanMtbdd.Plus(other.sylvanMtbdd);
@@ -884,12 +966,12 @@ namespace storm {
         
         template<typename ValueType>
         void InternalAdd<DdType::Sylvan, ValueType>::composeWithExplicitVector(storm::dd::Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices, std::vector<ValueType>& targetVector, std::function<ValueType (ValueType const&, ValueType const&)> const& function) const {
-            forEachRec(this->getSylvanMtbdd().GetMTBDD(), 0, ddVariableIndices.size(), 0, odd, ddVariableIndices, [&function, &targetVector] (uint64_t const& offset, ValueType const& value) { targetVector[offset] = function(targetVector[offset], value); });
+            forEachRec(this->getSylvanMtbdd().GetMTBDD(), 0, ddVariableIndices.size(), 0, odd.getFlatOdd(), 0, ddVariableIndices, [&function, &targetVector] (uint64_t const& offset, ValueType const& value) { targetVector[offset] = function(targetVector[offset], value); });
         }
         
         template<typename ValueType>
         void InternalAdd<DdType::Sylvan, ValueType>::composeWithExplicitVector(storm::dd::Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices, std::vector<uint_fast64_t> const& offsets, std::vector<ValueType>& targetVector, std::function<ValueType (ValueType const&, ValueType const&)> const& function) const {
-            forEachRec(this->getSylvanMtbdd().GetMTBDD(), 0, ddVariableIndices.size(), 0, odd, ddVariableIndices,  [&function, &targetVector, &offsets] (uint64_t const& offset, ValueType const& value) {
+            forEachRec(this->getSylvanMtbdd().GetMTBDD(), 0, ddVariableIndices.size(), 0, odd.getFlatOdd(), 0, ddVariableIndices,  [&function, &targetVector, &offsets] (uint64_t const& offset, ValueType const& value) {
                 ValueType& targetValue = targetVector[offsets[offset]];
                 targetValue = function(targetValue, value);
             });
@@ -897,11 +979,11 @@ namespace storm {
         
         template<typename ValueType>
         void InternalAdd<DdType::Sylvan, ValueType>::forEach(Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices, std::function<void (uint64_t const&, ValueType const&)> const& function) const {
-            forEachRec(this->getSylvanMtbdd().GetMTBDD(), 0, ddVariableIndices.size(), 0, odd, ddVariableIndices, function);
+            forEachRec(this->getSylvanMtbdd().GetMTBDD(), 0, ddVariableIndices.size(), 0, odd.getFlatOdd(), 0, ddVariableIndices, function);
         }
         
         template<typename ValueType>
-        void InternalAdd<DdType::Sylvan, ValueType>::forEachRec(MTBDD dd, uint_fast64_t currentLevel, uint_fast64_t maxLevel, uint_fast64_t currentOffset, Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices, std::function<void (uint64_t const&, ValueType const&)> const& function) const {
+        void InternalAdd<DdType::Sylvan, ValueType>::forEachRec(MTBDD dd, uint_fast64_t currentLevel, uint_fast64_t maxLevel, uint_fast64_t currentOffset, FlatOdd const& odd, uint_fast64_t oddNode, std::vector<uint_fast64_t> const& ddVariableIndices, std::function<void (uint64_t const&, ValueType const&)> const& function) const {
             // For the empty DD, we do not need to add any entries.
             if (mtbdd_isleaf(dd) && mtbdd_iszero(dd)) {
                 return;
@@ -913,15 +995,17 @@ namespace storm {
             } else if (mtbdd_isleaf(dd) || ddVariableIndices[currentLevel] < mtbdd_getvar(dd)) {
                 // If we skipped a level, we need to enumerate the explicit entries for the case in which the bit is set
                 // and for the one in which it is not set.
-                forEachRec(dd, currentLevel + 1, maxLevel, currentOffset, odd.getElseSuccessor(), ddVariableIndices, function);
-                forEachRec(dd, currentLevel + 1, maxLevel, currentOffset + odd.getElseOffset(), odd.getThenSuccessor(), ddVariableIndices, function);
+                FlatOdd::Node const& node = odd.getNode(oddNode);
+                forEachRec(dd, currentLevel + 1, maxLevel, currentOffset, odd, node.elseSuccessor, ddVariableIndices, function);
+                forEachRec(dd, currentLevel + 1, maxLevel, currentOffset + node.elseOffset, odd, node.thenSuccessor, ddVariableIndices, function);
             } else {
                 // Otherwise, we simply recursively call the function for both (different) cases.
                 MTBDD thenNode = mtbdd_gethigh(dd);
                 MTBDD elseNode = mtbdd_getlow(dd);
                 
-                forEachRec(elseNode, currentLevel + 1, maxLevel, currentOffset, odd.getElseSuccessor(), ddVariableIndices, function);
-                forEachRec(thenNode, currentLevel + 1, maxLevel, currentOffset + odd.getElseOffset(), odd.getThenSuccessor(), ddVariableIndices, function);
+                FlatOdd::Node const& node = odd.getNode(oddNode);
+                forEachRec(elseNode, currentLevel + 1, maxLevel, currentOffset, odd, node.elseSuccessor, ddVariableIndices, function);
+                forEachRec(thenNode, currentLevel + 1, maxLevel, currentOffset + node.elseOffset, odd, node.thenSuccessor, ddVariableIndices, function);
             }
         }
         
@@ -1057,11 +1141,18 @@ namespace storm {
         
         template<typename ValueType>
         void InternalAdd<DdType::Sylvan, ValueType>::toMatrixComponents(std::vector<uint_fast64_t> const& rowGroupIndices, std::vector<uint_fast64_t>& rowIndications, std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues, Odd const& rowOdd, Odd const& columnOdd, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const {
-            return toMatrixComponentsRec(mtbdd_regular(this->getSylvanMtbdd().GetMTBDD()), mtbdd_hascomp(this->getSylvanMtbdd().GetMTBDD()), rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0, ddRowVariableIndices.size() + ddColumnVariableIndices.size(), 0, 0, ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+#ifdef STORM_HAVE_INTELTBB
+            // Values of the non-arithmetic types are not copied concurrently, as their copies may share state.
+            if (std::is_arithmetic<ValueType>::value && storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
+                toMatrixComponentsParallel(rowGroupIndices, rowIndications, columnsAndValues, rowOdd.getFlatOdd(), columnOdd.getFlatOdd(), ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+                return;
+            }
+#endif
+            return toMatrixComponentsRec(mtbdd_regular(this->getSylvanMtbdd().GetMTBDD()), mtbdd_hascomp(this->getSylvanMtbdd().GetMTBDD()), rowGroupIndices, rowIndications, columnsAndValues, rowOdd.getFlatOdd(), 0, columnOdd.getFlatOdd(), 0, 0, 0, ddRowVariableIndices.size() + ddColumnVariableIndices.size(), 0, 0, ddRowVariableIndices, ddColumnVariableIndices, writeValues);
         }
         
         template<typename ValueType>
-        void InternalAdd<DdType::Sylvan, ValueType>::toMatrixComponentsRec(MTBDD dd, bool negated, std::vector<uint_fast64_t> const& rowGroupOffsets, std::vector<uint_fast64_t>& rowIndications, std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues, Odd const& rowOdd, Odd const& columnOdd, uint_fast64_t currentRowLevel, uint_fast64_t currentColumnLevel, uint_fast64_t maxLevel, uint_fast64_t currentRowOffset, uint_fast64_t currentColumnOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool generateValues) const {
+        void InternalAdd<DdType::Sylvan, ValueType>::toMatrixComponentsRec(MTBDD dd, bool negated, std::vector<uint_fast64_t> const& rowGroupOffsets, std::vector<uint_fast64_t>& rowIndications, std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues, FlatOdd const& rowOdd, uint_fast64_t rowOddNode, FlatOdd const& columnOdd, uint_fast64_t columnOddNode, uint_fast64_t currentRowLevel, uint_fast64_t currentColumnLevel, uint_fast64_t maxLevel, uint_fast64_t currentRowOffset, uint_fast64_t currentColumnOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool generateValues) const {
             // For the empty DD, we do not need to add any entries.
             if (mtbdd_isleaf(dd) && mtbdd_iszero(dd)) {
                 return;
@@ -1102,15 +1193,120 @@ namespace storm {
                     }
                 }
                 
+                FlatOdd::Node const& rowNode = rowOdd.getNode(rowOddNode);
+                FlatOdd::Node const& columnNode = columnOdd.getNode(columnOddNode);
+                
                 // Visit else-else.
-                toMatrixComponentsRec(mtbdd_regular(elseElse), mtbdd_hascomp(elseElse) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getElseSuccessor(), columnOdd.getElseSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset, currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, generateValues);
+                toMatrixComponentsRec(mtbdd_regular(elseElse), mtbdd_hascomp(elseElse) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd, rowNode.elseSuccessor, columnOdd, columnNode.elseSuccessor, currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset, currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, generateValues);
                 // Visit else-then.
-                toMatrixComponentsRec(mtbdd_regular(elseThen), mtbdd_hascomp(elseThen) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getElseSuccessor(), columnOdd.getThenSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset, currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices, generateValues);
+                toMatrixComponentsRec(mtbdd_regular(elseThen), mtbdd_hascomp(elseThen) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd, rowNode.elseSuccessor, columnOdd, columnNode.thenSuccessor, currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset, currentColumnOffset + columnNode.elseOffset, ddRowVariableIndices, ddColumnVariableIndices, generateValues);
                 // Visit then-else.
-                toMatrixComponentsRec(mtbdd_regular(thenElse), mtbdd_hascomp(thenElse) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getThenSuccessor(), columnOdd.getElseSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, generateValues);
+                toMatrixComponentsRec(mtbdd_regular(thenElse), mtbdd_hascomp(thenElse) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd, rowNode.thenSuccessor, columnOdd, columnNode.elseSuccessor, currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset + rowNode.elseOffset, currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, generateValues);
                 // Visit then-then.
-                toMatrixComponentsRec(mtbdd_regular(thenThen), mtbdd_hascomp(thenThen) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getThenSuccessor(), columnOdd.getThenSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices, generateValues);
+                toMatrixComponentsRec(mtbdd_regular(thenThen), mtbdd_hascomp(thenThen) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd, rowNode.thenSuccessor, columnOdd, columnNode.thenSuccessor, currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset + rowNode.elseOffset, currentColumnOffset + columnNode.elseOffset, ddRowVariableIndices, ddColumnVariableIndices, generateValues);
+            }
+        }
+        
+        template<typename ValueType>
+        void InternalAdd<DdType::Sylvan, ValueType>::toMatrixComponentsParallel(std::vector<uint_fast64_t> const& rowGroupOffsets, std::vector<uint_fast64_t>& rowIndications, std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues, FlatOdd const& rowOdd, FlatOdd const& columnOdd, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const {
+            // A (regular) part of the DD together with its complement flag, the (index of the) column ODD node and
+            // column offset it is to be traversed with.
+            typedef std::tuple<MTBDD, bool, uint_fast64_t, uint_fast64_t> MatrixPart;
+            
+            // A set of rows given by a node of the row ODD together with the parts of the DD whose entries lie in these rows.
+            struct RowBlock {
+                uint_fast64_t rowOddNode;
+                uint_fast64_t rowOffset;
+                std::vector<MatrixPart> parts;
+            };
+            
+            uint_fast64_t maxLevel = ddRowVariableIndices.size() + ddColumnVariableIndices.size();
+            uint_fast64_t numberOfBlocks = 8 * std::max(1u, std::thread::hardware_concurrency());
+            
+            // Split the rows along the topmost levels until there are enough blocks to balance the load. Splitting
+            // descends into the DD in the same way as toMatrixComponentsRec.
+            MTBDD root = this->getSylvanMtbdd().GetMTBDD();
+            std::vector<RowBlock> blocks = {{0, 0, {MatrixPart(mtbdd_regular(root), mtbdd_hascomp(root), 0, 0)}}};
+            uint_fast64_t level = 0;
+            for (; level < ddRowVariableIndices.size() && blocks.size() < numberOfBlocks; ++level) {
+                std::vector<RowBlock> nextBlocks;
+                for (auto const& block : blocks) {
+                    FlatOdd::Node const& rowNode = rowOdd.getNode(block.rowOddNode);
+                    RowBlock elseBlock = {rowNode.elseSuccessor, block.rowOffset, {}};
+                    RowBlock thenBlock = {rowNode.thenSuccessor, block.rowOffset + rowNode.elseOffset, {}};
+                    
+                    for (auto const& part : block.parts) {
+                        MTBDD dd = std::get<0>(part);
+                        bool negated = std::get<1>(part);
+                        FlatOdd::Node const& columnNode = columnOdd.getNode(std::get<2>(part));
+                        uint_fast64_t columnOffset = std::get<3>(part);
+                        
+                        MTBDD elseElse;
+                        MTBDD elseThen;
+                        MTBDD thenElse;
+                        MTBDD thenThen;
+                        if (mtbdd_isleaf(dd) || ddColumnVariableIndices[level] < mtbdd_getvar(dd)) {
+                            elseElse = elseThen = thenElse = thenThen = dd;
+                        } else if (ddRowVariableIndices[level] < mtbdd_getvar(dd)) {
+                            elseElse = thenElse = mtbdd_getlow(dd);
+                            elseThen = thenThen = mtbdd_gethigh(dd);
+                        } else {
+                            MTBDD elseNode = mtbdd_getlow(dd);
+                            if (mtbdd_isleaf(elseNode) || ddColumnVariableIndices[level] < mtbdd_getvar(elseNode)) {
+                                elseElse = elseThen = elseNode;
+                            } else {
+                                elseElse = mtbdd_getlow(elseNode);
+                                elseThen = mtbdd_gethigh(elseNode);
+                            }
+                            
+                            MTBDD thenNode = mtbdd_gethigh(dd);
+                            if (mtbdd_isleaf(thenNode) || ddColumnVariableIndices[level] < mtbdd_getvar(thenNode)) {
+                                thenElse = thenThen = thenNode;
+                            } else {
+                                thenElse = mtbdd_getlow(thenNode);
+                                thenThen = mtbdd_gethigh(thenNode);
+                            }
+                        }
+                        
+                        auto addPart = [negated] (RowBlock& targetBlock, MTBDD child, uint_fast64_t childColumnOddNode, uint_fast64_t childColumnOffset) {
+                            MTBDD regularChild = mtbdd_regular(child);
+                            if (!mtbdd_isleaf(regularChild) || !mtbdd_iszero(regularChild)) {
+                                targetBlock.parts.emplace_back(regularChild, mtbdd_hascomp(child) ^ negated, childColumnOddNode, childColumnOffset);
+                            }
+                        };
+                        addPart(elseBlock, elseElse, columnNode.elseSuccessor, columnOffset);
+                        addPart(elseBlock, elseThen, columnNode.thenSuccessor, columnOffset + columnNode.elseOffset);
+                        addPart(thenBlock, thenElse, columnNode.elseSuccessor, columnOffset);
+                        addPart(thenBlock, thenThen, columnNode.thenSuccessor, columnOffset + columnNode.elseOffset);
+                    }
+                    
+                    if (!elseBlock.parts.empty()) {
+                        nextBlocks.push_back(std::move(elseBlock));
+                    }
+                    if (!thenBlock.parts.empty()) {
+                        nextBlocks.push_back(std::move(thenBlock));
+                    }
+                }
+                blocks = std::move(nextBlocks);
             }
+            
+            // Since the blocks cover disjoint rows, they write disjoint parts of the row indications and entries. The
+            // parts of a block are ordered by their columns, so the entries of each row remain sorted.
+            auto processBlocks = [&] (uint_fast64_t begin, uint_fast64_t end) {
+                for (uint_fast64_t blockIndex = begin; blockIndex < end; ++blockIndex) {
+                    RowBlock const& block = blocks[blockIndex];
+                    for (auto const& part : block.parts) {
+                        toMatrixComponentsRec(std::get<0>(part), std::get<1>(part), rowGroupOffsets, rowIndications, columnsAndValues, rowOdd, block.rowOddNode, columnOdd, std::get<2>(part), level, level, maxLevel, block.rowOffset, std::get<3>(part), ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+                    }
+                }
+            };
+#ifdef STORM_HAVE_INTELTBB
+            tbb::parallel_for(tbb::blocked_range<uint_fast64_t>(0, blocks.size()), [&processBlocks] (tbb::blocked_range<uint_fast64_t> const& range) {
+                processBlocks(range.begin(), range.end());
+            });
+#else
+            processBlocks(0, blocks.size());
+#endif
         }
         
         template<typename ValueType>
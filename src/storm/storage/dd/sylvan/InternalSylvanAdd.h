@@ -619,6 +619,16 @@ namespace storm {
              */
             static InternalAdd<DdType::Sylvan, ValueType> fromVector(InternalDdManager<DdType::Sylvan> const* ddManager, std::vector<ValueType> const& values, storm::dd::Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices);
             
+            /*!
+             * Computes the sum of the given ADDs. The ADDs are summed in a balanced tree whose independent subtrees
+             * are evaluated in parallel by the Lace workers of Sylvan.
+             *
+             * @param ddManager The manager responsible for the ADDs.
+             * @param adds The ADDs to sum.
+             * @return The sum of the ADDs.
+             */
+            static InternalAdd<DdType::Sylvan, ValueType> sum(InternalDdManager<DdType::Sylvan> const* ddManager, std::vector<InternalAdd<DdType::Sylvan, ValueType>> const& adds);
+            
             /*!
              * Creates an ODD based on the current ADD.
              *
@@ -665,12 +675,13 @@ namespace storm {
              * @param currentLevel The currently considered level in the DD.
              * @param maxLevel The number of levels that need to be considered.
              * @param currentOffset The current offset.
-             * @param odd The ODD used for the translation.
+             * @param odd The flattened ODD used for the translation.
+             * @param oddNode The index of the current node of the flattened ODD.
              * @param ddVariableIndices The (sorted) indices of all DD variables that need to be considered.
              * @param function The callback invoked for every element. The first argument is the offset and the second
              * is the value.
              */
-            void forEachRec(MTBDD dd, uint_fast64_t currentLevel, uint_fast64_t maxLevel, uint_fast64_t currentOffset, Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices, std::function<void (uint64_t const&, ValueType const&)> const& function) const;
+            void forEachRec(MTBDD dd, uint_fast64_t currentLevel, uint_fast64_t maxLevel, uint_fast64_t currentOffset, FlatOdd const& odd, uint_fast64_t oddNode, std::vector<uint_fast64_t> const& ddVariableIndices, std::function<void (uint64_t const&, ValueType const&)> const& function) const;
             
             /*!
              * Splits the given matrix DD into the labelings of the gropus using the given group variables.
@@ -740,8 +751,10 @@ namespace storm {
              * @param columnsAndValues The vector that will hold the columns and values of non-zero entries upon successful
              * completion.
              * @param rowGroupOffsets The row offsets at which a given row group starts.
-             * @param rowOdd The ODD used for the row translation.
-             * @param columnOdd The ODD used for the column translation.
+             * @param rowOdd The flattened ODD used for the row translation.
+             * @param rowOddNode The index of the current node of the flattened row ODD.
+             * @param columnOdd The flattened ODD used for the column translation.
+             * @param columnOddNode The index of the current node of the flattened column ODD.
              * @param currentRowLevel The currently considered row level in the DD.
              * @param currentColumnLevel The currently considered row level in the DD.
              * @param maxLevel The number of levels that need to be considered.
@@ -753,7 +766,16 @@ namespace storm {
              * only works if the offsets given in rowIndications are already correct. If they need to be computed first,
              * this flag needs to be false.
              */
-            void toMatrixComponentsRec(MTBDD dd, bool negated, std::vector<uint_fast64_t> const& rowGroupOffsets, std::vector<uint_fast64_t>& rowIndications, std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues, Odd const& rowOdd, Odd const& columnOdd, uint_fast64_t currentRowLevel, uint_fast64_t currentColumnLevel, uint_fast64_t maxLevel, uint_fast64_t currentRowOffset, uint_fast64_t currentColumnOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const;
+            void toMatrixComponentsRec(MTBDD dd, bool negated, std::vector<uint_fast64_t> const& rowGroupOffsets, std::vector<uint_fast64_t>& rowIndications, std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues, FlatOdd const& rowOdd, uint_fast64_t rowOddNode, FlatOdd const& columnOdd, uint_fast64_t columnOddNode, uint_fast64_t currentRowLevel, uint_fast64_t currentColumnLevel, uint_fast64_t maxLevel, uint_fast64_t currentRowOffset, uint_fast64_t currentColumnOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const;
+            
+            /*!
+             * Performs the same task as toMatrixComponents, but first splits the rows along the topmost levels of the
+             * flattened row ODD into blocks of disjoint rows. The blocks are then counted/filled concurrently (if Storm was built
+             * with support for TBB), each one with a sequential traversal of the parts of the DD that belong to it.
+             *
+             * The parameters are the same as for toMatrixComponents.
+             */
+            void toMatrixComponentsParallel(std::vector<uint_fast64_t> const& rowGroupOffsets, std::vector<uint_fast64_t>& rowIndications, std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues, FlatOdd const& rowOdd, FlatOdd const& columnOdd, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const;
             
             /*!
              * Retrieves the sylvan representation of the given double value.
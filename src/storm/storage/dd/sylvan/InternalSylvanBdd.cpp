@@ -5,6 +5,8 @@
 #include "storm/storage/dd/sylvan/InternalSylvanDdManager.h"
 #include "storm/storage/dd/sylvan/InternalSylvanAdd.h"
 #include "storm/storage/dd/sylvan/SylvanAddIterator.h"
+#include "storm/storage/dd/Odd.h"
+#include "storm/storage/dd/FlatOdd.h"
 
 #include "storm/storage/BitVector.h"
 #include "storm/storage/PairHash.h"
@@ -18,6 +20,37 @@
 
 namespace storm {
     namespace dd {
+
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wzero-length-array"
+#pragma clang diagnostic ignored "-Wc99-extensions"
+#endif
+        
+        /*!
+         * Computes the disjunction of the given BDDs in a balanced tree. The two halves are combined by different Lace
+         * tasks, so idle workers can steal one of them.
+         */
+        TASK_2(BDD, storm_sylvan_or_balanced, BDD const*, dds, size_t, count) {
+            if (count == 1) {
+                return dds[0];
+            }
+            
+            size_t half = count / 2;
+            bdd_refs_spawn(SPAWN(storm_sylvan_or_balanced, dds, half));
+            BDD right = CALL(storm_sylvan_or_balanced, dds + half, count - half);
+            bdd_refs_push(right);
+            BDD left = bdd_refs_sync(SYNC(storm_sylvan_or_balanced));
+            bdd_refs_push(left);
+            BDD result = sylvan_or(left, right);
+            bdd_refs_pop(2);
+            return result;
+        }
+        
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
+        
         InternalBdd<DdType::Sylvan>::InternalBdd() : ddManager(nullptr), sylvanBdd() {
             // Intentionally left empty.
         }
@@ -31,6 +64,21 @@ namespace storm {
             return InternalBdd<DdType::Sylvan>(ddManager, sylvan::Bdd(fromVectorRec(offset, 0, sortedDdVariableIndices.size(), odd, sortedDdVariableIndices, filter)));
         }
         
+        InternalBdd<DdType::Sylvan> InternalBdd<DdType::Sylvan>::disjunction(InternalDdManager<DdType::Sylvan> const* ddManager, std::vector<InternalBdd<DdType::Sylvan>> const& bdds) {
+            if (bdds.empty()) {
+                return ddManager->getBddZero();
+            }
+            
+            // The BDDs are protected from garbage collection by the wrappers holding them.
+            std::vector<BDD> dds;
+            dds.reserve(bdds.size());
+            for (auto const& bdd : bdds) {
+                dds.push_back(bdd.getSylvanBdd().GetBDD());
+            }
+            LACE_ME;
+            return InternalBdd<DdType::Sylvan>(ddManager, sylvan::Bdd(CALL(storm_sylvan_or_balanced, dds.data(), dds.size())));
+        }
+        
         BDD InternalBdd<DdType::Sylvan>::fromVectorRec(uint_fast64_t& currentOffset, uint_fast64_t currentLevel, uint_fast64_t maxLevel, Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices, std::function<bool (uint64_t)> const& filter) {
             if (currentLevel == maxLevel) {
                 // If we are in a terminal node of the ODD, we need to check whether the then-offset of the ODD is one
@@ -268,11 +316,11 @@ namespace storm {
         
         storm::storage::BitVector InternalBdd<DdType::Sylvan>::toVector(storm::dd::Odd const& rowOdd, std::vector<uint_fast64_t> const& ddVariableIndices) const {
             storm::storage::BitVector result(rowOdd.getTotalOffset());
-            this->toVectorRec(bdd_regular(this->getSylvanBdd().GetBDD()), result, rowOdd, bdd_isnegated(this->getSylvanBdd().GetBDD()), 0, ddVariableIndices.size(), 0, ddVariableIndices);
+            this->toVectorRec(bdd_regular(this->getSylvanBdd().GetBDD()), result, rowOdd.getFlatOdd(), 0, bdd_isnegated(this->getSylvanBdd().GetBDD()), 0, ddVariableIndices.size(), 0, ddVariableIndices);
             return result;
         }
         
-        void InternalBdd<DdType::Sylvan>::toVectorRec(BDD dd, storm::storage::BitVector& result, Odd const& rowOdd, bool complement, uint_fast64_t currentRowLevel, uint_fast64_t maxLevel, uint_fast64_t currentRowOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices) const {
+        void InternalBdd<DdType::Sylvan>::toVectorRec(BDD dd, storm::storage::BitVector& result, FlatOdd const& rowOdd, uint_fast64_t rowOddNode, bool complement, uint_fast64_t currentRowLevel, uint_fast64_t maxLevel, uint_fast64_t currentRowOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices) const {
             // If there are no more values to select, we can directly return.
             if (dd == sylvan_false && !complement) {
                 return;
@@ -284,10 +332,12 @@ namespace storm {
             if (currentRowLevel == maxLevel) {
                 result.set(currentRowOffset, true);
             } else if (bdd_isterminal(dd) || ddRowVariableIndices[currentRowLevel] < sylvan_var(dd)) {
-                toVectorRec(dd, result, rowOdd.getElseSuccessor(), complement, currentRowLevel + 1, maxLevel, currentRowOffset, ddRowVariableIndices);
-                toVectorRec(dd, result, rowOdd.getThenSuccessor(), complement, currentRowLevel + 1, maxLevel, currentRowOffset + rowOdd.getElseOffset(), ddRowVariableIndices);
+                FlatOdd::Node const& rowNode = rowOdd.getNode(rowOddNode);
+                toVectorRec(dd, result, rowOdd, rowNode.elseSuccessor, complement, currentRowLevel + 1, maxLevel, currentRowOffset, ddRowVariableIndices);
+                toVectorRec(dd, result, rowOdd, rowNode.thenSuccessor, complement, currentRowLevel + 1, maxLevel, currentRowOffset + rowNode.elseOffset, ddRowVariableIndices);
             } else {
                 // Otherwise, we compute the ODDs for both the then- and else successors.
+                FlatOdd::Node const& rowNode = rowOdd.getNode(rowOddNode);
                 BDD elseDdNode = sylvan_low(dd);
                 BDD thenDdNode = sylvan_high(dd);
                 
@@ -295,8 +345,8 @@ namespace storm {
                 bool elseComplemented = bdd_isnegated(elseDdNode) ^ complement;
                 bool thenComplemented = bdd_isnegated(thenDdNode) ^ complement;
                 
-                toVectorRec(bdd_regular(elseDdNode), result, rowOdd.getElseSuccessor(), elseComplemented, currentRowLevel + 1, maxLevel, currentRowOffset, ddRowVariableIndices);
-                toVectorRec(bdd_regular(thenDdNode), result, rowOdd.getThenSuccessor(), thenComplemented, currentRowLevel + 1, maxLevel, currentRowOffset + rowOdd.getElseOffset(), ddRowVariableIndices);
+                toVectorRec(bdd_regular(elseDdNode), result, rowOdd, rowNode.elseSuccessor, elseComplemented, currentRowLevel + 1, maxLevel, currentRowOffset, ddRowVariableIndices);
+                toVectorRec(bdd_regular(thenDdNode), result, rowOdd, rowNode.thenSuccessor, thenComplemented, currentRowLevel + 1, maxLevel, currentRowOffset + rowNode.elseOffset, ddRowVariableIndices);
             }
         }
         
@@ -25,6 +25,7 @@ namespace storm {
         class InternalDdManager;
         
         class Odd;
+        class FlatOdd;
         
         template<>
         class InternalBdd<DdType::Sylvan> {
@@ -52,6 +53,16 @@ namespace storm {
              */
             static InternalBdd<storm::dd::DdType::Sylvan> fromVector(InternalDdManager<DdType::Sylvan> const* ddManager, Odd const& odd, std::vector<uint_fast64_t> const& sortedDdVariableIndices, std::function<bool (uint64_t)> const& filter);
             
+            /*!
+             * Computes the disjunction of the given BDDs. The BDDs are combined in a balanced tree whose independent
+             * subtrees are evaluated in parallel by the Lace workers of Sylvan.
+             *
+             * @param ddManager The manager responsible for the BDDs.
+             * @param bdds The BDDs to combine.
+             * @return The disjunction of the BDDs.
+             */
+            static InternalBdd<storm::dd::DdType::Sylvan> disjunction(InternalDdManager<DdType::Sylvan> const* ddManager, std::vector<InternalBdd<DdType::Sylvan>> const& bdds);
+            
             /*!
              * Retrieves whether the two BDDs represent the same function.
              *
@@ -437,14 +448,15 @@ namespace storm {
              *
              * @param dd The DD to convert.
              * @param result The vector that will hold the values upon successful completion.
-             * @param rowOdd The ODD used for the row translation.
+             * @param rowOdd The flattened ODD used for the row translation.
+             * @param rowOddNode The index of the current node of the flattened row ODD.
              * @param complement A flag indicating whether the result is to be interpreted as a complement.
              * @param currentRowLevel The currently considered row level in the DD.
              * @param maxLevel The number of levels that need to be considered.
              * @param currentRowOffset The current row offset.
              * @param ddRowVariableIndices The (sorted) indices of all DD row variables that need to be considered.
              */
-            void toVectorRec(BDD dd, storm::storage::BitVector& result, Odd const& rowOdd, bool complement, uint_fast64_t currentRowLevel, uint_fast64_t maxLevel, uint_fast64_t currentRowOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices) const;
+            void toVectorRec(BDD dd, storm::storage::BitVector& result, FlatOdd const& rowOdd, uint_fast64_t rowOddNode, bool complement, uint_fast64_t currentRowLevel, uint_fast64_t maxLevel, uint_fast64_t currentRowOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices) const;
             
             /*!
              * Adds the selected values the target vector.
@@ -71,6 +71,35 @@ namespace storm {
             return result;
         }
         
+        std::set<storm::expressions::Variable> Module::getReadVariables() const {
+            std::set<storm::expressions::Variable> result;
+            for (auto const& command : this->getCommands()) {
+                std::set<storm::expressions::Variable> variables = command.getGuardExpression().getVariables();
+                result.insert(variables.begin(), variables.end());
+                for (auto const& update : command.getUpdates()) {
+                    variables = update.getLikelihoodExpression().getVariables();
+                    result.insert(variables.begin(), variables.end());
+                    for (auto const& assignment : update.getAssignments()) {
+                        variables = assignment.getExpression().getVariables();
+                        result.insert(variables.begin(), variables.end());
+                    }
+                }
+            }
+            return result;
+        }
+        
+        std::set<storm::expressions::Variable> Module::getWrittenVariables() const {
+            std::set<storm::expressions::Variable> result;
+            for (auto const& command : this->getCommands()) {
+                for (auto const& update : command.getUpdates()) {
+                    for (auto const& assignment : update.getAssignments()) {
+                        result.insert(assignment.getVariable());
+                    }
+                }
+            }
+            return result;
+        }
+        
         std::vector<storm::expressions::Expression> Module::getAllRangeExpressions() const {
             std::vector<storm::expressions::Expression> result;
             for (auto const& integerVariable : this->integerVariables) {
@@ -129,6 +129,21 @@ namespace storm {
              */
             std::set<storm::expressions::Variable> getAllExpressionVariables() const;
             
+            /*!
+             * Retrieves all variables that are read by the commands of this module, i.e., that appear in guards,
+             * probabilities or the right-hand sides of assignments.
+             *
+             * @return The set of variables read by this module.
+             */
+            std::set<storm::expressions::Variable> getReadVariables() const;
+            
+            /*!
+             * Retrieves all variables that are written by the commands of this module.
+             *
+             * @return The set of variables written by this module.
+             */
+            std::set<storm::expressions::Variable> getWrittenVariables() const;
+            
             /*!
              * Retrieves a list of expressions that characterize the legal ranges of all variables declared by this
              * module.
@@ -6,6 +6,7 @@
 #include "storm/models/sparse/MarkovAutomaton.h"
 
 #include "storm/exceptions/UnexpectedException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 
 namespace  storm {
     namespace transformer {
@@ -39,6 +40,25 @@ namespace  storm {
             }
         }
 
+        template <typename ValueType, typename RewardModelType>
+        std::shared_ptr<storm::models::sparse::NondeterministicModel<ValueType, RewardModelType>> ChoiceSelector<ValueType, RewardModelType>::transform(storm::storage::Scheduler<ValueType> const& scheduler) const {
+            STORM_LOG_THROW(scheduler.isMemorylessScheduler(), storm::exceptions::InvalidArgumentException, "Choice selection requires a memoryless scheduler.");
+            STORM_LOG_THROW(scheduler.getNumberOfModelStates() == inputModel.getNumberOfStates(), storm::exceptions::InvalidArgumentException, "The given scheduler is not compatible with the model.");
+            
+            std::vector<uint_fast64_t> const& rowGroupIndices = inputModel.getTransitionMatrix().getRowGroupIndices();
+            storm::storage::BitVector enabledActions = scheduler.computeActionSupport(rowGroupIndices);
+            if (scheduler.isPartialScheduler()) {
+                for (uint_fast64_t state = 0; state < inputModel.getNumberOfStates(); ++state) {
+                    if (!scheduler.isChoiceDefined(state)) {
+                        for (uint_fast64_t choice = rowGroupIndices[state]; choice < rowGroupIndices[state + 1]; ++choice) {
+                            enabledActions.set(choice);
+                        }
+                    }
+                }
+            }
+            return transform(enabledActions);
+        }
+
         template class ChoiceSelector<double>;
         template class ChoiceSelector<storm::RationalNumber>;
     }
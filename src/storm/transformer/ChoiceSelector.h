@@ -2,6 +2,7 @@
 
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/models/sparse/NondeterministicModel.h"
+#include "storm/storage/Scheduler.h"
 
 
 namespace storm {
@@ -21,6 +22,15 @@ namespace storm {
              * @return A subMDP.
             */
             std::shared_ptr<storm::models::sparse::NondeterministicModel<ValueType, RewardModelType>> transform(storm::storage::BitVector const& enabledActions) const;
+            
+            /*!
+             * Constructs an MDP by copying the current MDP and restricting the choices of each state to the ones selected by the given memoryless scheduler.
+             * States for which the scheduler does not define a choice keep all their choices.
+             *
+             * @param scheduler A memoryless scheduler for the input model.
+             * @return A subMDP.
+             */
+            std::shared_ptr<storm::models::sparse::NondeterministicModel<ValueType, RewardModelType>> transform(storm::storage::Scheduler<ValueType> const& scheduler) const;
         private:
 
             storm::models::sparse::NondeterministicModel<ValueType, RewardModelType> const& inputModel;
@@ -0,0 +1,198 @@
+#include "storm/utility/Profiler.h"
+
+#include <algorithm>
+#include <fstream>
+
+#include "storm/utility/macros.h"
+#include "storm/utility/file.h"
+
+#include "storm/exceptions/InvalidOperationException.h"
+
+namespace storm {
+    namespace utility {
+
+        Profiler::Phase::Phase(std::string const& name) : name(name), calls(0), time(std::chrono::nanoseconds::zero()) {
+            // Intentionally left empty.
+        }
+
+        modernjson::json Profiler::Phase::toJson() const {
+            modernjson::json result;
+            result["name"] = name;
+            result["calls"] = calls;
+            result["time-ms"] = std::chrono::duration_cast<std::chrono::microseconds>(time).count() / 1000.0;
+            if (!counters.empty()) {
+                result["counters"] = counters;
+            }
+            if (!children.empty()) {
+                modernjson::json childPhases = modernjson::json::array();
+                for (auto const& child : children) {
+                    childPhases.push_back(child->toJson());
+                }
+                result["phases"] = childPhases;
+            }
+            return result;
+        }
+
+        Profiler::Profiler() : enabled(false), epoch(std::chrono::high_resolution_clock::now()) {
+            // Intentionally left empty.
+        }
+
+        Profiler& Profiler::getInstance() {
+            static Profiler profiler;
+            return profiler;
+        }
+
+        void Profiler::setEnabled(bool enabled) {
+            this->enabled.store(enabled, std::memory_order_relaxed);
+        }
+
+        Profiler::ThreadData& Profiler::getThreadData() {
+            auto id = std::this_thread::get_id();
+            auto it = threads.find(id);
+            if (it == threads.end()) {
+                ThreadData data;
+                data.index = threads.size();
+                data.root = std::make_unique<Phase>(data.index == 0 ? "main" : "thread " + std::to_string(data.index));
+                it = threads.emplace(id, std::move(data)).first;
+            }
+            return it->second;
+        }
+
+        void Profiler::enterPhase(std::string const& name) {
+            std::lock_guard<std::mutex> lock(mutex);
+            ThreadData& data = getThreadData();
+            Phase* parent = data.stack.empty() ? data.root.get() : data.stack.back().phase;
+
+            auto childIt = std::find_if(parent->children.begin(), parent->children.end(), [&name] (std::unique_ptr<Phase> const& child) { return child->name == name; });
+            Phase* phase;
+            if (childIt == parent->children.end()) {
+                parent->children.push_back(std::make_unique<Phase>(name));
+                phase = parent->children.back().get();
+            } else {
+                phase = childIt->get();
+            }
+            ++phase->calls;
+            data.stack.push_back({phase, std::chrono::high_resolution_clock::now()});
+        }
+
+        void Profiler::leavePhase() {
+            auto end = std::chrono::high_resolution_clock::now();
+            std::lock_guard<std::mutex> lock(mutex);
+            ThreadData& data = getThreadData();
+            if (data.stack.empty()) {
+                // This happens if the profiler was reset while phases were active.
+                STORM_LOG_WARN("Cannot leave a phase of the profiler as no phase is active.");
+                return;
+            }
+
+            ActivePhase const& active = data.stack.back();
+            auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - active.start);
+            active.phase->time += duration;
+            traceEvents.push_back({active.phase->name, data.index, active.start, duration});
+            data.stack.pop_back();
+        }
+
+        void Profiler::addToCounter(std::string const& name, uint64_t value) {
+            std::lock_guard<std::mutex> lock(mutex);
+            ThreadData& data = getThreadData();
+            Phase* phase = data.stack.empty() ? data.root.get() : data.stack.back().phase;
+            phase->counters[name] += value;
+            counters[name] += value;
+        }
+
+        uint64_t Profiler::getCounter(std::string const& name) const {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto it = counters.find(name);
+            return it == counters.end() ? 0 : it->second;
+        }
+
+        modernjson::json Profiler::toJson() const {
+            std::lock_guard<std::mutex> lock(mutex);
+            std::vector<ThreadData const*> sortedThreads;
+            for (auto const& thread : threads) {
+                sortedThreads.push_back(&thread.second);
+            }
+            std::sort(sortedThreads.begin(), sortedThreads.end(), [] (ThreadData const* first, ThreadData const* second) { return first->index < second->index; });
+
+            modernjson::json result;
+            result["counters"] = counters;
+            modernjson::json threadPhases = modernjson::json::array();
+            for (auto const& thread : sortedThreads) {
+                threadPhases.push_back(thread->root->toJson());
+            }
+            result["threads"] = threadPhases;
+            return result;
+        }
+
+        modernjson::json Profiler::toChromeTrace() const {
+            std::lock_guard<std::mutex> lock(mutex);
+            modernjson::json events = modernjson::json::array();
+            for (auto const& event : traceEvents) {
+                modernjson::json traceEvent;
+                traceEvent["name"] = event.name;
+                traceEvent["ph"] = "X";
+                traceEvent["pid"] = 0;
+                traceEvent["tid"] = event.thread;
+                traceEvent["ts"] = std::chrono::duration_cast<std::chrono::microseconds>(event.start - epoch).count();
+                traceEvent["dur"] = std::chrono::duration_cast<std::chrono::microseconds>(event.duration).count();
+                events.push_back(traceEvent);
+            }
+            // Report the final value of each counter as a counter event at the end of the trace.
+            auto end = std::chrono::high_resolution_clock::now();
+            for (auto const& counter : counters) {
+                modernjson::json counterEvent;
+                counterEvent["name"] = counter.first;
+                counterEvent["ph"] = "C";
+                counterEvent["pid"] = 0;
+                counterEvent["ts"] = std::chrono::duration_cast<std::chrono::microseconds>(end - epoch).count();
+                counterEvent["args"]["value"] = counter.second;
+                events.push_back(counterEvent);
+            }
+
+            modernjson::json result;
+            result["traceEvents"] = events;
+            result["displayTimeUnit"] = "ms";
+            return result;
+        }
+
+        void Profiler::exportToJson(std::string const& filename) const {
+            std::ofstream stream;
+            storm::utility::openFile(filename, stream);
+            stream << toJson().dump(4) << std::endl;
+            storm::utility::closeFile(stream);
+        }
+
+        void Profiler::exportToChromeTrace(std::string const& filename) const {
+            std::ofstream stream;
+            storm::utility::openFile(filename, stream);
+            stream << toChromeTrace().dump() << std::endl;
+            storm::utility::closeFile(stream);
+        }
+
+        void Profiler::printSummary(std::ostream& out) const {
+            std::lock_guard<std::mutex> lock(mutex);
+            for (auto const& thread : threads) {
+                if (thread.second.index != 0) {
+                    continue;
+                }
+                for (auto const& phase : thread.second.root->children) {
+                    out << "  * " << phase->name << ": " << std::chrono::duration_cast<std::chrono::milliseconds>(phase->time).count() << "ms" << std::endl;
+                }
+            }
+            for (auto const& counter : counters) {
+                out << "  * " << counter.first << ": " << counter.second << std::endl;
+            }
+        }
+
+        void Profiler::reset() {
+            std::lock_guard<std::mutex> lock(mutex);
+            for (auto const& thread : threads) {
+                STORM_LOG_THROW(thread.second.stack.empty(), storm::exceptions::InvalidOperationException, "Cannot reset the profiler while phases are active.");
+            }
+            threads.clear();
+            counters.clear();
+            traceEvents.clear();
+            epoch = std::chrono::high_resolution_clock::now();
+        }
+    }
+}
@@ -0,0 +1,205 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// JSON parser
+#include "json.hpp"
+namespace modernjson {
+    using json = nlohmann::json;
+}
+
+namespace storm {
+    namespace utility {
+
+        /*!
+         * Collects nested phase timings and counters of a run. Each thread maintains its own stack of active phases,
+         * so phases that are entered by worker threads are reported separately from the ones of the main thread.
+         * Unless the profiler is enabled, entering phases and updating counters does not have any effect.
+         */
+        class Profiler {
+        public:
+            /*!
+             * Retrieves the profiler of this process.
+             */
+            static Profiler& getInstance();
+
+            /*!
+             * Sets whether measurements are to be collected.
+             */
+            void setEnabled(bool enabled);
+
+            /*!
+             * Retrieves whether measurements are collected.
+             */
+            bool isEnabled() const {
+                return enabled.load(std::memory_order_relaxed);
+            }
+
+            /*!
+             * Enters a phase with the given name as a child of the innermost active phase of the calling thread.
+             */
+            void enterPhase(std::string const& name);
+
+            /*!
+             * Leaves the innermost active phase of the calling thread.
+             */
+            void leavePhase();
+
+            /*!
+             * Adds the given value to the counter with the given name. The value is attributed to the innermost active
+             * phase of the calling thread as well as to the total of the counter.
+             */
+            void addToCounter(std::string const& name, uint64_t value);
+
+            /*!
+             * Retrieves the total value of the given counter.
+             */
+            uint64_t getCounter(std::string const& name) const;
+
+            /*!
+             * Retrieves the phases and counters as a json structure.
+             */
+            modernjson::json toJson() const;
+
+            /*!
+             * Retrieves the phases as a trace in the Chrome trace event format.
+             */
+            modernjson::json toChromeTrace() const;
+
+            /*!
+             * Writes the phases and counters to the given file.
+             */
+            void exportToJson(std::string const& filename) const;
+
+            /*!
+             * Writes the phases to the given file in the Chrome trace event format (loadable via chrome://tracing).
+             */
+            void exportToChromeTrace(std::string const& filename) const;
+
+            /*!
+             * Prints the time spent in the top-level phases of the main thread.
+             */
+            void printSummary(std::ostream& out) const;
+
+            /*!
+             * Discards all measurements. Must not be called while phases are active.
+             */
+            void reset();
+
+        private:
+            struct Phase {
+                Phase(std::string const& name);
+
+                modernjson::json toJson() const;
+
+                // The name of the phase.
+                std::string name;
+
+                // How often the phase was entered.
+                uint64_t calls;
+
+                // The total time spent in the phase.
+                std::chrono::nanoseconds time;
+
+                // The counters that were updated while this phase was the innermost one.
+                std::map<std::string, uint64_t> counters;
+
+                // The phases that were entered while this phase was active (in order of their first occurrence).
+                std::vector<std::unique_ptr<Phase>> children;
+            };
+
+            struct ActivePhase {
+                Phase* phase;
+                std::chrono::high_resolution_clock::time_point start;
+            };
+
+            struct TraceEvent {
+                std::string name;
+                uint64_t thread;
+                std::chrono::high_resolution_clock::time_point start;
+                std::chrono::nanoseconds duration;
+            };
+
+            struct ThreadData {
+                // The index of the thread in order of registration.
+                uint64_t index;
+
+                // The phases of the thread.
+                std::unique_ptr<Phase> root;
+
+                // The currently active phases.
+                std::vector<ActivePhase> stack;
+            };
+
+            Profiler();
+
+            /*!
+             * Retrieves the data of the calling thread. The mutex needs to be held by the caller.
+             */
+            ThreadData& getThreadData();
+
+            // Whether measurements are collected.
+            std::atomic<bool> enabled;
+
+            // Guards all members below.
+            mutable std::mutex mutex;
+
+            // The point of time at which the profiler was (re)started.
+            std::chrono::high_resolution_clock::time_point epoch;
+
+            // The data of each thread that entered a phase or updated a counter.
+            std::map<std::thread::id, ThreadData> threads;
+
+            // The totals of all counters.
+            std::map<std::string, uint64_t> counters;
+
+            // The completed phases in order of completion.
+            std::vector<TraceEvent> traceEvents;
+        };
+
+        /*!
+         * Enters a phase of the profiler upon construction and leaves it upon destruction.
+         */
+        class ProfilerPhase {
+        public:
+            ProfilerPhase(char const* name) : active(Profiler::getInstance().isEnabled()) {
+                if (active) {
+                    Profiler::getInstance().enterPhase(name);
+                }
+            }
+
+            ~ProfilerPhase() {
+                if (active) {
+                    Profiler::getInstance().leavePhase();
+                }
+            }
+
+            ProfilerPhase(ProfilerPhase const&) = delete;
+            ProfilerPhase& operator=(ProfilerPhase const&) = delete;
+
+        private:
+            // Whether the phase was entered (i.e. the profiler was enabled at construction time).
+            bool active;
+        };
+
+        /*!
+         * Adds the given value to the counter with the given name if the profiler is enabled. The name is only
+         * converted to a string if the profiler is enabled, so this can be called in frequently executed code.
+         */
+        inline void addToProfilerCounter(char const* name, uint64_t value) {
+            Profiler& profiler = Profiler::getInstance();
+            if (profiler.isEnabled()) {
+                profiler.addToCounter(name, value);
+            }
+        }
+    }
+}
@@ -85,6 +85,19 @@ namespace storm {
                 return result;
             }
             
+            std::vector<std::string> parseConstantsSweepString(std::string const& input) {
+                std::vector<std::string> sweepPoints;
+                boost::split(sweepPoints, input, boost::is_any_of(";"));
+                std::vector<std::string> result;
+                for (auto& sweepPoint : sweepPoints) {
+                    boost::trim(sweepPoint);
+                    if (!sweepPoint.empty()) {
+                        result.push_back(std::move(sweepPoint));
+                    }
+                }
+                return result;
+            }
+            
         }
     }
 }
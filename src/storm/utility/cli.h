@@ -14,6 +14,12 @@ namespace storm {
             std::map<storm::expressions::Variable, storm::expressions::Expression> parseConstantDefinitionString(storm::expressions::ExpressionManager const& manager, std::string const& constantDefinitionString);
             
             std::vector<std::string> parseCommaSeparatedStrings(std::string const& input);
+            
+            /*!
+             * Splits the given sweep of constant definitions into the definition strings of the individual sweep
+             * points. Sweep points are separated by semicolons, empty sweep points are dropped.
+             */
+            std::vector<std::string> parseConstantsSweepString(std::string const& input);
         }
     }
 }
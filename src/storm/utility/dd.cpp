@@ -1,5 +1,8 @@
 #include "storm/utility/dd.h"
 
+#include <algorithm>
+#include <chrono>
+
 #include "storm/storage/dd/DdManager.h"
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
@@ -45,6 +48,106 @@ namespace storm {
                 return reachableStates;
             }
             
+            template <storm::dd::DdType Type>
+            storm::dd::Bdd<Type> computeReachableStates(storm::dd::Bdd<Type> const& initialStates, std::vector<storm::dd::Bdd<Type>> const& transitionPartitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables, storm::builder::SymbolicReachabilityStrategy strategy) {
+                if (strategy == storm::builder::SymbolicReachabilityStrategy::Bfs) {
+                    return computeReachableStates(initialStates, storm::dd::Bdd<Type>::disjunction(initialStates.getDdManager(), transitionPartitions), rowMetaVariables, columnMetaVariables);
+                }
+                
+                STORM_LOG_TRACE("Computing reachable states (" << strategy << ") with " << transitionPartitions.size() << " part(s) of the transition relation, " << initialStates.getNonZeroCount() << " initial states.");
+                
+                auto start = std::chrono::high_resolution_clock::now();
+                storm::dd::Bdd<Type> reachableStates = initialStates;
+                uint_fast64_t imageComputations = 0;
+                uint_fast64_t maximalNodeCount = reachableStates.getNodeCount();
+                
+                if (strategy == storm::builder::SymbolicReachabilityStrategy::Chaining) {
+                    // Apply the parts one after another, each to the states found so far, until no part adds new states.
+                    bool changed;
+                    do {
+                        changed = false;
+                        for (auto const& part : transitionPartitions) {
+                            storm::dd::Bdd<Type> newReachableStates = reachableStates.relationalProduct(part, rowMetaVariables, columnMetaVariables) && !reachableStates;
+                            ++imageComputations;
+                            if (!newReachableStates.isZero()) {
+                                changed = true;
+                                reachableStates |= newReachableStates;
+                                maximalNodeCount = std::max(maximalNodeCount, reachableStates.getNodeCount());
+                            }
+                        }
+                    } while (changed);
+                } else {
+                    // Saturate the states with respect to each part. Whenever a part adds new states, the parts before it
+                    // may become enabled again, so we restart with the first one.
+                    uint_fast64_t partIndex = 0;
+                    while (partIndex < transitionPartitions.size()) {
+                        storm::dd::Bdd<Type> const& part = transitionPartitions[partIndex];
+                        storm::dd::Bdd<Type> newReachableStates = reachableStates.relationalProduct(part, rowMetaVariables, columnMetaVariables) && !reachableStates;
+                        ++imageComputations;
+                        if (newReachableStates.isZero()) {
+                            ++partIndex;
+                            continue;
+                        }
+                        
+                        // Compute the local fixpoint of this part by only exploring the frontier.
+                        do {
+                            reachableStates |= newReachableStates;
+                            maximalNodeCount = std::max(maximalNodeCount, reachableStates.getNodeCount());
+                            newReachableStates = newReachableStates.relationalProduct(part, rowMetaVariables, columnMetaVariables) && !reachableStates;
+                            ++imageComputations;
+                        } while (!newReachableStates.isZero());
+                        
+                        partIndex = partIndex == 0 ? 1 : 0;
+                    }
+                }
+                
+                auto end = std::chrono::high_resolution_clock::now();
+                STORM_LOG_TRACE("Reachability computation completed after " << imageComputations << " image computations (" << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms), the set of reachable states had at most " << maximalNodeCount << " node(s).");
+                
+                return reachableStates;
+            }
+            
+            template <storm::dd::DdType Type>
+            std::vector<storm::dd::Bdd<Type>> partitionTransitionRelation(storm::dd::Bdd<Type> const& transitions, std::vector<storm::dd::Bdd<Type>> const& componentIdentities) {
+                storm::dd::DdManager<Type> const& manager = transitions.getDdManager();
+                
+                // The part of a component needs the identities of all other components, which we obtain by combining
+                // the conjunction of the identities before and after it.
+                std::vector<storm::dd::Bdd<Type>> suffixIdentities(componentIdentities.size() + 1, manager.getBddOne());
+                for (uint_fast64_t index = componentIdentities.size(); index > 0; --index) {
+                    suffixIdentities[index - 1] = componentIdentities[index - 1] && suffixIdentities[index];
+                }
+                
+                std::vector<std::pair<uint_fast64_t, storm::dd::Bdd<Type>>> levelsAndParts;
+                storm::dd::Bdd<Type> prefixIdentity = manager.getBddOne();
+                storm::dd::Bdd<Type> localTransitions = manager.getBddZero();
+                for (uint_fast64_t index = 0; index < componentIdentities.size(); ++index) {
+                    storm::dd::Bdd<Type> const& identity = componentIdentities[index];
+                    if (!identity.isOne()) {
+                        storm::dd::Bdd<Type> part = transitions && prefixIdentity && suffixIdentities[index + 1];
+                        if (!part.isZero()) {
+                            localTransitions |= part;
+                            levelsAndParts.emplace_back(identity.getLevel(), part);
+                        }
+                    }
+                    prefixIdentity &= identity;
+                }
+                
+                // Components starting further down in the DD come first.
+                std::stable_sort(levelsAndParts.begin(), levelsAndParts.end(), [] (std::pair<uint_fast64_t, storm::dd::Bdd<Type>> const& first, std::pair<uint_fast64_t, storm::dd::Bdd<Type>> const& second) { return first.first > second.first; });
+                
+                std::vector<storm::dd::Bdd<Type>> result;
+                for (auto const& levelAndPart : levelsAndParts) {
+                    result.push_back(levelAndPart.second);
+                }
+                storm::dd::Bdd<Type> remainingTransitions = transitions && !localTransitions;
+                if (!remainingTransitions.isZero()) {
+                    result.push_back(remainingTransitions);
+                }
+                STORM_LOG_TRACE("Partitioned transition relation into " << levelsAndParts.size() << " local part(s) and " << (remainingTransitions.isZero() ? 0 : 1) << " remaining part(s).");
+                return result;
+            }
+            
             template <storm::dd::DdType Type>
             storm::dd::Bdd<Type> computeBackwardsReachableStates(storm::dd::Bdd<Type> const& initialStates, storm::dd::Bdd<Type> const& constraintStates, storm::dd::Bdd<Type> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables) {
                 STORM_LOG_TRACE("Computing backwards reachable states: transition matrix BDD has " << transitions.getNodeCount() << " node(s) and " << transitions.getNonZeroCount() << " non-zero(s), " << initialStates.getNonZeroCount() << " initial states).");
@@ -85,6 +188,12 @@ namespace storm {
             template storm::dd::Bdd<storm::dd::DdType::CUDD> computeReachableStates(storm::dd::Bdd<storm::dd::DdType::CUDD> const& initialStates, storm::dd::Bdd<storm::dd::DdType::CUDD> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables);
             template storm::dd::Bdd<storm::dd::DdType::Sylvan> computeReachableStates(storm::dd::Bdd<storm::dd::DdType::Sylvan> const& initialStates, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables);
 
+            template storm::dd::Bdd<storm::dd::DdType::CUDD> computeReachableStates(storm::dd::Bdd<storm::dd::DdType::CUDD> const& initialStates, std::vector<storm::dd::Bdd<storm::dd::DdType::CUDD>> const& transitionPartitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables, storm::builder::SymbolicReachabilityStrategy strategy);
+            template storm::dd::Bdd<storm::dd::DdType::Sylvan> computeReachableStates(storm::dd::Bdd<storm::dd::DdType::Sylvan> const& initialStates, std::vector<storm::dd::Bdd<storm::dd::DdType::Sylvan>> const& transitionPartitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables, storm::builder::SymbolicReachabilityStrategy strategy);
+
+            template std::vector<storm::dd::Bdd<storm::dd::DdType::CUDD>> partitionTransitionRelation(storm::dd::Bdd<storm::dd::DdType::CUDD> const& transitions, std::vector<storm::dd::Bdd<storm::dd::DdType::CUDD>> const& componentIdentities);
+            template std::vector<storm::dd::Bdd<storm::dd::DdType::Sylvan>> partitionTransitionRelation(storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitions, std::vector<storm::dd::Bdd<storm::dd::DdType::Sylvan>> const& componentIdentities);
+
             template storm::dd::Bdd<storm::dd::DdType::CUDD> computeBackwardsReachableStates(storm::dd::Bdd<storm::dd::DdType::CUDD> const& initialStates, storm::dd::Bdd<storm::dd::DdType::CUDD> const& constraintStates, storm::dd::Bdd<storm::dd::DdType::CUDD> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables);
             template storm::dd::Bdd<storm::dd::DdType::Sylvan> computeBackwardsReachableStates(storm::dd::Bdd<storm::dd::DdType::Sylvan> const& initialStates, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& constraintStates, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables);
             
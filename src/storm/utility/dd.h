@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "storm/storage/dd/DdType.h"
+#include "storm/builder/SymbolicReachabilityStrategy.h"
 
 namespace storm {
     namespace expressions {
@@ -26,6 +27,35 @@ namespace storm {
             template <storm::dd::DdType Type>
             storm::dd::Bdd<Type> computeReachableStates(storm::dd::Bdd<Type> const& initialStates, storm::dd::Bdd<Type> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables);
 
+            /*!
+             * Computes the states reachable from the initial states via the union of the given transition relations.
+             *
+             * @param initialStates The initial states.
+             * @param transitionPartitions The parts of the transition relation.
+             * @param rowMetaVariables The row meta variables.
+             * @param columnMetaVariables The column meta variables.
+             * @param strategy The strategy to use. Breadth-first search applies the union of all parts in each
+             * iteration, chaining applies the parts one after another and saturation applies each part until no more
+             * states are found before restarting with the first part. For the latter, the parts are expected to be
+             * ordered as returned by partitionTransitionRelation.
+             * @return The reachable states.
+             */
+            template <storm::dd::DdType Type>
+            storm::dd::Bdd<Type> computeReachableStates(storm::dd::Bdd<Type> const& initialStates, std::vector<storm::dd::Bdd<Type>> const& transitionPartitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables, storm::builder::SymbolicReachabilityStrategy strategy);
+            
+            /*!
+             * Splits the given transition relation into the transitions that leave all variables outside of one of the
+             * given components unchanged and the remaining transitions (e.g. synchronizing ones). The local parts are
+             * ordered such that the ones whose component starts at lower levels of the DD come first and the remaining
+             * transitions form the last part. Parts that are empty are omitted.
+             *
+             * @param transitions The transition relation.
+             * @param componentIdentities For each component, the BDD that keeps its variables unchanged.
+             * @return The parts of the transition relation, whose union is the transition relation.
+             */
+            template <storm::dd::DdType Type>
+            std::vector<storm::dd::Bdd<Type>> partitionTransitionRelation(storm::dd::Bdd<Type> const& transitions, std::vector<storm::dd::Bdd<Type>> const& componentIdentities);
+
             template <storm::dd::DdType Type>
             storm::dd::Bdd<Type> computeBackwardsReachableStates(storm::dd::Bdd<Type> const& initialStates, storm::dd::Bdd<Type> const& constraintStates, storm::dd::Bdd<Type> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables);
 
@@ -61,6 +61,20 @@ namespace storm {
 #endif
             }
             
+            /*!
+             * Retrieves the peak resident set size of the current process in kilobytes.
+             */
+            inline std::size_t usedPeakMemory() {
+                rusage usage;
+                getrusage(RUSAGE_SELF, &usage);
+#if defined MACOS
+                // On macOS, the value is reported in bytes.
+                return static_cast<std::size_t>(usage.ru_maxrss) / 1024;
+#else
+                return static_cast<std::size_t>(usage.ru_maxrss);
+#endif
+            }
+
             inline void quickest_exit(int errorCode) {
 #if defined LINUX
                 std::quick_exit(errorCode);
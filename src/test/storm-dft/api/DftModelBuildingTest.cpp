@@ -89,4 +89,63 @@ namespace {
 
     }
 
+    /*!
+     * Compares the models built with multiple threads to the one built sequentially.
+     * Returns the sequentially built model and the MTTF of the DFT.
+     */
+    std::pair<std::shared_ptr<storm::models::sparse::Model<double>>, double> checkParallelExploration(std::string const& file) {
+        // Initialize
+        std::shared_ptr<storm::storage::DFT<double>> dft = storm::api::loadDFTGalileoFile<double>(file);
+        EXPECT_TRUE(storm::api::isWellFormed(*dft));
+        std::map<size_t, std::vector<std::vector<size_t>>> emptySymmetry;
+        storm::storage::DFTIndependentSymmetries symmetries(emptySymmetry);
+        std::set<size_t> relevantEvents = dft->getAllIds();
+
+        // Build model sequentially
+        storm::builder::ExplicitDFTModelBuilder<double> builder(*dft, symmetries, relevantEvents, false);
+        builder.buildModel(0, 0.0);
+        std::shared_ptr<storm::models::sparse::Model<double>> model = builder.getModel();
+
+        // Build model with multiple threads. The numbering of the states may differ from the sequential exploration,
+        // but the states and transitions are the same.
+        storm::builder::ExplicitDFTModelBuilder<double> builder2(*dft, symmetries, relevantEvents, false, 2);
+        builder2.buildModel(0, 0.0);
+        std::shared_ptr<storm::models::sparse::Model<double>> model2 = builder2.getModel();
+        EXPECT_EQ(model->getNumberOfStates(), model2->getNumberOfStates());
+        EXPECT_EQ(model->getNumberOfTransitions(), model2->getNumberOfTransitions());
+        EXPECT_EQ(model->getNumberOfChoices(), model2->getNumberOfChoices());
+        EXPECT_EQ(model->getStates("failed").getNumberOfSetBits(), model2->getStates("failed").getNumberOfSetBits());
+        EXPECT_EQ(model->getInitialStates().getNumberOfSetBits(), model2->getInitialStates().getNumberOfSetBits());
+
+        // For multiple threads, the numbering of the states does not depend on the number of threads
+        storm::builder::ExplicitDFTModelBuilder<double> builder4(*dft, symmetries, relevantEvents, false, 4);
+        builder4.buildModel(0, 0.0);
+        std::shared_ptr<storm::models::sparse::Model<double>> model4 = builder4.getModel();
+        EXPECT_EQ(model2->getTransitionMatrix(), model4->getTransitionMatrix());
+        EXPECT_EQ(model2->getStates("failed"), model4->getStates("failed"));
+
+        // Analysing the models built with one and with multiple threads yields the same result
+        std::vector<std::shared_ptr<storm::logic::Formula const>> properties = storm::api::extractFormulasFromProperties(storm::api::parseProperties("T=? [ F \"failed\" ]"));
+        typename storm::modelchecker::DFTModelChecker<double>::dft_results results = storm::api::analyzeDFT<double>(*dft, properties, false, false);
+        double mttf = boost::get<double>(results[0]);
+        for (uint64_t threads : {2ul, 4ul}) {
+            results = storm::api::analyzeDFT<double>(*dft, properties, false, false, {}, true, 0.0, storm::builder::ApproximationHeuristic::DEPTH, false, 1, 0, threads);
+            EXPECT_NEAR(mttf, boost::get<double>(results[0]), 1e-4 * mttf) << "Exploration threads: " << threads;
+        }
+        return std::make_pair(model, mttf);
+    }
+
+    TEST(DftModelBuildingTest, ParallelExploration) {
+        std::shared_ptr<storm::models::sparse::Model<double>> model = checkParallelExploration(STORM_TEST_RESOURCES_DIR "/dft/dont_care.dft").first;
+        EXPECT_EQ(512ul, model->getNumberOfStates());
+        EXPECT_EQ(2305ul, model->getNumberOfTransitions());
+    }
+
+    TEST(DftModelBuildingTest, ParallelExplorationMultipleBatches) {
+        // The state space spans several exploration batches, so states reached in one batch are explored in later ones
+        auto result = checkParallelExploration(STORM_TEST_RESOURCES_DIR "/dft/hecs_3_2_2_np.dft");
+        EXPECT_LT(1024ul, result.first->getNumberOfStates());
+        EXPECT_NEAR(417.9436693, result.second, 1e-3);
+    }
+
 }
@@ -1,6 +1,8 @@
 #include "gtest/gtest.h"
 #include "storm-config.h"
 
+#include <limits>
+
 #include "storm-dft/api/storm-dft.h"
 #include "storm-parsers/api/storm-parsers.h"
 
@@ -205,4 +207,43 @@ namespace {
         EXPECT_FLOAT_EQ(result, storm::utility::infinity<double>());
     }
 
+    TEST(DftModelCheckerParallelTest, Modules) {
+        std::string property = "P=? [F<=1 \"failed\"]";
+        std::vector<std::shared_ptr<storm::logic::Formula const>> properties = storm::api::extractFormulasFromProperties(storm::api::parseProperties(property));
+
+        std::shared_ptr<storm::storage::DFT<double>> dft = storm::api::loadDFTGalileoFile<double>(STORM_TEST_RESOURCES_DIR "/dft/or.dft");
+        typename storm::modelchecker::DFTModelChecker<double>::dft_results results = storm::api::analyzeDFT<double>(*dft, properties, false, true, {}, true, 0.0,
+                                                                                                                    storm::builder::ApproximationHeuristic::DEPTH, false, 2);
+        EXPECT_NEAR(boost::get<double>(results[0]), 0.6321205588, 1e-6);
+
+        dft = storm::api::loadDFTGalileoFile<double>(STORM_TEST_RESOURCES_DIR "/dft/voting.dft");
+        results = storm::api::analyzeDFT<double>(*dft, properties, false, true, {}, true, 0.0, storm::builder::ApproximationHeuristic::DEPTH, false, 4, 1);
+        EXPECT_NEAR(boost::get<double>(results[0]), 0.4511883639, 1e-6);
+    }
+
+    TEST(DftModelCheckerParallelTest, MemoryBudget) {
+        // The memory budget bounds the number of workers
+        EXPECT_EQ(3ul, storm::modelchecker::DFTModelChecker<double>::computeNumberOfModuleWorkers(4, 3, 0, 2048));
+        EXPECT_EQ(3ul, storm::modelchecker::DFTModelChecker<double>::computeNumberOfModuleWorkers(4, 3, 1024, 0));
+        EXPECT_EQ(3ul, storm::modelchecker::DFTModelChecker<double>::computeNumberOfModuleWorkers(4, 3, 512, 2048));
+        EXPECT_EQ(2ul, storm::modelchecker::DFTModelChecker<double>::computeNumberOfModuleWorkers(4, 3, 1024, 2048));
+        EXPECT_EQ(1ul, storm::modelchecker::DFTModelChecker<double>::computeNumberOfModuleWorkers(4, 3, 1024, 1500));
+        // At least one worker is used even if a single module exceeds the memory limit
+        EXPECT_EQ(1ul, storm::modelchecker::DFTModelChecker<double>::computeNumberOfModuleWorkers(4, 3, 4096, 2048));
+        EXPECT_EQ(1ul, storm::modelchecker::DFTModelChecker<double>::computeNumberOfModuleWorkers(0, 3, 0, 0));
+
+        // A budget exceeding any memory limit serialises the module checks without changing the results
+        std::string property = "P=? [F<=1 \"failed\"]";
+        std::vector<std::shared_ptr<storm::logic::Formula const>> properties = storm::api::extractFormulasFromProperties(storm::api::parseProperties(property));
+        uint_fast64_t tightBudget = std::numeric_limits<uint_fast64_t>::max();
+        for (auto const& file : {"/dft/or.dft", "/dft/voting.dft"}) {
+            std::shared_ptr<storm::storage::DFT<double>> dft = storm::api::loadDFTGalileoFile<double>(STORM_TEST_RESOURCES_DIR + std::string(file));
+            typename storm::modelchecker::DFTModelChecker<double>::dft_results sequentialResults = storm::api::analyzeDFT<double>(*dft, properties, false, true, {}, true, 0.0,
+                                                                                                                                    storm::builder::ApproximationHeuristic::DEPTH, false, 1);
+            typename storm::modelchecker::DFTModelChecker<double>::dft_results budgetResults = storm::api::analyzeDFT<double>(*dft, properties, false, true, {}, true, 0.0,
+                                                                                                                                storm::builder::ApproximationHeuristic::DEPTH, false, 4, tightBudget);
+            EXPECT_NEAR(boost::get<double>(sequentialResults[0]), boost::get<double>(budgetResults[0]), 1e-10);
+        }
+    }
+
 }
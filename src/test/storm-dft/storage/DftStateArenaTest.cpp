@@ -0,0 +1,189 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#include <map>
+#include <queue>
+#include <tuple>
+
+#include "storm-dft/api/storm-dft.h"
+#include "storm-dft/builder/ExplicitDFTModelBuilder.h"
+#include "storm-dft/generator/DftNextStateGenerator.h"
+#include "storm-dft/storage/DFTStateArena.h"
+
+namespace {
+
+    storm::storage::BitVector createStatus(uint64_t size, std::vector<uint64_t> const& setBits) {
+        storm::storage::BitVector status(size);
+        for (auto bit : setBits) {
+            status.set(bit);
+        }
+        return status;
+    }
+
+    TEST(DftStateArenaTest, StoreAndRelease) {
+        storm::storage::DFTStateArena arena(64);
+        EXPECT_EQ(0ul, arena.size());
+
+        storm::storage::BitVector first = createStatus(64, {0, 5, 63});
+        storm::storage::BitVector second = createStatus(64, {1, 2});
+        storm::storage::BitVector third = createStatus(64, {});
+        uint64_t firstSlot = arena.store(first);
+        uint64_t secondSlot = arena.store(second);
+        uint64_t thirdSlot = arena.store(third);
+        EXPECT_EQ(0ul, firstSlot);
+        EXPECT_EQ(1ul, secondSlot);
+        EXPECT_EQ(2ul, thirdSlot);
+        EXPECT_EQ(3ul, arena.size());
+        EXPECT_EQ(first, arena.get(firstSlot));
+        EXPECT_EQ(second, arena.get(secondSlot));
+        EXPECT_EQ(third, arena.get(thirdSlot));
+
+        arena.release(secondSlot);
+        EXPECT_EQ(2ul, arena.size());
+        EXPECT_EQ(first, arena.get(firstSlot));
+        EXPECT_EQ(third, arena.get(thirdSlot));
+    }
+
+    TEST(DftStateArenaTest, SlotReuse) {
+        storm::storage::DFTStateArena arena(128);
+        std::vector<storm::storage::BitVector> statuses;
+        for (uint64_t index = 0; index < 10; ++index) {
+            // The statuses span both words of a slot
+            statuses.push_back(createStatus(128, {index, 63 - index, 64 + index, 127 - index}));
+            EXPECT_EQ(index, arena.store(statuses.back()));
+        }
+        uint64_t capacity = arena.capacity();
+        EXPECT_LE(10ul, capacity);
+
+        // Released slots are reused before new slots are handed out
+        arena.release(3);
+        arena.release(7);
+        EXPECT_EQ(8ul, arena.size());
+        storm::storage::BitVector reused = createStatus(128, {42, 100});
+        uint64_t reusedSlot = arena.store(reused);
+        EXPECT_TRUE(reusedSlot == 3 || reusedSlot == 7);
+        uint64_t otherSlot = arena.store(statuses[3]);
+        EXPECT_EQ(10ul - reusedSlot, otherSlot);
+        EXPECT_EQ(10ul, arena.size());
+        EXPECT_EQ(capacity, arena.capacity());
+        EXPECT_EQ(reused, arena.get(reusedSlot));
+        EXPECT_EQ(statuses[3], arena.get(otherSlot));
+
+        // The remaining statuses are not affected by the reuse
+        for (uint64_t index = 0; index < 10; ++index) {
+            if (index != 3 && index != 7) {
+                EXPECT_EQ(statuses[index], arena.get(index));
+            }
+        }
+
+        // Without free slots, the arena grows and keeps the stored statuses
+        storm::storage::BitVector last = createStatus(128, {0, 127});
+        uint64_t lastSlot = 0;
+        for (uint64_t index = 0; index < capacity; ++index) {
+            lastSlot = arena.store(last);
+        }
+        EXPECT_EQ(10ul + capacity - 1, lastSlot);
+        EXPECT_LT(capacity, arena.capacity());
+        EXPECT_EQ(10ul + capacity, arena.size());
+        EXPECT_EQ(last, arena.get(lastSlot));
+        EXPECT_EQ(statuses[0], arena.get(0));
+        EXPECT_EQ(statuses[9], arena.get(9));
+    }
+
+    /*!
+     * Explores the state space of the DFT keeping the concrete states.
+     * Each state is additionally reconstructed from its status alone and expanded. Both expansions must yield the same behavior.
+     * Returns the number of states and transitions.
+     */
+    std::pair<uint64_t, uint64_t> exploreWithReconstructedStates(std::string const& file) {
+        typedef std::shared_ptr<storm::storage::DFTState<double>> DFTStatePointer;
+
+        std::shared_ptr<storm::storage::DFT<double>> dft = storm::api::loadDFTGalileoFile<double>(file);
+        EXPECT_TRUE(storm::api::isWellFormed(*dft));
+        std::map<size_t, std::vector<std::vector<size_t>>> emptySymmetry;
+        storm::storage::DFTIndependentSymmetries symmetries(emptySymmetry);
+        storm::storage::DFTStateGenerationInfo stateGenerationInfo = dft->buildStateGenerationInfo(symmetries);
+        dft->setRelevantEvents(dft->getAllIds(), false);
+        storm::generator::DftNextStateGenerator<double> generator(*dft, stateGenerationInfo);
+
+        std::map<storm::storage::BitVector, uint32_t> stateToId;
+        std::queue<DFTStatePointer> statesNotExplored;
+        auto stateToIdCallback = [&stateToId, &statesNotExplored](DFTStatePointer const& state) {
+            auto it = stateToId.find(state->status());
+            if (it != stateToId.end()) {
+                return it->second;
+            }
+            uint32_t id = stateToId.size();
+            state->setId(id);
+            stateToId[state->status()] = id;
+            statesNotExplored.push(state);
+            return id;
+        };
+        generator.getInitialStates(stateToIdCallback);
+
+        auto getTransitions = [](storm::generator::StateBehavior<double, uint32_t> const& behavior) {
+            std::vector<std::tuple<uint64_t, bool, uint32_t, double>> transitions;
+            uint64_t choiceIndex = 0;
+            for (auto const& choice : behavior) {
+                for (auto const& entry : choice) {
+                    transitions.emplace_back(choiceIndex, choice.isMarkovian(), entry.first, entry.second);
+                }
+                ++choiceIndex;
+            }
+            return transitions;
+        };
+
+        uint64_t numberOfTransitions = 0;
+        while (!statesNotExplored.empty()) {
+            DFTStatePointer state = statesNotExplored.front();
+            statesNotExplored.pop();
+            // Reconstruct the state before the concrete state is modified by its expansion
+            DFTStatePointer reconstructedState = generator.createState(state->status(), state->getId());
+            EXPECT_FALSE(reconstructedState->isPseudoState());
+            EXPECT_EQ(state->status(), reconstructedState->status());
+            EXPECT_EQ(state->getId(), reconstructedState->getId());
+
+            generator.load(state);
+            auto transitions = getTransitions(generator.expand(stateToIdCallback));
+            uint64_t numberOfStates = stateToId.size();
+            generator.load(reconstructedState->status(), reconstructedState->getId());
+            EXPECT_EQ(transitions, getTransitions(generator.expand(stateToIdCallback))) << "State: " << dft->getStateString(state);
+            generator.load(reconstructedState);
+            EXPECT_EQ(transitions, getTransitions(generator.expand(stateToIdCallback))) << "State: " << dft->getStateString(state);
+            // The reconstructed states do not reach new states
+            EXPECT_EQ(numberOfStates, stateToId.size());
+            numberOfTransitions += transitions.size();
+        }
+        return std::make_pair(stateToId.size(), numberOfTransitions);
+    }
+
+    TEST(DftStateArenaTest, CompactStateRoundTrip) {
+        std::pair<uint64_t, uint64_t> counts = exploreWithReconstructedStates(STORM_TEST_RESOURCES_DIR "/dft/dont_care.dft");
+        EXPECT_EQ(512ul, counts.first);
+        EXPECT_EQ(2305ul, counts.second);
+
+        // Spares and dependencies keep information outside of the failure status of the elements
+        counts = exploreWithReconstructedStates(STORM_TEST_RESOURCES_DIR "/dft/spare.dft");
+        EXPECT_LT(1ul, counts.first);
+        counts = exploreWithReconstructedStates(STORM_TEST_RESOURCES_DIR "/dft/fdep4.dft");
+        EXPECT_LT(1ul, counts.first);
+    }
+
+    TEST(DftStateArenaTest, BuilderMatchesConcreteStates) {
+        // The builder only keeps the status of unexplored states, but yields the same model as the exploration with concrete states
+        for (auto const& file : {"/dft/dont_care.dft", "/dft/spare.dft"}) {
+            std::string path = STORM_TEST_RESOURCES_DIR + std::string(file);
+            std::pair<uint64_t, uint64_t> counts = exploreWithReconstructedStates(path);
+
+            std::shared_ptr<storm::storage::DFT<double>> dft = storm::api::loadDFTGalileoFile<double>(path);
+            std::map<size_t, std::vector<std::vector<size_t>>> emptySymmetry;
+            storm::storage::DFTIndependentSymmetries symmetries(emptySymmetry);
+            storm::builder::ExplicitDFTModelBuilder<double> builder(*dft, symmetries, dft->getAllIds(), false);
+            builder.buildModel(0, 0.0);
+            std::shared_ptr<storm::models::sparse::Model<double>> model = builder.getModel();
+            EXPECT_EQ(counts.first, model->getNumberOfStates()) << "File: " << file;
+            EXPECT_EQ(counts.second, model->getNumberOfTransitions()) << "File: " << file;
+        }
+    }
+
+}
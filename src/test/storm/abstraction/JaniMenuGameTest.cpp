@@ -0,0 +1,80 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#ifdef STORM_HAVE_MSAT
+
+#include <tuple>
+
+#include "storm-parsers/parser/PrismParser.h"
+
+#include "storm/abstraction/MenuGameRefiner.h"
+#include "storm/abstraction/jani/JaniMenuGameAbstractor.h"
+
+#include "storm/storage/expressions/Expression.h"
+#include "storm/storage/jani/Model.h"
+
+#include "storm/storage/dd/Add.h"
+#include "storm/storage/dd/Bdd.h"
+
+#include "storm/models/symbolic/StandardRewardModel.h"
+
+#include "storm/utility/solver.h"
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/AbstractionSettings.h"
+
+namespace {
+    /*!
+     * Abstracts and refines the two dice model with the given number of threads and returns the number of
+     * transitions, states and bottom states of the resulting game.
+     */
+    template<storm::dd::DdType DdType>
+    std::tuple<uint64_t, uint64_t, uint64_t> abstractTwoDice(uint64_t numberOfThreads) {
+        auto& settings = storm::settings::mutableAbstractionSettings();
+        settings.setAddAllGuards(false);
+        settings.setAddAllInitialExpressions(false);
+        settings.setNumberOfThreads(numberOfThreads);
+
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+        program = program.substituteConstantsFormulas();
+        storm::jani::Model janiModel = program.toJani().flattenComposition(std::make_shared<storm::utility::solver::MathsatSmtSolverFactory>());
+
+        std::vector<storm::expressions::Expression> initialPredicates;
+        storm::expressions::ExpressionManager& manager = janiModel.getManager();
+
+        initialPredicates.push_back(manager.getVariableExpression("s1") < manager.integer(3));
+        initialPredicates.push_back(manager.getVariableExpression("s2") == manager.integer(0));
+
+        std::shared_ptr<storm::utility::solver::SmtSolverFactory> smtSolverFactory = std::make_shared<storm::utility::solver::MathsatSmtSolverFactory>();
+
+        storm::abstraction::jani::JaniMenuGameAbstractor<DdType, double> abstractor(janiModel, smtSolverFactory);
+        storm::abstraction::MenuGameRefiner<DdType, double> refiner(abstractor, smtSolverFactory->create(manager));
+        refiner.refine(initialPredicates);
+
+        EXPECT_NO_THROW(refiner.refine({manager.getVariableExpression("d1") + manager.getVariableExpression("d2") == manager.integer(7)}));
+
+        storm::abstraction::MenuGame<DdType, double> game = abstractor.abstract();
+        std::tuple<uint64_t, uint64_t, uint64_t> result = std::make_tuple(game.getNumberOfTransitions(), game.getNumberOfStates(), game.getBottomStates().getNonZeroCount());
+
+        storm::settings::mutableAbstractionSettings().restoreDefaults();
+        return result;
+    }
+}
+
+TEST(JaniMenuGame, TwoDiceParallelAbstractionAndRefinementTest_Cudd) {
+    std::tuple<uint64_t, uint64_t, uint64_t> sequentialResult = abstractTwoDice<storm::dd::DdType::CUDD>(1);
+    EXPECT_LT(0ull, std::get<1>(sequentialResult));
+    EXPECT_EQ(sequentialResult, abstractTwoDice<storm::dd::DdType::CUDD>(2));
+    EXPECT_EQ(sequentialResult, abstractTwoDice<storm::dd::DdType::CUDD>(4));
+}
+
+TEST(JaniMenuGame, TwoDiceParallelAbstractionAndRefinementTest_Sylvan) {
+    std::tuple<uint64_t, uint64_t, uint64_t> sequentialResult = abstractTwoDice<storm::dd::DdType::Sylvan>(1);
+    EXPECT_LT(0ull, std::get<1>(sequentialResult));
+    EXPECT_EQ(sequentialResult, abstractTwoDice<storm::dd::DdType::Sylvan>(2));
+    EXPECT_EQ(sequentialResult, abstractTwoDice<storm::dd::DdType::Sylvan>(4));
+}
+
+#endif
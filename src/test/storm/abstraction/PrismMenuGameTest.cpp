@@ -646,6 +646,39 @@ TEST(PrismMenuGame, TwoDiceAbstractionAndRefinementTest_Sylvan) {
     storm::settings::mutableAbstractionSettings().restoreDefaults();
 }
 
+TEST(PrismMenuGame, TwoDiceParallelAbstractionAndRefinementTest_Cudd) {
+    auto& settings = storm::settings::mutableAbstractionSettings();
+    settings.setAddAllGuards(false);
+    settings.setAddAllInitialExpressions(false);
+    settings.setNumberOfThreads(4);
+    
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    program = program.substituteConstantsFormulas();
+    program = program.flattenModules(std::make_shared<storm::utility::solver::MathsatSmtSolverFactory>());
+    
+    std::vector<storm::expressions::Expression> initialPredicates;
+    storm::expressions::ExpressionManager& manager = program.getManager();
+    
+    initialPredicates.push_back(manager.getVariableExpression("s1") < manager.integer(3));
+    initialPredicates.push_back(manager.getVariableExpression("s2") == manager.integer(0));
+    
+    std::shared_ptr<storm::utility::solver::SmtSolverFactory> smtSolverFactory = std::make_shared<storm::utility::solver::MathsatSmtSolverFactory>();
+
+    storm::abstraction::prism::PrismMenuGameAbstractor<storm::dd::DdType::CUDD, double> abstractor(program, smtSolverFactory);
+    storm::abstraction::MenuGameRefiner<storm::dd::DdType::CUDD, double> refiner(abstractor, smtSolverFactory->create(manager));
+    refiner.refine(initialPredicates);
+
+    ASSERT_NO_THROW(refiner.refine({manager.getVariableExpression("d1") + manager.getVariableExpression("d2") == manager.integer(7)}));
+
+    storm::abstraction::MenuGame<storm::dd::DdType::CUDD, double> game = abstractor.abstract();
+
+    EXPECT_EQ(276ull, game.getNumberOfTransitions());
+    EXPECT_EQ(16ull, game.getNumberOfStates());
+    EXPECT_EQ(8ull, game.getBottomStates().getNonZeroCount());
+
+    storm::settings::mutableAbstractionSettings().restoreDefaults();
+}
+
 TEST(PrismMenuGame, TwoDiceFullAbstractionTest_Cudd) {
     auto& settings = storm::settings::mutableAbstractionSettings();
     settings.setAddAllGuards(false);
@@ -15,6 +15,7 @@
 
 #include "storm/settings/SettingMemento.h"
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/BuildSettings.h"
 
 #include "storm/exceptions/InvalidSettingsException.h"
 
@@ -677,3 +678,31 @@ TEST(DdJaniModelBuilderTest_Sylvan, InputEnabling) {
     EXPECT_EQ(4ul, model->getNumberOfStates());
     EXPECT_EQ(5ul, model->getNumberOfTransitions());
 }
+
+namespace {
+    template<storm::dd::DdType DdType>
+    void checkSymbolicReachabilityStrategies() {
+        storm::settings::SettingMemento resetStrategy(storm::settings::mutableManager().getModule(storm::settings::modules::BuildSettings::moduleName), "ddreach", false);
+        
+        // Keep the variables local to the automata, so the automata and the global variables form distinct components.
+        std::vector<std::pair<std::string, std::pair<uint64_t, uint64_t>>> modelsAndSizes = {{"/dtmc/leader-3-5.pm", {273ul, 397ul}}, {"/mdp/leader3.nm", {364ul, 654ul}}, {"/mdp/two_dice.nm", {169ul, 436ul}}};
+        for (auto const& modelAndSizes : modelsAndSizes) {
+            storm::jani::Model janiModel = storm::storage::SymbolicModelDescription(storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR + modelAndSizes.first)).toJani(false).preprocess().asJaniModel();
+            // The default strategy comes last, so it is selected again afterwards.
+            for (std::string const& strategy : {"chaining", "saturation", "bfs"}) {
+                storm::settings::mutableManager().setFromString("--" + storm::settings::modules::BuildSettings::moduleName + ":ddreach " + strategy);
+                std::shared_ptr<storm::models::symbolic::Model<DdType>> model = storm::builder::DdJaniModelBuilder<DdType, double>().build(janiModel);
+                EXPECT_EQ(modelAndSizes.second.first, model->getNumberOfStates()) << modelAndSizes.first << " (" << strategy << ")";
+                EXPECT_EQ(modelAndSizes.second.second, model->getNumberOfTransitions()) << modelAndSizes.first << " (" << strategy << ")";
+            }
+        }
+    }
+}
+
+TEST(DdJaniModelBuilderTest_Cudd, SymbolicReachabilityStrategies) {
+    checkSymbolicReachabilityStrategies<storm::dd::DdType::CUDD>();
+}
+
+TEST(DdJaniModelBuilderTest_Sylvan, SymbolicReachabilityStrategies) {
+    checkSymbolicReachabilityStrategies<storm::dd::DdType::Sylvan>();
+}
@@ -0,0 +1,129 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#include <algorithm>
+#include <fstream>
+
+#include <boost/filesystem.hpp>
+
+#include "storm/builder/DdVariableOrdering.h"
+#include "storm/builder/DdPrismModelBuilder.h"
+#include "storm/builder/DdJaniModelBuilder.h"
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/models/symbolic/Model.h"
+#include "storm/models/symbolic/StandardRewardModel.h"
+#include "storm/settings/SettingMemento.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/BuildSettings.h"
+#include "storm/storage/SymbolicModelDescription.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/jani/Model.h"
+#include "storm/storage/prism/Program.h"
+#include "storm-parsers/parser/PrismParser.h"
+
+namespace {
+    void writeFile(std::string const& filename, std::string const& content) {
+        std::ofstream stream(filename);
+        stream << content;
+    }
+}
+
+TEST(DdVariableOrderingTest, Force) {
+    storm::expressions::ExpressionManager manager;
+    storm::expressions::Variable a = manager.declareBooleanVariable("a");
+    storm::expressions::Variable b = manager.declareBooleanVariable("b");
+    storm::expressions::Variable c = manager.declareBooleanVariable("c");
+    storm::expressions::Variable d = manager.declareBooleanVariable("d");
+    storm::expressions::Variable e = manager.declareBooleanVariable("e");
+    
+    // Variable e is unrelated to all others and the dependencies refer to a variable that is not to be ordered.
+    storm::expressions::Variable unordered = manager.declareBooleanVariable("unordered");
+    std::vector<std::set<storm::expressions::Variable>> dependencies = {{a, c}, {b, d, unordered}};
+    
+    std::vector<storm::expressions::Variable> order = storm::builder::computeForceOrder({a, b, c, d, e}, dependencies);
+    std::vector<storm::expressions::Variable> expectedOrder = {a, c, b, d, e};
+    EXPECT_EQ(expectedOrder, order);
+    
+    // An order without dependencies between distant variables is kept.
+    order = storm::builder::computeForceOrder({a, c, b, d, e}, dependencies);
+    EXPECT_EQ(expectedOrder, order);
+    
+    order = storm::builder::computeForceOrder({a, b}, {});
+    ASSERT_EQ(2ul, order.size());
+    EXPECT_EQ(a, order[0]);
+    EXPECT_EQ(b, order[1]);
+}
+
+TEST(DdVariableOrderingTest, ImportExport) {
+    storm::expressions::ExpressionManager manager;
+    storm::expressions::Variable a = manager.declareBooleanVariable("a");
+    storm::expressions::Variable b = manager.declareBooleanVariable("b");
+    storm::expressions::Variable c = manager.declareIntegerVariable("c");
+    storm::expressions::Variable d = manager.declareIntegerVariable("d");
+    std::vector<storm::expressions::Variable> variables = {a, b, c, d};
+    std::string filename = (boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("storm-ddorder-%%%%-%%%%-%%%%")).string();
+    
+    // An exported order is imported again as is.
+    std::vector<storm::expressions::Variable> order = {c, a, d, b};
+    storm::builder::exportDdVariableOrder(order, filename);
+    EXPECT_EQ(order, storm::builder::importDdVariableOrder(variables, filename));
+    
+    // Surrounding whitespace and empty lines are ignored and unlisted variables are appended in the given order.
+    writeFile(filename, "  d\n\nb \n");
+    std::vector<storm::expressions::Variable> expectedOrder = {d, b, a, c};
+    EXPECT_EQ(expectedOrder, storm::builder::importDdVariableOrder(variables, filename));
+    writeFile(filename, "");
+    EXPECT_EQ(variables, storm::builder::importDdVariableOrder(variables, filename));
+    
+    // Unknown and duplicate names are rejected.
+    writeFile(filename, "a\ne\n");
+    EXPECT_THROW(storm::builder::importDdVariableOrder(variables, filename), storm::exceptions::WrongFormatException);
+    writeFile(filename, "a\nb\na\n");
+    EXPECT_THROW(storm::builder::importDdVariableOrder(variables, filename), storm::exceptions::WrongFormatException);
+    
+    boost::filesystem::remove(filename);
+}
+
+namespace {
+    template<storm::dd::DdType DdType>
+    void checkForceOrderPreservesModel(std::string const& filename, uint64_t numberOfStates, uint64_t numberOfTransitions) {
+        storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(filename);
+        storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+        storm::jani::Model janiModel = modelDescription.toJani(true).preprocess().asJaniModel();
+        
+        storm::settings::mutableManager().setFromString("--" + storm::settings::modules::BuildSettings::moduleName + ":ddorder declaration");
+        storm::settings::SettingMemento resetOrder(storm::settings::mutableManager().getModule(storm::settings::modules::BuildSettings::moduleName), "ddorder", false);
+        std::vector<storm::expressions::Variable> declarationOrder = storm::builder::getDdVariableOrder(program);
+        std::shared_ptr<storm::models::symbolic::Model<DdType>> prismModel = storm::builder::DdPrismModelBuilder<DdType>().build(program);
+        std::shared_ptr<storm::models::symbolic::Model<DdType>> janiModelDeclaration = storm::builder::DdJaniModelBuilder<DdType, double>().build(janiModel);
+        EXPECT_EQ(numberOfStates, prismModel->getNumberOfStates());
+        EXPECT_EQ(numberOfTransitions, prismModel->getNumberOfTransitions());
+        EXPECT_EQ(numberOfStates, janiModelDeclaration->getNumberOfStates());
+        EXPECT_EQ(numberOfTransitions, janiModelDeclaration->getNumberOfTransitions());
+        
+        // The FORCE order is a permutation of the declaration order and yields the same model.
+        storm::settings::mutableManager().setFromString("--" + storm::settings::modules::BuildSettings::moduleName + ":ddorder force");
+        std::vector<storm::expressions::Variable> forceOrder = storm::builder::getDdVariableOrder(program);
+        EXPECT_TRUE(std::is_permutation(forceOrder.begin(), forceOrder.end(), declarationOrder.begin(), declarationOrder.end()));
+        std::shared_ptr<storm::models::symbolic::Model<DdType>> prismModelForce = storm::builder::DdPrismModelBuilder<DdType>().build(program);
+        EXPECT_EQ(prismModel->getNumberOfStates(), prismModelForce->getNumberOfStates()) << filename;
+        EXPECT_EQ(prismModel->getNumberOfTransitions(), prismModelForce->getNumberOfTransitions()) << filename;
+        std::shared_ptr<storm::models::symbolic::Model<DdType>> janiModelForce = storm::builder::DdJaniModelBuilder<DdType, double>().build(janiModel);
+        EXPECT_EQ(janiModelDeclaration->getNumberOfStates(), janiModelForce->getNumberOfStates()) << filename;
+        EXPECT_EQ(janiModelDeclaration->getNumberOfTransitions(), janiModelForce->getNumberOfTransitions()) << filename;
+        
+        storm::settings::mutableManager().setFromString("--" + storm::settings::modules::BuildSettings::moduleName + ":ddorder declaration");
+    }
+}
+
+TEST(DdVariableOrderingTest, ForcePreservesModel_Cudd) {
+    checkForceOrderPreservesModel<storm::dd::DdType::CUDD>(STORM_TEST_RESOURCES_DIR "/dtmc/leader-3-5.pm", 273ul, 397ul);
+    checkForceOrderPreservesModel<storm::dd::DdType::CUDD>(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm", 169ul, 436ul);
+    checkForceOrderPreservesModel<storm::dd::DdType::CUDD>(STORM_TEST_RESOURCES_DIR "/mdp/leader3.nm", 364ul, 654ul);
+}
+
+TEST(DdVariableOrderingTest, ForcePreservesModel_Sylvan) {
+    checkForceOrderPreservesModel<storm::dd::DdType::Sylvan>(STORM_TEST_RESOURCES_DIR "/dtmc/leader-3-5.pm", 273ul, 397ul);
+    checkForceOrderPreservesModel<storm::dd::DdType::Sylvan>(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm", 169ul, 436ul);
+    checkForceOrderPreservesModel<storm::dd::DdType::Sylvan>(STORM_TEST_RESOURCES_DIR "/mdp/leader3.nm", 364ul, 654ul);
+}
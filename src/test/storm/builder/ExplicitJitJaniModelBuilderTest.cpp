@@ -8,6 +8,12 @@
 #include "storm/storage/jani/Model.h"
 
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/JitBuilderSettings.h"
+#include "storm/storage/SymbolicModelDescription.h"
+
+#include <algorithm>
+
+#include <boost/filesystem.hpp>
 
 TEST(ExplicitJitJaniModelBuilderTest, Dtmc) {
     storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
@@ -158,3 +164,48 @@ TEST(ExplicitJitJaniModelBuilderTest, IllegalSynchronizingWrites) {
     ASSERT_THROW(storm::builder::jit::ExplicitJitJaniModelBuilder<double>(janiModel, options).build(), storm::exceptions::WrongFormatException);
 }
 
+
+TEST(ExplicitJitJaniModelBuilderTest, CompileCacheAndLoadTimeConstants) {
+    std::string input = R"(dtmc
+const double p;
+module main
+    s : [0..2] init 0;
+    [] s=0 -> p : (s'=1) + (1-p) : (s'=2);
+    [] s>0 -> true;
+endmodule
+)";
+    storm::storage::SymbolicModelDescription description(storm::parser::PrismParser::parseFromString(input, "coin.pm").toJani());
+    
+    boost::filesystem::path cacheDirectory = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("storm-jit-cache-%%%%-%%%%-%%%%");
+    storm::settings::mutableManager().setFromString("--" + storm::settings::modules::JitBuilderSettings::moduleName + ":cache " + cacheDirectory.string() + " --" + storm::settings::modules::JitBuilderSettings::moduleName + ":loadtimeconstants");
+    storm::settings::modules::ModuleSettings& jitSettings = storm::settings::mutableManager().getModule(storm::settings::modules::JitBuilderSettings::moduleName);
+    storm::settings::SettingMemento resetCache(jitSettings, "cache", false);
+    storm::settings::SettingMemento resetLoadTimeConstants(jitSettings, "loadtimeconstants", false);
+    
+    // As long as the constants are kept symbolic, one compiled builder serves all values of the constant.
+    std::vector<double> values = {0.3, 0.7};
+    for (uint64_t index = 0; index < values.size(); ++index) {
+        std::string definition = "p=" + std::to_string(values[index]);
+        storm::jani::Model janiModel = description.preprocess(description.parseConstantDefinitions(definition), false).asJaniModel();
+        storm::builder::jit::ExplicitJitJaniModelBuilder<double> builder(janiModel);
+        EXPECT_EQ(index > 0, builder.isCompiledLibraryCached()) << definition;
+        
+        std::shared_ptr<storm::models::sparse::Model<double>> model = builder.build();
+        EXPECT_EQ(3ul, model->getNumberOfStates());
+        std::vector<double> probabilities;
+        for (auto const& entry : model->getTransitionMatrix().getRow(*model->getInitialStates().begin())) {
+            probabilities.push_back(entry.getValue());
+        }
+        std::sort(probabilities.begin(), probabilities.end());
+        ASSERT_EQ(2ul, probabilities.size());
+        EXPECT_NEAR(std::min(values[index], 1 - values[index]), probabilities[0], 1e-12) << definition;
+        EXPECT_NEAR(std::max(values[index], 1 - values[index]), probabilities[1], 1e-12) << definition;
+        EXPECT_TRUE(builder.isCompiledLibraryCached());
+    }
+    
+    // Once the constant is substituted, its value is compiled into the builder, so there is no cached builder yet.
+    storm::jani::Model substitutedModel = description.preprocess(description.parseConstantDefinitions("p=0.5")).asJaniModel();
+    EXPECT_FALSE(storm::builder::jit::ExplicitJitJaniModelBuilder<double>(substitutedModel).isCompiledLibraryCached());
+    
+    boost::filesystem::remove_all(cacheDirectory);
+}
@@ -4,6 +4,9 @@
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm-parsers/parser/PrismParser.h"
 #include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/api/storm.h"
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 
 
 TEST(ExplicitPrismModelBuilderTest, Dtmc) {
@@ -125,3 +128,126 @@ TEST(ExplicitPrismModelBuilderTest, FailComposition) {
 
     ASSERT_THROW(storm::builder::ExplicitModelBuilder<double>(program).build(), storm::exceptions::WrongFormatException);
 }
+
+TEST(ExplicitPrismModelBuilderTest, SymmetryReduction) {
+    std::string input = R"(dtmc
+
+module coin1
+    c1 : [0..2] init 0;
+    [] c1=0 -> 0.5 : (c1'=1) + 0.5 : (c1'=2);
+    [] c1>0 -> true;
+endmodule
+
+module coin2 = coin1 [c1=c2] endmodule
+module coin3 = coin1 [c1=c3] endmodule
+)";
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(input, "coins.pm");
+    
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program).build();
+    EXPECT_EQ(27ul, model->getNumberOfStates());
+    
+    storm::builder::BuilderOptions options;
+    options.setApplySymmetryReduction();
+    model = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+    EXPECT_EQ(10ul, model->getNumberOfStates());
+    
+    // If a label distinguishes the copies, the modules are not symmetric.
+    options.addLabel(program.getManager().getVariableExpression("c1") == program.getManager().integer(1));
+    model = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+    EXPECT_EQ(27ul, model->getNumberOfStates());
+}
+
+TEST(ExplicitPrismModelBuilderTest, PartialOrderReduction) {
+    std::string input = R"(mdp
+
+module p1
+    a : [0..3] init 0;
+    [] a<3 -> (a'=a+1);
+    [] a=3 -> true;
+endmodule
+
+module p2
+    b : [0..3] init 0;
+    [] b<3 -> (b'=b+1);
+    [] b=3 -> true;
+endmodule
+)";
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(input, "processes.nm");
+    
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program).build();
+    EXPECT_EQ(16ul, model->getNumberOfStates());
+    
+    storm::builder::BuilderOptions options;
+    options.setApplyPartialOrderReduction();
+    model = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+    EXPECT_EQ(7ul, model->getNumberOfStates());
+    
+    // If a label observes both processes, no command is invisible.
+    options.addLabel(program.getManager().getVariableExpression("a") == program.getManager().getVariableExpression("b"));
+    model = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+    EXPECT_EQ(16ul, model->getNumberOfStates());
+    
+    // Only the second process is observed by the following properties. The reduction lets the first process move
+    // first, which changes the value of properties that count steps, so the reduction must not be applied for them.
+    std::vector<std::pair<std::string, std::pair<uint64_t, double>>> propertiesAndResults = {{"Pmax=? [F b=3]", {7ul, 1.0}}, {"Pmax=? [X b=1]", {16ul, 1.0}}, {"Pmax=? [F<=3 b=3]", {16ul, 1.0}}, {"Pmax=? [F b=3]; Pmax=? [F<=3 b=3]", {16ul, 1.0}}};
+    for (auto const& propertyAndResult : propertiesAndResults) {
+        auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(propertyAndResult.first, program));
+        storm::builder::BuilderOptions formulaOptions(formulas);
+        formulaOptions.setApplyPartialOrderReduction();
+        EXPECT_EQ(formulas.size() == 1 && propertyAndResult.first == "Pmax=? [F b=3]", formulaOptions.arePreservedFormulasStutterInvariant()) << propertyAndResult.first;
+        model = storm::builder::ExplicitModelBuilder<double>(program, formulaOptions).build();
+        EXPECT_EQ(propertyAndResult.second.first, model->getNumberOfStates()) << propertyAndResult.first;
+        
+        std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithSparseEngine<double>(model, storm::api::createTask<double>(formulas.back(), true));
+        ASSERT_TRUE(result);
+        EXPECT_NEAR(propertyAndResult.second.second, result->asExplicitQuantitativeCheckResult<double>()[*model->getInitialStates().begin()], 1e-6) << propertyAndResult.first;
+    }
+}
+
+TEST(ExplicitPrismModelBuilderTest, PartialOrderReductionWithRewards) {
+    std::string input = R"(mdp
+
+module M
+    x : [0..1] init 0;
+    [] x=0 -> (x'=1);
+    [] x=1 -> true;
+endmodule
+
+module N
+    g : bool init false;
+    [] !g -> (g'=true);
+    [] g -> true;
+endmodule
+
+label "goal" = g;
+
+rewards
+    true : 1;
+endrewards
+)";
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(input, "rewards.nm");
+    
+    // The step of M is invisible, so the reduction lets M move first.
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("Pmax=? [F \"goal\"]", program));
+    storm::builder::BuilderOptions options(formulas);
+    options.setApplyPartialOrderReduction();
+    EXPECT_TRUE(options.arePreservedFormulasStutterInvariant());
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+    EXPECT_GT(4ul, model->getNumberOfStates());
+    
+    // Building the rewards prevents the reduction.
+    options.setBuildAllRewardModels();
+    model = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+    EXPECT_EQ(4ul, model->getNumberOfStates());
+    
+    // Forcing the step of M would collect a reward of 2 instead of 1 before reaching the goal.
+    formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("Rmin=? [F \"goal\"]", program));
+    storm::builder::BuilderOptions rewardOptions(formulas);
+    rewardOptions.setApplyPartialOrderReduction();
+    EXPECT_FALSE(rewardOptions.arePreservedFormulasStutterInvariant());
+    model = storm::builder::ExplicitModelBuilder<double>(program, rewardOptions).build();
+    EXPECT_EQ(4ul, model->getNumberOfStates());
+    std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithSparseEngine<double>(model, storm::api::createTask<double>(formulas.front(), true));
+    ASSERT_TRUE(result);
+    EXPECT_NEAR(1.0, result->asExplicitQuantitativeCheckResult<double>()[*model->getInitialStates().begin()], 1e-6);
+}
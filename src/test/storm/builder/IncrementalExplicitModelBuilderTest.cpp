@@ -0,0 +1,100 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#include "storm/api/storm.h"
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/builder/IncrementalExplicitModelBuilder.h"
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/storage/SymbolicModelDescription.h"
+#include "storm/utility/cli.h"
+
+namespace {
+    // The state s=1 is only reachable if p is positive, so p=0 changes the structure of the model.
+    std::string const sweptProgram = R"(dtmc
+const double p;
+module main
+    s : [0..3] init 0;
+    [] s=0 -> p : (s'=1) + (1-p) : (s'=2);
+    [] s=1 -> 0.5 : (s'=2) + 0.5 : (s'=3);
+    [] s=2 -> 1 : (s'=2);
+    [] s=3 -> 1 : (s'=3);
+endmodule
+)";
+}
+
+TEST(IncrementalExplicitModelBuilderTest, ParseConstantsSweep) {
+    std::vector<std::string> sweepPoints = storm::utility::cli::parseConstantsSweepString("p=0.5; p=0.25;;p=0 ;");
+    ASSERT_EQ(3ul, sweepPoints.size());
+    EXPECT_EQ("p=0.5", sweepPoints[0]);
+    EXPECT_EQ("p=0.25", sweepPoints[1]);
+    EXPECT_EQ("p=0", sweepPoints[2]);
+    EXPECT_TRUE(storm::utility::cli::parseConstantsSweepString("").empty());
+}
+
+TEST(IncrementalExplicitModelBuilderTest, AlternatingSweep) {
+    storm::storage::SymbolicModelDescription model(storm::parser::PrismParser::parseFromString(sweptProgram, "sweep.pm"));
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("P=? [F s=3]", model.asPrismProgram()));
+    ASSERT_TRUE(storm::builder::IncrementalExplicitModelBuilder<double>::canHandle(model));
+    storm::builder::IncrementalExplicitModelBuilder<double> builder(model, storm::builder::BuilderOptions(formulas));
+
+    // Alternate between valuations that preserve the structure and ones that do not. After a rebuild from scratch, the
+    // next structure-preserving valuation must not be reported as incremental as the state space changed in between.
+    std::vector<std::pair<std::string, bool>> sweep = {{"p=0.5", false}, {"p=0.25", true}, {"p=0", false}, {"p=0.75", false}, {"p=0.125", true}, {"p=0", false}, {"p=0", false}, {"p=0.5", false}};
+    boost::optional<std::vector<double>> resultHint;
+    for (auto const& sweepPoint : sweep) {
+        std::shared_ptr<storm::models::sparse::Model<double>> sparseModel = builder.build(model.parseConstantDefinitions(sweepPoint.first));
+        EXPECT_EQ(sweepPoint.second, builder.isLastBuildIncremental()) << sweepPoint.first;
+        if (!builder.isLastBuildIncremental()) {
+            resultHint = boost::none;
+        }
+
+        std::shared_ptr<storm::models::sparse::Model<double>> referenceModel = storm::api::buildSparseModel<double>(model.preprocess(sweepPoint.first), formulas);
+        ASSERT_EQ(referenceModel->getNumberOfStates(), sparseModel->getNumberOfStates()) << sweepPoint.first;
+        EXPECT_EQ(referenceModel->getNumberOfTransitions(), sparseModel->getNumberOfTransitions()) << sweepPoint.first;
+        EXPECT_EQ(sweepPoint.first == "p=0" ? 2ul : 4ul, sparseModel->getNumberOfStates()) << sweepPoint.first;
+
+        std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithSparseEngineUsingResultHint<double>(sparseModel, storm::api::createTask<double>(formulas.front(), false), resultHint);
+        std::unique_ptr<storm::modelchecker::CheckResult> referenceResult = storm::api::verifyWithSparseEngine<double>(referenceModel, storm::api::createTask<double>(formulas.front(), false));
+        ASSERT_TRUE(result && referenceResult);
+        ASSERT_TRUE(resultHint);
+        EXPECT_EQ(sparseModel->getNumberOfStates(), resultHint->size());
+        auto const& values = result->asExplicitQuantitativeCheckResult<double>().getValueVector();
+        auto const& referenceValues = referenceResult->asExplicitQuantitativeCheckResult<double>().getValueVector();
+        ASSERT_EQ(referenceValues.size(), values.size());
+        for (uint64_t state = 0; state < values.size(); ++state) {
+            EXPECT_NEAR(referenceValues[state], values[state], 1e-6) << sweepPoint.first;
+        }
+    }
+}
+
+TEST(IncrementalExplicitModelBuilderTest, StaleResultHint) {
+    storm::storage::SymbolicModelDescription model(storm::parser::PrismParser::parseFromString(sweptProgram, "sweep.pm"));
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("P=? [F s=3]", model.asPrismProgram()));
+    std::shared_ptr<storm::models::sparse::Model<double>> sparseModel = storm::api::buildSparseModel<double>(model.preprocess("p=0"), formulas);
+    ASSERT_EQ(2ul, sparseModel->getNumberOfStates());
+
+    // A hint that stems from a model with a different number of states is dropped rather than used.
+    boost::optional<std::vector<double>> resultHint = std::vector<double>({0.25, 0.5, 0.0, 1.0});
+    std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithSparseEngineUsingResultHint<double>(sparseModel, storm::api::createTask<double>(formulas.front(), false), resultHint);
+    ASSERT_TRUE(result);
+    ASSERT_TRUE(resultHint);
+    EXPECT_EQ(2ul, resultHint->size());
+    for (auto const& value : result->asExplicitQuantitativeCheckResult<double>().getValueVector()) {
+        EXPECT_EQ(0.0, value);
+    }
+}
+
+TEST(IncrementalExplicitModelBuilderTest, InvalidDistribution) {
+    storm::storage::SymbolicModelDescription model(storm::parser::PrismParser::parseFromString(sweptProgram, "sweep.pm"));
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("P=? [F s=3]", model.asPrismProgram()));
+    storm::builder::IncrementalExplicitModelBuilder<double> builder(model, storm::builder::BuilderOptions(formulas));
+    EXPECT_EQ(4ul, builder.build(model.parseConstantDefinitions("p=0.5"))->getNumberOfStates());
+
+    // Values outside of [0,1] yield negative probabilities, no matter whether the model is updated or rebuilt.
+    EXPECT_THROW(builder.build(model.parseConstantDefinitions("p=1.5")), storm::exceptions::WrongFormatException);
+    EXPECT_THROW(builder.build(model.parseConstantDefinitions("p=-0.5")), storm::exceptions::WrongFormatException);
+    EXPECT_EQ(4ul, builder.build(model.parseConstantDefinitions("p=0.25"))->getNumberOfStates());
+}
@@ -0,0 +1,141 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#include <atomic>
+#include <thread>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/solver/stateelimination/ArithmeticCache.h"
+#include "storm/utility/constants.h"
+#include "storm-parsers/parser/ValueParser.h"
+
+namespace {
+    std::vector<storm::RationalFunction> parseFunctions(std::vector<std::string> const& functions) {
+        storm::parser::ValueParser<storm::RationalFunction> parser;
+        parser.addParameter("p");
+        parser.addParameter("q");
+        std::vector<storm::RationalFunction> result;
+        for (auto const& function : functions) {
+            result.push_back(parser.parseValue(function));
+        }
+        return result;
+    }
+}
+
+TEST(ArithmeticCacheTest, HitsAndMisses) {
+    std::vector<storm::RationalFunction> functions = parseFunctions({"p", "1-p", "q/(1-p)"});
+    storm::RationalFunction const& f = functions[0];
+    storm::RationalFunction const& g = functions[1];
+    storm::RationalFunction const& h = functions[2];
+    storm::solver::stateelimination::ArithmeticCache<storm::RationalFunction> cache(100);
+
+    // Products and sums are commutative, so swapping the operands hits the cache.
+    storm::RationalFunction product = cache.multiply(f, g);
+    EXPECT_EQ(storm::utility::simplify((storm::RationalFunction) (f * g)), product);
+    EXPECT_EQ(0ul, cache.getNumberOfHits());
+    EXPECT_EQ(1ul, cache.getNumberOfMisses());
+    EXPECT_EQ(product, cache.multiply(g, f));
+    EXPECT_EQ(1ul, cache.getNumberOfHits());
+
+    storm::RationalFunction sum = cache.add(g, h);
+    EXPECT_EQ(storm::utility::simplify((storm::RationalFunction) (g + h)), sum);
+    EXPECT_EQ(sum, cache.add(g, h));
+    EXPECT_EQ(2ul, cache.getNumberOfHits());
+    EXPECT_EQ(2ul, cache.getNumberOfMisses());
+
+    storm::RationalFunction unsimplified = g * h;
+    storm::RationalFunction simplified = cache.simplify(unsimplified);
+    EXPECT_EQ(storm::utility::simplify(unsimplified), simplified);
+    EXPECT_EQ(simplified, cache.simplify(unsimplified));
+    EXPECT_EQ(3ul, cache.getNumberOfHits());
+    EXPECT_EQ(3ul, cache.getNumberOfMisses());
+    EXPECT_EQ(3ul, cache.getNumberOfEntries());
+
+    // Operations on constants are not cached.
+    storm::RationalFunction two = storm::utility::convertNumber<storm::RationalFunction>(2.0);
+    EXPECT_EQ(storm::utility::simplify((storm::RationalFunction) (f * two)), cache.multiply(f, two));
+    EXPECT_EQ(storm::utility::simplify((storm::RationalFunction) (two + two)), cache.add(two, two));
+    EXPECT_EQ(3ul, cache.getNumberOfHits());
+    EXPECT_EQ(3ul, cache.getNumberOfMisses());
+    EXPECT_EQ(3ul, cache.getNumberOfEntries());
+
+    cache.clear();
+    EXPECT_EQ(0ul, cache.getNumberOfEntries());
+    EXPECT_EQ(product, cache.multiply(f, g));
+    EXPECT_EQ(4ul, cache.getNumberOfMisses());
+
+    // A cache of size zero is disabled.
+    storm::solver::stateelimination::ArithmeticCache<storm::RationalFunction> disabledCache(0);
+    EXPECT_EQ(product, disabledCache.multiply(f, g));
+    EXPECT_EQ(product, disabledCache.multiply(f, g));
+    EXPECT_EQ(0ul, disabledCache.getNumberOfHits());
+    EXPECT_EQ(0ul, disabledCache.getNumberOfMisses());
+    EXPECT_EQ(0ul, disabledCache.getNumberOfEntries());
+
+    // Other value types are computed directly.
+    storm::solver::stateelimination::ArithmeticCache<double> doubleCache(100);
+    EXPECT_EQ(0.375, doubleCache.multiply(0.5, 0.75));
+    EXPECT_EQ(1.25, doubleCache.add(0.5, 0.75));
+    EXPECT_EQ(0ul, doubleCache.getNumberOfMisses());
+    EXPECT_EQ(0ul, doubleCache.getNumberOfEntries());
+}
+
+TEST(ArithmeticCacheTest, BoundedSize) {
+    std::vector<std::string> functionStrings;
+    for (uint64_t index = 1; index <= 20; ++index) {
+        functionStrings.push_back("p+" + std::to_string(index));
+    }
+    std::vector<storm::RationalFunction> functions = parseFunctions(functionStrings);
+    storm::RationalFunction p = parseFunctions({"p"}).front();
+
+    storm::solver::stateelimination::ArithmeticCache<storm::RationalFunction> cache(4);
+    for (auto const& function : functions) {
+        EXPECT_EQ(storm::utility::simplify((storm::RationalFunction) (p * function)), cache.multiply(p, function));
+        EXPECT_LE(cache.getNumberOfEntries(), 4ul);
+    }
+    EXPECT_EQ(0ul, cache.getNumberOfHits());
+    EXPECT_EQ(20ul, cache.getNumberOfMisses());
+
+    // The most recent results are still contained.
+    cache.multiply(functions.back(), p);
+    EXPECT_EQ(1ul, cache.getNumberOfHits());
+}
+
+TEST(ArithmeticCacheTest, Concurrent) {
+    std::vector<std::string> functionStrings;
+    for (uint64_t index = 1; index <= 10; ++index) {
+        functionStrings.push_back("(p+" + std::to_string(index) + ")/(q+" + std::to_string(index) + ")");
+    }
+    std::vector<storm::RationalFunction> functions = parseFunctions(functionStrings);
+
+    storm::solver::stateelimination::ArithmeticCache<storm::RationalFunction> cache(1000);
+    uint64_t const numberOfThreads = 4;
+    uint64_t const numberOfRounds = 3;
+    std::atomic<uint64_t> numberOfWrongResults(0);
+    std::vector<std::thread> threads;
+    for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+        threads.emplace_back([&functions, &cache, &numberOfWrongResults, thread] () {
+            for (uint64_t round = 0; round < numberOfRounds; ++round) {
+                for (uint64_t first = 0; first < functions.size(); ++first) {
+                    // Every thread traverses the functions in a different order.
+                    storm::RationalFunction const& firstFunction = functions[(first + thread) % functions.size()];
+                    for (auto const& secondFunction : functions) {
+                        if (cache.multiply(firstFunction, secondFunction) != storm::utility::simplify((storm::RationalFunction) (firstFunction * secondFunction))) {
+                            ++numberOfWrongResults;
+                        }
+                    }
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(0ul, numberOfWrongResults.load());
+    EXPECT_EQ(numberOfThreads * numberOfRounds * functions.size() * functions.size(), cache.getNumberOfHits() + cache.getNumberOfMisses());
+
+    // Each unordered pair of functions is stored once, but may be computed by several threads at the same time.
+    EXPECT_EQ(55ul, cache.getNumberOfEntries());
+    EXPECT_LE(55ul, cache.getNumberOfMisses());
+}
@@ -93,6 +93,37 @@ namespace {
         }
     };
     
+    class NativeDoubleSoundGaussSeidelEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().setForceSoundness(true);
+            env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+            env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::GaussSeidel);
+            env.solver().native().setRelativeTerminationCriterion(false);
+            env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-6"));
+            return env;
+        }
+    };
+    
+    class NativeDoubleSoundSorEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().setForceSoundness(true);
+            env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+            env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::SOR);
+            env.solver().native().setSorOmega(storm::utility::convertNumber<storm::RationalNumber, std::string>("0.9"));
+            env.solver().native().setRelativeTerminationCriterion(false);
+            env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-6"));
+            return env;
+        }
+    };
+    
     class NativeDoubleWalkerChaeEnvironment {
     public:
         typedef double ValueType;
@@ -266,6 +297,19 @@ namespace {
         }
     };
     
+    class EigenRationalFloatingPointGuidedLUEnvironment {
+    public:
+        typedef storm::RationalNumber ValueType;
+        static const bool isExact = true;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Eigen);
+            env.solver().eigen().setMethod(storm::solver::EigenLinearEquationSolverMethod::SparseLU);
+            env.solver().eigen().setFloatingPointGuided(true);
+            return env;
+        }
+    };
+    
     class TopologicalEigenRationalLUEnvironment {
     public:
         typedef storm::RationalNumber ValueType;
@@ -298,6 +342,8 @@ namespace {
             NativeDoubleJacobiEnvironment,
             NativeDoubleGaussSeidelEnvironment,
             NativeDoubleSorEnvironment,
+            NativeDoubleSoundGaussSeidelEnvironment,
+            NativeDoubleSoundSorEnvironment,
             NativeDoubleWalkerChaeEnvironment,
             NativeRationalRationalSearchEnvironment,
             EliminationRationalEnvironment,
@@ -311,6 +357,7 @@ namespace {
             EigenBicgstabNoneEnvironment,
             EigenDoubleLUEnvironment,
             EigenRationalLUEnvironment,
+            EigenRationalFloatingPointGuidedLUEnvironment,
             TopologicalEigenRationalLUEnvironment
     > TestingTypes;
     
@@ -159,7 +159,87 @@ namespace {
         ASSERT_NO_THROW(solver->solveEquations(this->env(), storm::OptimizationDirection::Maximize, x, b));
         EXPECT_NEAR(x[0], this->parseNumber("0.99"), this->precision());
     }
+    
+    TYPED_TEST(MinMaxLinearEquationSolverTest, SolveEquationsChangingChoices) {
+        typedef typename TestFixture::ValueType ValueType;
+        
+        // Optimal choices of the first row group only become apparent after the choice of the last row group changed.
+        storm::storage::SparseMatrixBuilder<ValueType> builder(0, 0, 0, false, true);
+        ASSERT_NO_THROW(builder.newRowGroup(0));
+        ASSERT_NO_THROW(builder.addNextValue(0, 1, this->parseNumber("1")));
+        ASSERT_NO_THROW(builder.addNextValue(1, 2, this->parseNumber("1")));
+        ASSERT_NO_THROW(builder.newRowGroup(2));
+        ASSERT_NO_THROW(builder.newRowGroup(4));
+        
+        storm::storage::SparseMatrix<ValueType> A;
+        ASSERT_NO_THROW(A = builder.build(6, 3));
+        
+        std::vector<ValueType> x(3);
+        std::vector<ValueType> b = {this->parseNumber("0"), this->parseNumber("0"), this->parseNumber("0.5"), this->parseNumber("0.2"), this->parseNumber("0.4"), this->parseNumber("0.6")};
+        
+        auto factory = storm::solver::GeneralMinMaxLinearEquationSolverFactory<ValueType>();
+        auto solver = factory.create(this->env(), A);
+        solver->setHasUniqueSolution(true);
+        solver->setBounds(this->parseNumber("0"), this->parseNumber("1"));
+        storm::solver::MinMaxLinearEquationSolverRequirements req = solver->getRequirements(this->env());
+        req.clearBounds();
+        ASSERT_FALSE(req.hasEnabledRequirement());
+        ASSERT_NO_THROW(solver->solveEquations(this->env(), storm::OptimizationDirection::Maximize, x, b));
+        EXPECT_NEAR(x[0], this->parseNumber("0.6"), this->precision());
+        EXPECT_NEAR(x[1], this->parseNumber("0.5"), this->precision());
+        EXPECT_NEAR(x[2], this->parseNumber("0.6"), this->precision());
+        
+        ASSERT_NO_THROW(solver->solveEquations(this->env(), storm::OptimizationDirection::Minimize, x, b));
+        EXPECT_NEAR(x[0], this->parseNumber("0.2"), this->precision());
+        EXPECT_NEAR(x[1], this->parseNumber("0.2"), this->precision());
+        EXPECT_NEAR(x[2], this->parseNumber("0.4"), this->precision());
+    }
+    
+    TEST(TopologicalMinMaxLinearEquationSolverTest, AdaptivePrecisionSkipsIrrelevantSccs) {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::Topological);
+        env.solver().topological().setUnderlyingMinMaxMethod(storm::solver::MinMaxMethod::ValueIteration);
+        env.solver().topological().setAdaptivePrecision(true);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        
+        // States 0,1 and 2,3 form two disconnected SCCs. State 4 (trivially) leads to the SCC of states 0,1.
+        storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+        ASSERT_NO_THROW(builder.newRowGroup(0));
+        ASSERT_NO_THROW(builder.addNextValue(0, 1, 0.5));
+        ASSERT_NO_THROW(builder.newRowGroup(1));
+        ASSERT_NO_THROW(builder.addNextValue(1, 0, 0.5));
+        ASSERT_NO_THROW(builder.newRowGroup(2));
+        ASSERT_NO_THROW(builder.addNextValue(2, 3, 0.5));
+        ASSERT_NO_THROW(builder.newRowGroup(3));
+        ASSERT_NO_THROW(builder.addNextValue(3, 2, 0.5));
+        ASSERT_NO_THROW(builder.newRowGroup(4));
+        ASSERT_NO_THROW(builder.addNextValue(4, 0, 1.0));
+        ASSERT_NO_THROW(builder.addNextValue(5, 1, 0.5));
+        
+        storm::storage::SparseMatrix<double> A;
+        ASSERT_NO_THROW(A = builder.build(6, 5));
+        
+        std::vector<double> x(5, 0.0);
+        x[2] = 7.0;
+        x[3] = 7.0;
+        std::vector<double> b = {0.25, 0.25, 0.25, 0.25, 0.0, 0.1};
+        
+        auto solver = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>().create(env, A);
+        solver->setHasUniqueSolution(true);
+        solver->setBounds(0.0, 1.0);
+        storm::storage::BitVector relevantValues(5, false);
+        relevantValues.set(4, true);
+        solver->setRelevantValues(std::move(relevantValues));
+        storm::solver::MinMaxLinearEquationSolverRequirements req = solver->getRequirements(env);
+        req.clearBounds();
+        ASSERT_FALSE(req.hasEnabledRequirement());
+        ASSERT_NO_THROW(solver->solveEquations(env, storm::OptimizationDirection::Maximize, x, b));
+        EXPECT_NEAR(x[0], 0.5, 1e-6);
+        EXPECT_NEAR(x[1], 0.5, 1e-6);
+        EXPECT_NEAR(x[4], 0.5, 1e-6);
+        
+        // The values of the irrelevant SCC are not touched.
+        EXPECT_EQ(7.0, x[2]);
+        EXPECT_EQ(7.0, x[3]);
+    }
 }
-
-
-
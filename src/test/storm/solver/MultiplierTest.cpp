@@ -120,4 +120,52 @@ namespace {
         EXPECT_NEAR(x[0], this->parseNumber("0.923808265834023387639"), this->precision());
     }
     
-}
\ No newline at end of file
+    TYPED_TEST(MultiplierTest, multiplyAndReduceAndCheckConvergenceTest) {
+        typedef typename TestFixture::ValueType ValueType;
+    
+        storm::storage::SparseMatrixBuilder<ValueType> builder(0, 0, 0, false, true);
+        ASSERT_NO_THROW(builder.newRowGroup(0));
+        ASSERT_NO_THROW(builder.addNextValue(0, 0, this->parseNumber("0.9")));
+        ASSERT_NO_THROW(builder.addNextValue(0, 1, this->parseNumber("0.099")));
+        ASSERT_NO_THROW(builder.addNextValue(0, 2, this->parseNumber("0.001")));
+        ASSERT_NO_THROW(builder.addNextValue(1, 1, this->parseNumber("0.5")));
+        ASSERT_NO_THROW(builder.addNextValue(1, 2, this->parseNumber("0.5")));
+        ASSERT_NO_THROW(builder.newRowGroup(2));
+        ASSERT_NO_THROW(builder.addNextValue(2, 1, this->parseNumber("1")));
+        ASSERT_NO_THROW(builder.newRowGroup(3));
+        ASSERT_NO_THROW(builder.addNextValue(3, 2, this->parseNumber("1")));
+        
+        storm::storage::SparseMatrix<ValueType> A;
+        ASSERT_NO_THROW(A = builder.build());
+        
+        std::vector<ValueType> initialX = {this->parseNumber("0"), this->parseNumber("1"), this->parseNumber("0")};
+        std::vector<ValueType> fixpoint = {this->parseNumber("1"), this->parseNumber("1"), this->parseNumber("1")};
+        ValueType convergencePrecision = this->parseNumber("1e-6");
+        
+        auto factory = storm::solver::MultiplierFactory<ValueType>();
+        auto multiplier = factory.create(this->env(), A);
+        
+        std::vector<ValueType> expected(3);
+        std::vector<uint_fast64_t> expectedChoices(3, 0);
+        multiplier->multiplyAndReduce(this->env(), storm::OptimizationDirection::Maximize, initialX, nullptr, expected, &expectedChoices);
+        std::vector<ValueType> result(3);
+        std::vector<uint_fast64_t> choices(3, 0);
+        EXPECT_FALSE(multiplier->multiplyAndReduceAndCheckConvergence(this->env(), storm::OptimizationDirection::Maximize, initialX, nullptr, result, convergencePrecision, false, &choices));
+        for (uint64_t i = 0; i < 3; ++i) {
+            EXPECT_NEAR(expected[i], result[i], this->precision());
+            EXPECT_EQ(expectedChoices[i], choices[i]);
+        }
+        EXPECT_TRUE(multiplier->multiplyAndReduceAndCheckConvergence(this->env(), storm::OptimizationDirection::Minimize, fixpoint, nullptr, result, convergencePrecision, true));
+        
+        expected = initialX;
+        multiplier->multiplyAndReduceGaussSeidel(this->env(), storm::OptimizationDirection::Minimize, expected, nullptr);
+        result = initialX;
+        EXPECT_FALSE(multiplier->multiplyAndReduceGaussSeidelAndCheckConvergence(this->env(), storm::OptimizationDirection::Minimize, result, nullptr, convergencePrecision, false));
+        for (uint64_t i = 0; i < 3; ++i) {
+            EXPECT_NEAR(expected[i], result[i], this->precision());
+        }
+        result = fixpoint;
+        EXPECT_TRUE(multiplier->multiplyAndReduceGaussSeidelAndCheckConvergence(this->env(), storm::OptimizationDirection::Maximize, result, nullptr, convergencePrecision, true));
+    }
+    
+}
@@ -0,0 +1,85 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/FlexibleSparseMatrix.h"
+#include "storm/solver/stateelimination/PrioritizedStateEliminator.h"
+#include "storm/solver/stateelimination/StaticStatePriorityQueue.h"
+#include "storm/utility/constants.h"
+#include "storm-parsers/parser/ValueParser.h"
+
+namespace {
+
+    // Builds a chain in which every state moves forward with the given forward probability and backward with the
+    // given backward probability.
+    template<typename ValueType>
+    storm::storage::SparseMatrix<ValueType> createChain(uint64_t numberOfStates, ValueType const& forward, ValueType const& backward) {
+        storm::storage::SparseMatrixBuilder<ValueType> builder(numberOfStates, numberOfStates);
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            if (state > 0) {
+                builder.addNextValue(state, state - 1, backward);
+            }
+            if (state + 1 < numberOfStates) {
+                builder.addNextValue(state, state + 1, forward);
+            }
+        }
+        return builder.build();
+    }
+
+    // Builds a chain in which every state moves forward with probability 0.5, backward with probability 0.25 and
+    // reaches the target with probability 0.125.
+    storm::storage::SparseMatrix<double> createChain(uint64_t numberOfStates) {
+        return createChain<double>(numberOfStates, 0.5, 0.25);
+    }
+
+    template<typename ValueType>
+    ValueType eliminate(storm::storage::SparseMatrix<ValueType> const& matrix, ValueType const& targetProbability, uint64_t numberOfThreads) {
+        storm::storage::FlexibleSparseMatrix<ValueType> flexibleMatrix(matrix);
+        storm::storage::FlexibleSparseMatrix<ValueType> flexibleBackwardTransitions(matrix.transpose(true));
+        std::vector<ValueType> values(matrix.getRowCount(), targetProbability);
+
+        std::vector<storm::storage::sparse::state_type> states;
+        for (uint64_t state = 0; state < matrix.getRowCount(); ++state) {
+            states.push_back(state);
+        }
+        auto priorityQueue = std::make_shared<storm::solver::stateelimination::StaticStatePriorityQueue>(states);
+        storm::solver::stateelimination::PrioritizedStateEliminator<ValueType> eliminator(flexibleMatrix, flexibleBackwardTransitions, priorityQueue, values);
+        eliminator.eliminateAllInParallel(numberOfThreads, [] (storm::storage::sparse::state_type const& state) { return state != 0; });
+
+        EXPECT_TRUE(flexibleBackwardTransitions.empty());
+        return values[0];
+    }
+
+    double eliminate(storm::storage::SparseMatrix<double> const& matrix, uint64_t numberOfThreads) {
+        return eliminate<double>(matrix, 0.125, numberOfThreads);
+    }
+
+    TEST(StateEliminatorTest, ParallelElimination) {
+        storm::storage::SparseMatrix<double> matrix = createChain(40);
+
+        double sequentialResult = eliminate(matrix, 1);
+        EXPECT_NEAR(sequentialResult, eliminate(matrix, 2), 1e-12);
+        EXPECT_NEAR(sequentialResult, eliminate(matrix, 4), 1e-12);
+    }
+
+    TEST(StateEliminatorTest, ParametricEliminationIsSequential) {
+        EXPECT_EQ(4ul, storm::solver::stateelimination::PrioritizedStateEliminator<double>::getNumberOfEliminationThreads(4));
+        // The parametric arithmetic is not thread-safe, so the states are eliminated sequentially
+        EXPECT_EQ(1ul, storm::solver::stateelimination::PrioritizedStateEliminator<storm::RationalFunction>::getNumberOfEliminationThreads(1));
+        EXPECT_EQ(1ul, storm::solver::stateelimination::PrioritizedStateEliminator<storm::RationalFunction>::getNumberOfEliminationThreads(4));
+        EXPECT_EQ(1ul, storm::solver::stateelimination::PrioritizedStateEliminator<storm::RationalNumber>::getNumberOfEliminationThreads(4));
+
+        storm::parser::ValueParser<storm::RationalFunction> parser;
+        parser.addParameter("p");
+        storm::RationalFunction forward = parser.parseValue("p/2");
+        storm::RationalFunction backward = parser.parseValue("(1-p)/2");
+        storm::RationalFunction target = parser.parseValue("1/4");
+        storm::storage::SparseMatrix<storm::RationalFunction> matrix = createChain<storm::RationalFunction>(10, forward, backward);
+
+        storm::RationalFunction sequentialResult = eliminate<storm::RationalFunction>(matrix, target, 1);
+        EXPECT_FALSE(storm::utility::isConstant(sequentialResult));
+        EXPECT_EQ(storm::utility::simplify(sequentialResult), storm::utility::simplify(eliminate<storm::RationalFunction>(matrix, target, 4)));
+    }
+}
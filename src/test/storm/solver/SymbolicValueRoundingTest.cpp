@@ -0,0 +1,202 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "storm/solver/helper/SymbolicValueRounding.h"
+#include "storm/storage/dd/DdManager.h"
+#include "storm/storage/dd/Add.h"
+#include "storm/storage/dd/Bdd.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/utility/constants.h"
+#include "storm/api/builder.h"
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/modelchecker/prctl/SymbolicDtmcPrctlModelChecker.h"
+#include "storm/modelchecker/prctl/SymbolicMdpPrctlModelChecker.h"
+#include "storm/modelchecker/results/SymbolicQuantitativeCheckResult.h"
+#include "storm/models/symbolic/Dtmc.h"
+#include "storm/models/symbolic/Mdp.h"
+#include "storm/models/symbolic/StandardRewardModel.h"
+
+namespace {
+    storm::dd::Add<storm::dd::DdType::CUDD, double> createValues(storm::dd::DdManager<storm::dd::DdType::CUDD>& manager, storm::expressions::Variable const& variable, std::vector<double> const& values) {
+        storm::dd::Add<storm::dd::DdType::CUDD, double> result = manager.template getAddZero<double>();
+        for (uint64_t index = 0; index < values.size(); ++index) {
+            result += manager.getEncoding(variable, index).template toAdd<double>() * manager.getConstant(values[index]);
+        }
+        return result;
+    }
+
+    // A symmetric random walk whose probabilities to reach the upper end are s/N. Value iteration needs thousands of
+    // iterations to converge on it. In the MDP, the walk may also be forced downwards, which is never optimal.
+    std::string const randomWalk = R"(dtmc
+const int N = 40;
+module walk
+    s : [0..N] init N/2;
+    [] s>0 & s<N -> 0.5 : (s'=s-1) + 0.5 : (s'=s+1);
+    [] s=0 | s=N -> true;
+endmodule
+)";
+
+    std::string const randomWalkWithChoice = R"(mdp
+const int N = 40;
+module walk
+    s : [0..N] init N/2;
+    [] s>0 & s<N -> 0.5 : (s'=s-1) + 0.5 : (s'=s+1);
+    [] s>0 & s<N -> 1 : (s'=s-1);
+    [] s=0 | s=N -> true;
+endmodule
+)";
+
+    template<typename ModelType, typename CheckerType>
+    storm::dd::Add<storm::dd::DdType::CUDD, double> checkRandomWalk(std::string const& input, std::string const& property, storm::Environment const& env) {
+        storm::prism::Program program = storm::parser::PrismParser::parseFromString(input, "walk.prism");
+        auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(property, program));
+        std::shared_ptr<ModelType> model = storm::api::buildSymbolicModel<storm::dd::DdType::CUDD, double>(program, formulas)->template as<ModelType>();
+        CheckerType checker(*model);
+        std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(env, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formulas.front()));
+        storm::dd::Add<storm::dd::DdType::CUDD, double> values = result->asSymbolicQuantitativeCheckResult<storm::dd::DdType::CUDD, double>().getValueVector();
+
+        // Compare the result to the exact probabilities s/N.
+        storm::expressions::Variable const& s = *model->getRowVariables().begin();
+        storm::dd::Add<storm::dd::DdType::CUDD, double> exactValues = model->getReachableStates().template toAdd<double>() * model->getManager().template getIdentity<double>(s) * model->getManager().getConstant(1.0 / 40.0);
+        EXPECT_TRUE(values.equalModuloPrecision(exactValues, 1e-4, false));
+        return values;
+    }
+}
+
+TEST(SymbolicValueRoundingTest, Grid) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> manager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 0, 3);
+    storm::dd::Add<storm::dd::DdType::CUDD, double> values = createValues(*manager, x.first, {0.1, 0.1001, 0.2, 0.2004});
+    EXPECT_EQ(4ul, values.getLeafCount());
+
+    storm::solver::helper::SymbolicValueRounding<storm::dd::DdType::CUDD, double> rounding(boost::none, storm::utility::convertNumber<storm::RationalNumber>(0.01));
+    ASSERT_TRUE(rounding.isActive());
+    storm::dd::Add<storm::dd::DdType::CUDD, double> rounded = rounding.round(values, 0.01, false);
+    EXPECT_EQ(2ul, rounded.getLeafCount());
+    EXPECT_TRUE(rounded.equalModuloPrecision(values, 0.01, false));
+    EXPECT_NEAR(0.2, rounded.getValue({{x.first, 3}}), 1e-12);
+    EXPECT_NEAR(0.0004, rounding.getMaximalError(), 1e-12);
+    EXPECT_EQ(1ul, rounding.getNumberOfRoundings());
+    EXPECT_EQ(0ul, rounding.getNumberOfRefinements());
+}
+
+TEST(SymbolicValueRoundingTest, SignificantBits) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> manager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 0, 3);
+    storm::dd::Add<storm::dd::DdType::CUDD, double> values = createValues(*manager, x.first, {0.1, 0.1001, 0.2, 0.2004});
+
+    // With 4 significant bits the error would exceed the precision, so the grid needs to be refined to 7 bits.
+    storm::solver::helper::SymbolicValueRounding<storm::dd::DdType::CUDD, double> rounding(4ull, boost::none);
+    storm::dd::Add<storm::dd::DdType::CUDD, double> rounded = rounding.round(values, 1e-3, false);
+    EXPECT_EQ(3ul, rounding.getNumberOfRefinements());
+    EXPECT_EQ(3ul, rounded.getLeafCount());
+    EXPECT_TRUE(rounded.equalModuloPrecision(values, 1e-3, false));
+    EXPECT_EQ(rounded.getValue({{x.first, 0}}), rounded.getValue({{x.first, 1}}));
+
+    storm::solver::helper::SymbolicValueRounding<storm::dd::DdType::CUDD, double> inactiveRounding(boost::none, boost::none);
+    EXPECT_FALSE(inactiveRounding.isActive());
+    EXPECT_TRUE(inactiveRounding.round(values, 1e-3, false) == values);
+}
+
+TEST(SymbolicValueRoundingTest, MaximalError) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> manager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 0, 3);
+    storm::dd::Add<storm::dd::DdType::CUDD, double> values = createValues(*manager, x.first, {0.1, 0.1001, 0.2, 0.2004});
+
+    // Repeated roundings keep the rounding active and only record the largest error.
+    storm::solver::helper::SymbolicValueRounding<storm::dd::DdType::CUDD, double> rounding(boost::none, storm::utility::convertNumber<storm::RationalNumber>(0.01));
+    for (uint64_t iteration = 0; iteration < 10; ++iteration) {
+        EXPECT_EQ(2ul, rounding.round(values, 0.01, false).getLeafCount());
+    }
+    EXPECT_TRUE(rounding.isActive());
+    EXPECT_EQ(10ul, rounding.getNumberOfRoundings());
+    EXPECT_NEAR(0.0004, rounding.getMaximalError(), 1e-12);
+
+    // Relative errors are measured with respect to the unrounded values.
+    storm::solver::helper::SymbolicValueRounding<storm::dd::DdType::CUDD, double> relativeRounding(boost::none, storm::utility::convertNumber<storm::RationalNumber>(0.01));
+    relativeRounding.round(values, 0.01, true);
+    EXPECT_NEAR(0.0004 / 0.2004, relativeRounding.getMaximalError(), 1e-12);
+}
+
+TEST(SymbolicValueRoundingTest, Iteration) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> manager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 0, 15);
+
+    // Iterate x = x/2 + b, whose fixed point 2b has values that differ by far less than the precision.
+    std::vector<double> offsets;
+    std::vector<double> fixedPoint;
+    for (uint64_t index = 0; index < 16; ++index) {
+        offsets.push_back(0.5 + index * 1e-12);
+        fixedPoint.push_back(1.0 + 2 * index * 1e-12);
+    }
+    storm::dd::Add<storm::dd::DdType::CUDD, double> b = createValues(*manager, x.first, offsets);
+    storm::dd::Add<storm::dd::DdType::CUDD, double> half = manager->getConstant(0.5);
+    double const precision = 1e-8;
+
+    // Without rounding, every iterate distinguishes all values.
+    storm::dd::Add<storm::dd::DdType::CUDD, double> values = manager->template getAddZero<double>();
+    for (bool converged = false; !converged;) {
+        storm::dd::Add<storm::dd::DdType::CUDD, double> next = values * half + b;
+        converged = next.equalModuloPrecision(values, precision, false);
+        values = next;
+    }
+    EXPECT_EQ(16ul, values.getLeafCount());
+
+    // With rounding, the iterates stay small and the rounding is not deactivated until the rounded iteration converged.
+    storm::solver::helper::SymbolicValueRounding<storm::dd::DdType::CUDD, double> rounding(20ull, boost::none);
+    values = manager->template getAddZero<double>();
+    uint64_t roundedIterations = 0;
+    uint64_t maximalLeafCount = 0;
+    for (bool converged = false; !converged; ++roundedIterations) {
+        storm::dd::Add<storm::dd::DdType::CUDD, double> next = values * half + b;
+        converged = next.equalModuloPrecision(values, precision, false);
+        values = rounding.round(next, precision / 2, false);
+        maximalLeafCount = std::max<uint64_t>(maximalLeafCount, values.getLeafCount());
+        ASSERT_TRUE(rounding.isActive()) << "Iteration " << roundedIterations;
+    }
+    EXPECT_EQ(roundedIterations, rounding.getNumberOfRoundings());
+    EXPECT_LT(10ul, roundedIterations);
+    EXPECT_GE(2ul, maximalLeafCount);
+    EXPECT_LE(rounding.getMaximalError(), precision / 2);
+
+    // Continuing without rounding from the rounded iterate yields the fixed point up to the precision.
+    for (bool converged = false; !converged;) {
+        storm::dd::Add<storm::dd::DdType::CUDD, double> next = values * half + b;
+        converged = next.equalModuloPrecision(values, precision, false);
+        values = next;
+    }
+    EXPECT_TRUE(values.equalModuloPrecision(createValues(*manager, x.first, fixedPoint), 2 * precision, false));
+}
+
+TEST(SymbolicValueRoundingTest, PowerIterationOnDtmc) {
+    storm::Environment env;
+    env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+    env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Power);
+    env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+    env.solver().native().setRelativeTerminationCriterion(false);
+    env.solver().native().setMaximalNumberOfIterations(1000000);
+    auto unrounded = checkRandomWalk<storm::models::symbolic::Dtmc<storm::dd::DdType::CUDD, double>, storm::modelchecker::SymbolicDtmcPrctlModelChecker<storm::models::symbolic::Dtmc<storm::dd::DdType::CUDD, double>>>(randomWalk, "P=? [F s=N]", env);
+
+    env.solver().native().setDdRoundingBits(40ull);
+    auto rounded = checkRandomWalk<storm::models::symbolic::Dtmc<storm::dd::DdType::CUDD, double>, storm::modelchecker::SymbolicDtmcPrctlModelChecker<storm::models::symbolic::Dtmc<storm::dd::DdType::CUDD, double>>>(randomWalk, "P=? [F s=N]", env);
+    EXPECT_TRUE(rounded.equalModuloPrecision(unrounded, 1e-6, false));
+}
+
+TEST(SymbolicValueRoundingTest, ValueIterationOnMdp) {
+    storm::Environment env;
+    env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+    env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+    env.solver().minMax().setRelativeTerminationCriterion(false);
+    env.solver().minMax().setMaximalNumberOfIterations(1000000);
+    auto unrounded = checkRandomWalk<storm::models::symbolic::Mdp<storm::dd::DdType::CUDD, double>, storm::modelchecker::SymbolicMdpPrctlModelChecker<storm::models::symbolic::Mdp<storm::dd::DdType::CUDD, double>>>(randomWalkWithChoice, "Pmax=? [F s=N]", env);
+
+    env.solver().minMax().setDdRoundingGrid(storm::utility::convertNumber<storm::RationalNumber>(std::ldexp(1.0, -40)));
+    auto rounded = checkRandomWalk<storm::models::symbolic::Mdp<storm::dd::DdType::CUDD, double>, storm::modelchecker::SymbolicMdpPrctlModelChecker<storm::models::symbolic::Mdp<storm::dd::DdType::CUDD, double>>>(randomWalkWithChoice, "Pmax=? [F s=N]", env);
+    EXPECT_TRUE(rounded.equalModuloPrecision(unrounded, 1e-6, false));
+}
@@ -4,10 +4,18 @@
 #include "storm/storage/dd/DdManager.h"
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Odd.h"
+#include "storm/storage/dd/FlatOdd.h"
 #include "storm/storage/dd/DdMetaVariable.h"
 #include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/storage/expressions/Expression.h"
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/SettingMemento.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/models/symbolic/Mdp.h"
+#include "storm/models/symbolic/StandardRewardModel.h"
+#include "storm/storage/SymbolicModelDescription.h"
+#include "storm/builder/DdPrismModelBuilder.h"
+#include "storm-parsers/parser/PrismParser.h"
 
 #include "storm/storage/SparseMatrix.h"
 
@@ -515,6 +523,31 @@ TEST(CuddDd, OperatorTest) {
     EXPECT_FALSE(dd1.equalModuloPrecision(dd2, 1e-6));
 }
 
+TEST(CuddDd, BalancedSumTest) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> manager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 9);
+    
+    std::vector<storm::dd::Add<storm::dd::DdType::CUDD, double>> adds;
+    std::vector<storm::dd::Bdd<storm::dd::DdType::CUDD>> bdds;
+    storm::dd::Add<storm::dd::DdType::CUDD, double> expectedSum = manager->template getAddZero<double>();
+    for (int_fast64_t value = 1; value <= 9; ++value) {
+        storm::dd::Bdd<storm::dd::DdType::CUDD> encoding = manager->getEncoding(x.first, value);
+        bdds.push_back(encoding);
+        adds.push_back(encoding.template toAdd<double>() * manager->template getConstant<double>(static_cast<double>(value)));
+        expectedSum += adds.back();
+    }
+    
+    storm::dd::Add<storm::dd::DdType::CUDD, double> sum;
+    ASSERT_NO_THROW(sum = storm::dd::Add<storm::dd::DdType::CUDD, double>::sum(*manager, adds));
+    EXPECT_TRUE(sum == expectedSum);
+    EXPECT_EQ(9ul, sum.getNonZeroCount());
+    EXPECT_TRUE(sum.containsMetaVariable(x.first));
+    EXPECT_TRUE(storm::dd::Bdd<storm::dd::DdType::CUDD>::disjunction(*manager, bdds) == manager->getRange(x.first));
+    
+    EXPECT_TRUE(storm::dd::Add<storm::dd::DdType::CUDD, double>::sum(*manager, {}).isZero());
+    EXPECT_TRUE(storm::dd::Bdd<storm::dd::DdType::CUDD>::disjunction(*manager, {}).isZero());
+}
+
 TEST(CuddDd, AbstractionTest) {
     std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> manager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
     std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 9);
@@ -763,6 +796,78 @@ TEST(CuddDd, BddOddTest) {
     EXPECT_EQ(106ul, matrix.getNonzeroEntryCount());
 }
 
+TEST(CuddDd, FlatOddTest) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> manager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 9);
+    
+    storm::dd::Odd odd = manager->getRange(x.first).createOdd();
+    storm::dd::FlatOdd const& flatOdd = odd.getFlatOdd();
+    
+    // The flat ODD is only created once and then reused by all conversions.
+    EXPECT_EQ(&flatOdd, &odd.getFlatOdd());
+    EXPECT_EQ(manager->getRange(x.first).template toAdd<double>().toVector(odd), std::vector<double>(9, 1.0));
+    EXPECT_EQ(&flatOdd, &odd.getFlatOdd());
+    EXPECT_EQ(9ul, flatOdd.getTotalOffset());
+    EXPECT_EQ(odd.getHeight(), flatOdd.getHeight());
+    EXPECT_EQ(0ul, flatOdd.getFirstNodeIndexOfLevel(0));
+    EXPECT_EQ(flatOdd.getNodeCount(), flatOdd.getFirstNodeIndexOfLevel(flatOdd.getHeight()));
+    EXPECT_GE(odd.getNodeCount(), flatOdd.getNodeCount());
+    for (uint64_t offset = 0; offset < 9; ++offset) {
+        EXPECT_EQ(odd.getEncoding(offset), flatOdd.getEncoding(offset));
+    }
+    
+    // Expand the values of two states to the full range.
+    storm::dd::Odd subsetOdd = (manager->getEncoding(x.first, 2) || manager->getEncoding(x.first, 5)).createOdd();
+    std::vector<double> values = {1.0, 2.0};
+    std::vector<double> expandedValues(9, 0.0);
+    subsetOdd.expandExplicitVector(odd, values, expandedValues);
+    std::vector<double> expectedValues = {0.0, 1.0, 0.0, 0.0, 2.0, 0.0, 0.0, 0.0, 0.0};
+    EXPECT_EQ(expectedValues, expandedValues);
+}
+
+TEST(CuddDd, ParallelToMatrixTest) {
+    // Convert a DTMC, an MDP and a matrix whose row ODD has empty subtrees sequentially.
+    storm::prism::Program program = storm::storage::SymbolicModelDescription(storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm")).preprocess().asPrismProgram();
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::CUDD>> dtmc = storm::builder::DdPrismModelBuilder<storm::dd::DdType::CUDD>().build(program);
+    storm::dd::Odd dtmcOdd = dtmc->getReachableStates().createOdd();
+    storm::storage::SparseMatrix<double> dtmcMatrix = dtmc->getTransitionMatrix().toMatrix(dtmcOdd, dtmcOdd);
+    EXPECT_EQ(13ul, dtmcMatrix.getRowCount());
+    EXPECT_EQ(20ul, dtmcMatrix.getEntryCount());
+    
+    program = storm::storage::SymbolicModelDescription(storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm")).preprocess().asPrismProgram();
+    std::shared_ptr<storm::models::symbolic::Mdp<storm::dd::DdType::CUDD>> mdp = storm::builder::DdPrismModelBuilder<storm::dd::DdType::CUDD>().build(program)->as<storm::models::symbolic::Mdp<storm::dd::DdType::CUDD>>();
+    storm::dd::Odd mdpOdd = mdp->getReachableStates().createOdd();
+    storm::dd::Add<storm::dd::DdType::CUDD, double> choiceValues = mdp->getTransitionMatrix().maxAbstract(mdp->getColumnVariables());
+    storm::storage::SparseMatrix<double> mdpMatrix = mdp->getTransitionMatrix().toMatrix(mdp->getNondeterminismVariables(), mdpOdd, mdpOdd);
+    std::pair<storm::storage::SparseMatrix<double>, std::vector<double>> mdpMatrixVector = mdp->getTransitionMatrix().toMatrixVector(choiceValues, mdp->getNondeterminismVariables(), mdpOdd, mdpOdd);
+    EXPECT_EQ(169ul, mdpMatrix.getRowGroupCount());
+    EXPECT_EQ(254ul, mdpMatrix.getRowCount());
+    EXPECT_EQ(436ul, mdpMatrix.getEntryCount());
+    EXPECT_EQ(mdpMatrix, mdpMatrixVector.first);
+    
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> manager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 9);
+    storm::dd::Bdd<storm::dd::DdType::CUDD> rows = manager->getEncoding(x.first, 2) || manager->getEncoding(x.first, 5) || manager->getEncoding(x.first, 9);
+    storm::dd::Add<storm::dd::DdType::CUDD, double> dd = rows.template toAdd<double>() * manager->getRange(x.second).template toAdd<double>() * (manager->template getIdentity<double>(x.first) + manager->template getIdentity<double>(x.second));
+    storm::dd::Odd rowOdd = rows.createOdd();
+    storm::dd::Odd columnOdd = manager->getRange(x.second).createOdd();
+    storm::storage::SparseMatrix<double> matrix = dd.toMatrix({x.first}, {x.second}, rowOdd, columnOdd);
+    EXPECT_EQ(3ul, matrix.getRowCount());
+    EXPECT_EQ(9ul, matrix.getColumnCount());
+    EXPECT_EQ(27ul, matrix.getEntryCount());
+    
+    // With TBB enabled, the rows are split into blocks that are converted in parallel. The results must not change.
+    storm::settings::mutableManager().setFromString("--" + storm::settings::modules::CoreSettings::moduleName + ":enable-tbb");
+    storm::settings::SettingMemento disableTbb(storm::settings::mutableManager().getModule(storm::settings::modules::CoreSettings::moduleName), "enable-tbb", false);
+    ASSERT_TRUE(storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet());
+    EXPECT_EQ(dtmcMatrix, dtmc->getTransitionMatrix().toMatrix(dtmcOdd, dtmcOdd));
+    EXPECT_EQ(mdpMatrix, mdp->getTransitionMatrix().toMatrix(mdp->getNondeterminismVariables(), mdpOdd, mdpOdd));
+    std::pair<storm::storage::SparseMatrix<double>, std::vector<double>> parallelMdpMatrixVector = mdp->getTransitionMatrix().toMatrixVector(choiceValues, mdp->getNondeterminismVariables(), mdpOdd, mdpOdd);
+    EXPECT_EQ(mdpMatrixVector.first, parallelMdpMatrixVector.first);
+    EXPECT_EQ(mdpMatrixVector.second, parallelMdpMatrixVector.second);
+    EXPECT_EQ(matrix, dd.toMatrix({x.first}, {x.second}, rowOdd, columnOdd));
+}
+
 TEST(CuddDd, BddToExpressionTest) {
     std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> ddManager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
     std::pair<storm::expressions::Variable, storm::expressions::Variable> a = ddManager->addMetaVariable("a");
@@ -51,3 +51,38 @@ TEST(SchedulerTest, PartialDeterministicMemorylessScheduler) {
     ASSERT_FALSE(scheduler.getChoice(1).isDefined());
     ASSERT_FALSE(scheduler.getChoice(2).isDefined());
 }
+
+TEST(SchedulerTest, CompactRepresentation) {
+    storm::storage::Scheduler<double> scheduler(4);
+    ASSERT_TRUE(scheduler.hasCompactRepresentation());
+    
+    ASSERT_NO_THROW(scheduler.setChoice(1, 0));
+    ASSERT_NO_THROW(scheduler.setChoice(2, 1));
+    ASSERT_NO_THROW(scheduler.setChoice(0, 3));
+    
+    ASSERT_TRUE(scheduler.hasCompactRepresentation());
+    ASSERT_TRUE(scheduler.isPartialScheduler());
+    ASSERT_TRUE(scheduler.isDeterministicScheduler());
+    ASSERT_EQ(2ul, scheduler.getDeterministicChoice(1));
+    ASSERT_FALSE(scheduler.isChoiceDefined(2));
+    
+    std::vector<uint_fast64_t> rowGroupIndices = {0, 2, 5, 6, 7};
+    storm::storage::BitVector support = scheduler.computeActionSupport(rowGroupIndices);
+    ASSERT_EQ(3ul, support.getNumberOfSetBits());
+    ASSERT_TRUE(support.get(1));
+    ASSERT_TRUE(support.get(4));
+    ASSERT_TRUE(support.get(6));
+    
+    // Setting a randomized choice switches to the full representation.
+    storm::storage::Distribution<double, uint_fast64_t> distribution;
+    distribution.addProbability(0, 0.5);
+    distribution.addProbability(1, 0.5);
+    ASSERT_NO_THROW(scheduler.setChoice(distribution, 2));
+    
+    ASSERT_FALSE(scheduler.hasCompactRepresentation());
+    ASSERT_FALSE(scheduler.isPartialScheduler());
+    ASSERT_FALSE(scheduler.isDeterministicScheduler());
+    ASSERT_EQ(1ul, scheduler.getChoice(0).getDeterministicChoice());
+    ASSERT_EQ(2ul, scheduler.getDeterministicChoice(1));
+    ASSERT_EQ(0ul, scheduler.getChoice(3).getDeterministicChoice());
+}
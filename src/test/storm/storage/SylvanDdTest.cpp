@@ -8,6 +8,14 @@
 #include "storm/storage/dd/Odd.h"
 #include "storm/storage/dd/DdMetaVariable.h"
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/SettingMemento.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/models/symbolic/Mdp.h"
+#include "storm/models/symbolic/StandardRewardModel.h"
+#include "storm/storage/SymbolicModelDescription.h"
+#include "storm/builder/DdPrismModelBuilder.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/utility/dd.h"
 
 #include "storm/storage/SparseMatrix.h"
 
@@ -658,6 +666,68 @@ TEST(SylvanDd, OperatorTest) {
     EXPECT_FALSE(dd1.equalModuloPrecision(dd2, 1e-6));
 }
 
+TEST(SylvanDd, BalancedSumTest) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 9);
+    
+    std::vector<storm::dd::Add<storm::dd::DdType::Sylvan, double>> adds;
+    std::vector<storm::dd::Bdd<storm::dd::DdType::Sylvan>> bdds;
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> expectedSum = manager->template getAddZero<double>();
+    for (int_fast64_t value = 1; value <= 9; ++value) {
+        storm::dd::Bdd<storm::dd::DdType::Sylvan> encoding = manager->getEncoding(x.first, value);
+        bdds.push_back(encoding);
+        adds.push_back(encoding.template toAdd<double>() * manager->template getConstant<double>(static_cast<double>(value)));
+        expectedSum += adds.back();
+    }
+    
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> sum;
+    ASSERT_NO_THROW(sum = storm::dd::Add<storm::dd::DdType::Sylvan, double>::sum(*manager, adds));
+    EXPECT_TRUE(sum == expectedSum);
+    EXPECT_EQ(9ul, sum.getNonZeroCount());
+    EXPECT_TRUE(sum.containsMetaVariable(x.first));
+    EXPECT_TRUE(storm::dd::Bdd<storm::dd::DdType::Sylvan>::disjunction(*manager, bdds) == manager->getRange(x.first));
+    
+    EXPECT_TRUE(storm::dd::Add<storm::dd::DdType::Sylvan, double>::sum(*manager, {}).isZero());
+    EXPECT_TRUE(storm::dd::Bdd<storm::dd::DdType::Sylvan>::disjunction(*manager, {}).isZero());
+}
+
+TEST(SylvanDd, PartitionedReachabilityTest) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 0, 3);
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> y = manager->addMetaVariable("y", 0, 3);
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> xIdentity = manager->getIdentity(x.first, x.second);
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> yIdentity = manager->getIdentity(y.first, y.second);
+    
+    // x is incremented freely, y is incremented as long as it stays at most x and a synchronizing move jumps from (3,3) to (1,2).
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> xMoves = manager->getBddZero();
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> yMoves = manager->getBddZero();
+    for (int_fast64_t value = 0; value < 3; ++value) {
+        xMoves |= manager->getEncoding(x.first, value) && manager->getEncoding(x.second, value + 1);
+        for (int_fast64_t xValue = value + 1; xValue <= 3; ++xValue) {
+            yMoves |= manager->getEncoding(y.first, value) && manager->getEncoding(y.second, value + 1) && manager->getEncoding(x.first, xValue);
+        }
+    }
+    xMoves &= yIdentity;
+    yMoves &= xIdentity;
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> jump = manager->getEncoding(x.first, 3) && manager->getEncoding(y.first, 3) && manager->getEncoding(x.second, 1) && manager->getEncoding(y.second, 2);
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> transitions = xMoves || yMoves || jump;
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> initialStates = manager->getEncoding(x.first, 0) && manager->getEncoding(y.first, 0);
+    
+    std::vector<storm::dd::Bdd<storm::dd::DdType::Sylvan>> parts = storm::utility::dd::partitionTransitionRelation(transitions, {xIdentity, yIdentity});
+    ASSERT_EQ(3ul, parts.size());
+    EXPECT_TRUE(parts[0] == yMoves);
+    EXPECT_TRUE(parts[1] == xMoves);
+    EXPECT_TRUE(parts[2] == jump);
+    
+    std::set<storm::expressions::Variable> rowMetaVariables = {x.first, y.first};
+    std::set<storm::expressions::Variable> columnMetaVariables = {x.second, y.second};
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> reachableStates = storm::utility::dd::computeReachableStates(initialStates, transitions, rowMetaVariables, columnMetaVariables);
+    EXPECT_EQ(11ul, reachableStates.getNonZeroCount());
+    for (auto strategy : {storm::builder::SymbolicReachabilityStrategy::Bfs, storm::builder::SymbolicReachabilityStrategy::Chaining, storm::builder::SymbolicReachabilityStrategy::Saturation}) {
+        EXPECT_TRUE(reachableStates == storm::utility::dd::computeReachableStates(initialStates, parts, rowMetaVariables, columnMetaVariables, strategy));
+    }
+}
+
 TEST(SylvanDd, AbstractionTest) {
     std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
     std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 9);
@@ -939,6 +1009,49 @@ TEST(SylvanDd, BddOddTest) {
     EXPECT_EQ(106ul, matrix.getNonzeroEntryCount());
 }
 
+TEST(SylvanDd, ParallelToMatrixTest) {
+    // Convert a DTMC, an MDP and a matrix whose row ODD has empty subtrees sequentially.
+    storm::prism::Program program = storm::storage::SymbolicModelDescription(storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm")).preprocess().asPrismProgram();
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan>> dtmc = storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan>().build(program);
+    storm::dd::Odd dtmcOdd = dtmc->getReachableStates().createOdd();
+    storm::storage::SparseMatrix<double> dtmcMatrix = dtmc->getTransitionMatrix().toMatrix(dtmcOdd, dtmcOdd);
+    EXPECT_EQ(13ul, dtmcMatrix.getRowCount());
+    EXPECT_EQ(20ul, dtmcMatrix.getEntryCount());
+    
+    program = storm::storage::SymbolicModelDescription(storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm")).preprocess().asPrismProgram();
+    std::shared_ptr<storm::models::symbolic::Mdp<storm::dd::DdType::Sylvan>> mdp = storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan>().build(program)->as<storm::models::symbolic::Mdp<storm::dd::DdType::Sylvan>>();
+    storm::dd::Odd mdpOdd = mdp->getReachableStates().createOdd();
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> choiceValues = mdp->getTransitionMatrix().maxAbstract(mdp->getColumnVariables());
+    storm::storage::SparseMatrix<double> mdpMatrix = mdp->getTransitionMatrix().toMatrix(mdp->getNondeterminismVariables(), mdpOdd, mdpOdd);
+    std::pair<storm::storage::SparseMatrix<double>, std::vector<double>> mdpMatrixVector = mdp->getTransitionMatrix().toMatrixVector(choiceValues, mdp->getNondeterminismVariables(), mdpOdd, mdpOdd);
+    EXPECT_EQ(169ul, mdpMatrix.getRowGroupCount());
+    EXPECT_EQ(254ul, mdpMatrix.getRowCount());
+    EXPECT_EQ(436ul, mdpMatrix.getEntryCount());
+    EXPECT_EQ(mdpMatrix, mdpMatrixVector.first);
+    
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 9);
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> rows = manager->getEncoding(x.first, 2) || manager->getEncoding(x.first, 5) || manager->getEncoding(x.first, 9);
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> dd = rows.template toAdd<double>() * manager->getRange(x.second).template toAdd<double>() * (manager->template getIdentity<double>(x.first) + manager->template getIdentity<double>(x.second));
+    storm::dd::Odd rowOdd = rows.createOdd();
+    storm::dd::Odd columnOdd = manager->getRange(x.second).createOdd();
+    storm::storage::SparseMatrix<double> matrix = dd.toMatrix({x.first}, {x.second}, rowOdd, columnOdd);
+    EXPECT_EQ(3ul, matrix.getRowCount());
+    EXPECT_EQ(9ul, matrix.getColumnCount());
+    EXPECT_EQ(27ul, matrix.getEntryCount());
+    
+    // With TBB enabled, the rows are split into blocks that are converted in parallel. The results must not change.
+    storm::settings::mutableManager().setFromString("--" + storm::settings::modules::CoreSettings::moduleName + ":enable-tbb");
+    storm::settings::SettingMemento disableTbb(storm::settings::mutableManager().getModule(storm::settings::modules::CoreSettings::moduleName), "enable-tbb", false);
+    ASSERT_TRUE(storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet());
+    EXPECT_EQ(dtmcMatrix, dtmc->getTransitionMatrix().toMatrix(dtmcOdd, dtmcOdd));
+    EXPECT_EQ(mdpMatrix, mdp->getTransitionMatrix().toMatrix(mdp->getNondeterminismVariables(), mdpOdd, mdpOdd));
+    std::pair<storm::storage::SparseMatrix<double>, std::vector<double>> parallelMdpMatrixVector = mdp->getTransitionMatrix().toMatrixVector(choiceValues, mdp->getNondeterminismVariables(), mdpOdd, mdpOdd);
+    EXPECT_EQ(mdpMatrixVector.first, parallelMdpMatrixVector.first);
+    EXPECT_EQ(mdpMatrixVector.second, parallelMdpMatrixVector.second);
+    EXPECT_EQ(matrix, dd.toMatrix({x.first}, {x.second}, rowOdd, columnOdd));
+}
+
 TEST(SylvanDd, BddToExpressionTest) {
     std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> ddManager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
     std::pair<storm::expressions::Variable, storm::expressions::Variable> a = ddManager->addMetaVariable("a");
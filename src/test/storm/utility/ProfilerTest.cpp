@@ -0,0 +1,54 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#include <thread>
+
+#include "storm/utility/Profiler.h"
+
+TEST(ProfilerTest, NestedPhasesAndCounters) {
+    storm::utility::Profiler& profiler = storm::utility::Profiler::getInstance();
+    profiler.reset();
+    profiler.setEnabled(true);
+
+    for (uint64_t i = 0; i < 2; ++i) {
+        storm::utility::ProfilerPhase outer("outer");
+        storm::utility::addToProfilerCounter("iterations", 3);
+        {
+            storm::utility::ProfilerPhase inner("inner");
+            storm::utility::addToProfilerCounter("iterations", 1);
+        }
+    }
+    std::thread worker([] () {
+        storm::utility::ProfilerPhase phase("worker");
+        storm::utility::addToProfilerCounter("iterations", 10);
+    });
+    worker.join();
+
+    profiler.setEnabled(false);
+    {
+        // Phases and counters are ignored while the profiler is disabled.
+        storm::utility::ProfilerPhase ignored("ignored");
+        storm::utility::addToProfilerCounter("iterations", 100);
+    }
+
+    EXPECT_EQ(18ull, profiler.getCounter("iterations"));
+
+    modernjson::json profile = profiler.toJson();
+    ASSERT_EQ(2ull, profile["threads"].size());
+    auto const& mainPhases = profile["threads"][0]["phases"];
+    ASSERT_EQ(1ull, mainPhases.size());
+    EXPECT_EQ("outer", mainPhases[0]["name"].get<std::string>());
+    EXPECT_EQ(2ull, mainPhases[0]["calls"].get<uint64_t>());
+    EXPECT_EQ(6ull, mainPhases[0]["counters"]["iterations"].get<uint64_t>());
+    ASSERT_EQ(1ull, mainPhases[0]["phases"].size());
+    EXPECT_EQ("inner", mainPhases[0]["phases"][0]["name"].get<std::string>());
+    EXPECT_EQ(2ull, mainPhases[0]["phases"][0]["counters"]["iterations"].get<uint64_t>());
+    EXPECT_EQ("worker", profile["threads"][1]["phases"][0]["name"].get<std::string>());
+
+    // Each completed phase yields one complete event and each counter one counter event.
+    modernjson::json trace = profiler.toChromeTrace();
+    EXPECT_EQ(6ull, trace["traceEvents"].size());
+
+    profiler.reset();
+    EXPECT_EQ(0ull, profiler.getCounter("iterations"));
+}